@@ -0,0 +1,273 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_BAREISS_HPP
+#define BOOST_MP_BAREISS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <boost/multiprecision/number.hpp>
+#include <boost/multiprecision/detail/integer_ops.hpp>
+#include <boost/multiprecision/detail/parallel.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+
+//
+// The least number of matrix entries updated by each thread in an elimination step, the
+// later steps, which update fewer entries than this, are run on the calling thread alone:
+//
+#ifndef BOOST_MP_BAREISS_MIN_ENTRIES
+#define BOOST_MP_BAREISS_MIN_ENTRIES 256
+#endif
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// Bareiss' fraction free Gaussian elimination, see:
+//
+// "Sylvester's Identity and Multistep Integer-Preserving Gaussian Elimination",
+// Erwin H. Bareiss, Mathematics of Computation, 1968 (22), 565.
+//
+// After step k every entry of the trailing sub-matrix is a (k+1)x(k+1) minor of the
+// original, so the division by the previous pivot is always exact and the size of the
+// entries grows only linearly, with no gcd's required at any point.
+//
+// "a" is a row major matrix with n rows and "cols" columns, cols >= n, and is
+// reduced in place to upper triangular form over its first n columns.  Returns
+// the sign of the row permutation applied, or 0 if the leading n x n block is singular.
+//
+template <class Integer>
+int bareiss_eliminate(std::vector<Integer>& a, std::size_t n, std::size_t cols, std::size_t threads)
+{
+   int sign = 1;
+   for (std::size_t k = 0; k < n; ++k)
+   {
+      Integer* pivot_row = &a[k * cols];
+      if (pivot_row[k] == 0)
+      {
+         std::size_t i = k + 1;
+         while ((i < n) && (a[i * cols + k] == 0))
+            ++i;
+         if (i == n)
+            return 0;
+         for (std::size_t j = k; j < cols; ++j)
+            a[i * cols + j].swap(pivot_row[j]);
+         sign = -sign;
+      }
+      const Integer*    prev         = k ? &a[(k - 1) * cols + k - 1] : nullptr;
+      const std::size_t step_threads = (std::min)(threads, (n - k - 1) * (cols - k - 1) / BOOST_MP_BAREISS_MIN_ENTRIES);
+
+      parallel_for(k + 1, n, step_threads, [&a, pivot_row, prev, k, cols](std::size_t first, std::size_t last) {
+         Integer t;
+         for (std::size_t i = first; i < last; ++i)
+         {
+            Integer* row = &a[i * cols];
+            for (std::size_t j = k + 1; j < cols; ++j)
+            {
+               row[j] *= pivot_row[k];
+               t = row[k] * pivot_row[j];
+               row[j] -= t;
+               if (prev)
+                  row[j] = divide_exact(row[j], *prev);
+            }
+            row[k] = 0u;
+         }
+      });
+   }
+   return sign;
+}
+
+//
+// Solves the system left in "a" by bareiss_eliminate with right hand side in column n.
+// On exit y holds integers such that y[i] / d is the solution, where d is the last pivot:
+//
+template <class Integer>
+void bareiss_back_substitute(const std::vector<Integer>& a, std::size_t n, std::vector<Integer>& y)
+{
+   const std::size_t cols = n + 1;
+   const Integer&    d    = a[(n - 1) * cols + n - 1];
+   Integer           t;
+   y.resize(n);
+   y[n - 1] = a[(n - 1) * cols + n];
+   for (std::size_t i = n - 1; i-- > 0;)
+   {
+      const Integer* row = &a[i * cols];
+      y[i] = row[n] * d;
+      for (std::size_t j = i + 1; j < n; ++j)
+      {
+         t = row[j] * y[j];
+         y[i] -= t;
+      }
+      y[i] = divide_exact(y[i], row[i]);
+   }
+}
+
+template <class Number>
+void bareiss_check_size(const std::vector<Number>& a, std::size_t n)
+{
+   if (a.size() != n * n)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("The matrix does not have the number of elements required by its dimension."));
+   }
+}
+
+//
+// Scales row i of the n x n matrix a (and element i of b when present) by the lcm of the
+// row's denominators, writing the resulting integer matrix to "result" with row stride cols.
+// Returns the product of the scale factors.
+//
+template <class Rational, class Integer>
+Integer bareiss_scale_to_integer(const std::vector<Rational>& a, const std::vector<Rational>* b, std::size_t n, std::size_t cols, std::vector<Integer>& result)
+{
+   Integer scale(1u), l, t;
+   result.resize(n * cols);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      l = 1u;
+      for (std::size_t j = 0; j < n; ++j)
+         l = lcm(l, denominator(a[i * n + j]));
+      if (b)
+         l = lcm(l, denominator((*b)[i]));
+      for (std::size_t j = 0; j < n; ++j)
+      {
+         t = denominator(a[i * n + j]);
+         result[i * cols + j] = l / t;
+         result[i * cols + j] *= numerator(a[i * n + j]);
+      }
+      if (b)
+      {
+         t = denominator((*b)[i]);
+         result[i * cols + n] = l / t;
+         result[i * cols + n] *= numerator((*b)[i]);
+      }
+      scale *= l;
+   }
+   return scale;
+}
+
+} // namespace detail
+
+//
+// Determinant of the row major n x n matrix "a" by Bareiss elimination.
+// When threads > 1 the row updates at each elimination step are shared out over
+// up to that many threads.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+bareiss_determinant(std::vector<number<Backend, ExpressionTemplates> > a, std::size_t n, std::size_t threads = 1)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   detail::bareiss_check_size(a, n);
+   if (n == 0)
+      return number_type(1u);
+   int sign = detail::bareiss_eliminate(a, n, n, threads);
+   if (sign == 0)
+      return number_type(0u);
+   number_type result(std::move(a.back()));
+   if (sign < 0)
+      result = -result;
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_rational, number<Backend, ExpressionTemplates> >::type
+bareiss_determinant(const std::vector<number<Backend, ExpressionTemplates> >& a, std::size_t n, std::size_t threads = 1)
+{
+   using number_type  = number<Backend, ExpressionTemplates>;
+   using integer_type = typename component_type<number_type>::type;
+
+   detail::bareiss_check_size(a, n);
+   if (n == 0)
+      return number_type(1u);
+   std::vector<integer_type> m;
+   integer_type              scale = detail::bareiss_scale_to_integer(a, static_cast<const std::vector<number_type>*>(nullptr), n, n, m);
+   int                       sign  = detail::bareiss_eliminate(m, n, n, threads);
+   if (sign == 0)
+      return number_type(0u);
+   if (sign < 0)
+      m.back() = -m.back();
+   return number_type(m.back(), scale);
+}
+
+//
+// Solves a.x = b for the row major n x n matrix "a", where n = b.size(), and returns the
+// determinant of a.  If the determinant is zero then x is left empty.
+//
+// For integer types the solution is not in general integral, so x is set to the
+// numerators of the solution over the returned determinant: the solution is x[i] / det.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+bareiss_solve(const std::vector<number<Backend, ExpressionTemplates> >& a, const std::vector<number<Backend, ExpressionTemplates> >& b, std::vector<number<Backend, ExpressionTemplates> >& x, std::size_t threads = 1)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   const std::size_t n = b.size();
+   detail::bareiss_check_size(a, n);
+   x.clear();
+   if (n == 0)
+      return number_type(1u);
+
+   std::vector<number_type> m(n * (n + 1));
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      for (std::size_t j = 0; j < n; ++j)
+         m[i * (n + 1) + j] = a[i * n + j];
+      m[i * (n + 1) + n] = b[i];
+   }
+   int sign = detail::bareiss_eliminate(m, n, n + 1, threads);
+   if (sign == 0)
+      return number_type(0u);
+   detail::bareiss_back_substitute(m, n, x);
+
+   number_type det(std::move(m[(n - 1) * (n + 1) + n - 1]));
+   if (sign < 0)
+   {
+      det = -det;
+      for (number_type& v : x)
+         v = -v;
+   }
+   return det;
+}
+
+//
+// As above, but for rational types x is set to the solution itself.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_rational, number<Backend, ExpressionTemplates> >::type
+bareiss_solve(const std::vector<number<Backend, ExpressionTemplates> >& a, const std::vector<number<Backend, ExpressionTemplates> >& b, std::vector<number<Backend, ExpressionTemplates> >& x, std::size_t threads = 1)
+{
+   using number_type  = number<Backend, ExpressionTemplates>;
+   using integer_type = typename component_type<number_type>::type;
+
+   const std::size_t n = b.size();
+   detail::bareiss_check_size(a, n);
+   x.clear();
+   if (n == 0)
+      return number_type(1u);
+
+   std::vector<integer_type> m, y;
+   integer_type              scale = detail::bareiss_scale_to_integer(a, &b, n, n + 1, m);
+   int                       sign  = detail::bareiss_eliminate(m, n, n + 1, threads);
+   if (sign == 0)
+      return number_type(0u);
+   detail::bareiss_back_substitute(m, n, y);
+
+   integer_type& d = m[(n - 1) * (n + 1) + n - 1];
+   x.reserve(n);
+   for (std::size_t i = 0; i < n; ++i)
+      x.emplace_back(y[i], d);
+   if (sign < 0)
+      d = -d;
+   return number_type(d, scale);
+}
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_BAREISS_HPP
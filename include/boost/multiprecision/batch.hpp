@@ -0,0 +1,366 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_BATCH_HPP
+#define BOOST_MP_BATCH_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/detail/parallel.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// The type in which batch_mulmod forms its double width products: unbounded types
+// can use themselves, fixed precision types need a type with room for the whole product.
+//
+template <class Number, bool Bounded = std::numeric_limits<Number>::is_bounded>
+struct batch_wide_type
+{
+   using type = Number;
+};
+template <class Number>
+struct batch_wide_type<Number, true>
+{
+   static constexpr std::size_t bits = 2 * static_cast<std::size_t>(std::numeric_limits<Number>::digits);
+   using type                        = number<cpp_int_backend<bits, bits, signed_magnitude, unchecked, void>, et_off>;
+};
+
+//
+// Modular multiplication by a fixed modulus m, the general case just multiplies and
+// takes the remainder:
+//
+template <class Number, class Enable = void>
+class batch_modular_multiplier
+{
+ public:
+   using wide_type = typename batch_wide_type<Number>::type;
+
+   explicit batch_modular_multiplier(const Number& m) : m_modulus(m) {}
+
+   struct scratch_type
+   {
+      wide_type x;
+   };
+
+   void mulmod(Number& r, const Number& a, const Number& b, scratch_type& s) const
+   {
+      multiply(s.x, wide_type(a), wide_type(b));
+      s.x %= m_modulus;
+      r = static_cast<Number>(s.x);
+      if (r.sign() < 0)
+         r += static_cast<Number>(m_modulus);
+   }
+
+ private:
+   wide_type m_modulus;
+};
+
+//
+// For cpp_int the remainder is found by Barrett reduction on the limbs, see the
+// Handbook of Applied Cryptography, Algorithm 14.42.  With m of k limbs, b the limb
+// base, and mu = floor(b^2k / m) computed once up front, the estimate
+//
+// q = floor(floor(x / b^(k-1)) * mu / b^(k+1))
+//
+// is at most 2 less than floor(x / m) for any x < b^2k, so each remainder costs two
+// multiplications (one of which need only produce its low limbs) and at most two
+// subtractions, rather than a long division.  From 8 limbs up, special form moduli such
+// as 2^k - c for small c are reduced by shifts and additions instead, which is about twice
+// as fast again, see cpp_int/modular.hpp.  Below that Barrett reduction is faster.
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+class batch_modular_multiplier<number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>, typename std::enable_if<!backends::is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value>::type>
+{
+ public:
+   using number_type = number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>;
+   using work_type   = typename special_modulus_work_type<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::type;
+
+   explicit batch_modular_multiplier(const number_type& m) : m_modulus(m)
+   {
+      m_is_special = (m.backend().size() >= 8) && m_special.init(work_type(m));
+      if (m_is_special)
+         return;
+      cpp_int t(m), mu;
+      m_k = t.backend().size();
+      m_m.assign(t.backend().limbs(), t.backend().limbs() + m_k);
+      bit_set(mu, 2 * m_k * sizeof(limb_type) * CHAR_BIT);
+      t = mu / t;
+      //
+      // mu has k + 2 limbs only when m = b^(k-1), including m = 1, and then the remainder
+      // is just the low k - 1 limbs:
+      //
+      m_is_power = t.backend().size() > m_k + 1;
+      if (m_is_power)
+         return;
+      m_mu.assign(m_k + 1, 0u);
+      std::copy(t.backend().limbs(), t.backend().limbs() + t.backend().size(), m_mu.begin());
+   }
+
+   struct scratch_type
+   {
+      std::vector<limb_type> buffer;
+      work_type              x, h, t;
+   };
+
+   void mulmod(number_type& r, const number_type& a, const number_type& b, scratch_type& s) const
+   {
+      if (m_is_special)
+      {
+         s.h = a;
+         s.t = b;
+         multiply(s.x, s.h, s.t);
+         m_special.reduce(s.x, s.h, s.t);
+         r = static_cast<number_type>(s.x);
+         return;
+      }
+      const std::size_t k = m_k;
+      if (s.buffer.size() < 6 * k + 5)
+         s.buffer.resize(6 * k + 5);
+      limb_type* pa = s.buffer.data();
+      limb_type* pb = pa + k + 1;
+      limb_type* px = pb + k;
+      limb_type* pq = px + 2 * k + 2;
+
+      load(pa, a);
+      load(pb, b);
+      if (m_is_power)
+      {
+         multiply_limbs(px, pa, k, pb, k, k - 1);
+         if (k == 1)
+            r = 0u;
+         else
+         {
+            r.backend().resize(k - 1, k - 1);
+            std::copy(px, px + k - 1, r.backend().limbs());
+            r.backend().normalize();
+            r.backend().sign(false);
+         }
+         return;
+      }
+      // x = a * b, 2k limbs:
+      multiply_limbs(px, pa, k, pb, k, 2 * k + 2);
+      // q = floor(x / b^(k-1)) * mu, of which only limbs k+1 and up are needed:
+      multiply_limbs(pq, px + k - 1, k + 1, m_mu.data(), k + 1, 2 * k + 2);
+      // x = x - q * m modulo b^(k+1), reusing the low half of q for the product:
+      std::copy(pq + k + 1, pq + 2 * k + 2, pa);
+      multiply_limbs(pq, pa, k + 1, m_m.data(), k, k + 1);
+      limb_type borrow = 0;
+      for (std::size_t i = 0; i < k + 1; ++i)
+      {
+         limb_type d = px[i] - pq[i];
+         limb_type c = px[i] < pq[i];
+         px[i]       = d - borrow;
+         borrow      = c | (d < borrow);
+      }
+      while (!less_than_modulus(px))
+      {
+         borrow = 0;
+         for (std::size_t i = 0; i < k + 1; ++i)
+         {
+            limb_type m = i < k ? m_m[i] : 0u;
+            limb_type d = px[i] - m;
+            limb_type c = px[i] < m;
+            px[i]       = d - borrow;
+            borrow      = c | (d < borrow);
+         }
+      }
+      r.backend().resize(k, k);
+      std::copy(px, px + k, r.backend().limbs());
+      r.backend().normalize();
+      r.backend().sign(false);
+   }
+
+ private:
+   //
+   // Copies the limbs of a reduced modulo m into the k limbs at s:
+   //
+   void load(limb_type* s, const number_type& a) const
+   {
+      std::fill(s, s + m_k, static_cast<limb_type>(0u));
+      if ((a.sign() < 0) || (a >= m_modulus))
+      {
+         number_type t = a % m_modulus;
+         if (t.sign() < 0)
+            t += m_modulus;
+         std::copy(t.backend().limbs(), t.backend().limbs() + t.backend().size(), s);
+      }
+      else
+         std::copy(a.backend().limbs(), a.backend().limbs() + a.backend().size(), s);
+   }
+   //
+   // r = the low rn limbs of a * b, r may not overlap a or b:
+   //
+   static void multiply_limbs(limb_type* r, const limb_type* a, std::size_t an, const limb_type* b, std::size_t bn, std::size_t rn)
+   {
+#ifdef BOOST_MP_HAS_MULX_ADX
+      if (::boost::multiprecision::detail::has_mulx_adx())
+      {
+         // Each row writes its carry to the limb above, which no earlier row has touched:
+         std::size_t jn = (std::min)(bn, rn);
+         limb_type   carry = ::boost::multiprecision::detail::mulx_mul_1(r, b, jn, a[0]);
+         if (jn < rn)
+            r[jn] = carry;
+         for (std::size_t i = 1; (i < an) && (i < rn); ++i)
+         {
+            jn    = (std::min)(bn, rn - i);
+            carry = ::boost::multiprecision::detail::mulx_addmul_1(r + i, b, jn, a[i]);
+            if (i + jn < rn)
+               r[i + jn] = carry;
+         }
+         if (an + bn < rn)
+            std::fill(r + an + bn, r + rn, static_cast<limb_type>(0u));
+         return;
+      }
+#endif
+      std::fill(r, r + rn, static_cast<limb_type>(0u));
+      for (std::size_t i = 0; (i < an) && (i < rn); ++i)
+      {
+         double_limb_type  carry = 0;
+         const std::size_t jn    = (std::min)(bn, rn - i);
+         for (std::size_t j = 0; j < jn; ++j)
+         {
+            carry += static_cast<double_limb_type>(a[i]) * b[j] + r[i + j];
+            r[i + j] = static_cast<limb_type>(carry);
+            carry >>= sizeof(limb_type) * CHAR_BIT;
+         }
+         if (i + jn < rn)
+            r[i + jn] = static_cast<limb_type>(carry);
+      }
+   }
+   bool less_than_modulus(const limb_type* x) const
+   {
+      if (x[m_k])
+         return false;
+      for (std::size_t i = m_k; i-- > 0;)
+      {
+         if (x[i] != m_m[i])
+            return x[i] < m_m[i];
+      }
+      return false;
+   }
+
+   number_type                 m_modulus;
+   std::size_t                 m_k = 0;
+   std::vector<limb_type>      m_m, m_mu;
+   special_modulus<work_type>  m_special;
+   bool                        m_is_special;
+   bool                        m_is_power = false;
+};
+
+} // namespace detail
+
+//
+// Element wise arithmetic over arrays of n integers: r[i] = a[i] op b[i].  The backend
+// routines are called directly, so there are no temporaries, and r may be the same
+// array as a or b.  When threads > 1 the array is shared out over up to that many threads.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+void batch_add(number<Backend, ExpressionTemplates>* r, const number<Backend, ExpressionTemplates>* a, const number<Backend, ExpressionTemplates>* b, std::size_t n, std::size_t threads = 1)
+{
+   detail::parallel_for(0, n, threads, [r, a, b](std::size_t first, std::size_t last) {
+      using default_ops::eval_add;
+      for (std::size_t i = first; i < last; ++i)
+         eval_add(r[i].backend(), a[i].backend(), b[i].backend());
+   });
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+void batch_subtract(number<Backend, ExpressionTemplates>* r, const number<Backend, ExpressionTemplates>* a, const number<Backend, ExpressionTemplates>* b, std::size_t n, std::size_t threads = 1)
+{
+   detail::parallel_for(0, n, threads, [r, a, b](std::size_t first, std::size_t last) {
+      using default_ops::eval_subtract;
+      for (std::size_t i = first; i < last; ++i)
+         eval_subtract(r[i].backend(), a[i].backend(), b[i].backend());
+   });
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+void batch_multiply(number<Backend, ExpressionTemplates>* r, const number<Backend, ExpressionTemplates>* a, const number<Backend, ExpressionTemplates>* b, std::size_t n, std::size_t threads = 1)
+{
+   detail::parallel_for(0, n, threads, [r, a, b](std::size_t first, std::size_t last) {
+      using default_ops::eval_multiply;
+      for (std::size_t i = first; i < last; ++i)
+         eval_multiply(r[i].backend(), a[i].backend(), b[i].backend());
+   });
+}
+
+//
+// Sets r[i] to -1, 0 or 1 as a[i] is less than, equal to, or greater than b[i]:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+void batch_compare(int* r, const number<Backend, ExpressionTemplates>* a, const number<Backend, ExpressionTemplates>* b, std::size_t n, std::size_t threads = 1)
+{
+   detail::parallel_for(0, n, threads, [r, a, b](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+         int c = a[i].compare(b[i]);
+         r[i]  = (c > 0) - (c < 0);
+      }
+   });
+}
+
+//
+// Sets r[i] to a[i] * b[i] mod m, with the result in [0, m).  The modulus is shared by
+// every element, so for cpp_int a Barrett reciprocal is computed once, and each element
+// then costs three multiplications rather than a multiplication and a division.
+//
+// Throws a std::domain_error if m is not positive.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer>::type
+batch_mulmod(number<Backend, ExpressionTemplates>* r, const number<Backend, ExpressionTemplates>* a, const number<Backend, ExpressionTemplates>* b, const number<Backend, ExpressionTemplates>& m, std::size_t n, std::size_t threads = 1)
+{
+   using multiplier_type = detail::batch_modular_multiplier<number<Backend, ExpressionTemplates> >;
+
+   if (m.sign() <= 0)
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("The modulus must be positive."));
+   const multiplier_type multiplier(m);
+   detail::parallel_for(0, n, threads, [r, a, b, &multiplier](std::size_t first, std::size_t last) {
+      typename multiplier_type::scratch_type scratch;
+      for (std::size_t i = first; i < last; ++i)
+         multiplier.mulmod(r[i], a[i], b[i], scratch);
+   });
+}
+
+//
+// Fixed width byte fields, as found in network packets and binary files: sets r[i] to the
+// unsigned integer in the field_bytes bytes at data + i * field_bytes, or writes the magnitude of
+// a[i] zero padded to field_bytes bytes at out + i * field_bytes, most significant byte first when
+// msv_first is true.  Only the low field_bytes * CHAR_BIT bits of values which are too large for
+// their field are written.
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+void batch_import_bits(number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>* r, const unsigned char* data, std::size_t field_bytes, std::size_t n, bool msv_first = true, std::size_t threads = 1)
+{
+   using tag_type = typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::trivial_tag;
+   detail::parallel_for(0, n, threads, [r, data, field_bytes, msv_first](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+         detail::import_chunks(r[i].backend(), data + i * field_bytes, field_bytes, msv_first, tag_type());
+   });
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+void batch_export_bits(unsigned char* out, const number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>* a, std::size_t field_bytes, std::size_t n, bool msv_first = true, std::size_t threads = 1)
+{
+   using tag_type = typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::trivial_tag;
+   detail::parallel_for(0, n, threads, [out, a, field_bytes, msv_first](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+         detail::export_bytes(a[i].backend(), out + i * field_bytes, field_bytes, msv_first, tag_type());
+   });
+}
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_BATCH_HPP
@@ -0,0 +1,593 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_BINARY_FORMAT_HPP
+#define BOOST_MP_BINARY_FORMAT_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/detail/endian.hpp>
+
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+
+//
+// A compact, versioned binary format for cpp_int, cpp_bin_float, cpp_dec_float and
+// rational_adaptor<cpp_int_backend>, which is the same on every platform.  Each value is:
+//
+// byte 0:  The format version, currently 1.
+// byte 1:  Bits 0-3 the kind of value: 1 integer, 2 binary floating point, 3 decimal
+//          floating point, 4 rational.  Bit 4 is set for negative values.  Bits 5-6 are
+//          the class of a floating point value: 0 finite and non-zero, 1 zero, 2 infinity,
+//          3 NaN.  Bit 7 is reserved and zero.
+//
+// followed by the body, in which a "varint" is an unsigned LEB128 number, a "zigzag"
+// is a signed number n stored as the varint 2n for n >= 0 and -2n-1 for n < 0, and a
+// "magnitude" is a varint byte count followed by that many bytes of an unsigned integer,
+// least significant first, with no high zero bytes:
+//
+// integer:                 magnitude.
+// binary floating point:   zigzag E, magnitude M where M is odd, the value is M * 2^(E - msb(M)),
+//                          there is no body for zero, infinity or NaN.
+// decimal floating point:  zigzag E, varint n, then n base 10^8 digits as 4 bytes each least
+//                          significant byte first, the value is the sum of d[i] * 10^(E - 8i),
+//                          there is no body for zero, infinity or NaN.
+// rational:                magnitude of the numerator then magnitude of the denominator, in
+//                          lowest terms.
+//
+// On little endian platforms magnitudes are copied to and from the limbs with memcpy.
+//
+namespace boost {
+namespace multiprecision {
+
+struct write_to_result
+{
+   unsigned char* ptr;
+   std::errc      ec;
+};
+
+struct read_from_result
+{
+   const unsigned char* ptr;
+   std::errc            ec;
+};
+
+namespace detail {
+
+constexpr unsigned char binary_format_version = 1;
+
+enum binary_format_kind : unsigned char
+{
+   binary_kind_integer  = 1,
+   binary_kind_binary   = 2,
+   binary_kind_decimal  = 3,
+   binary_kind_rational = 4
+};
+
+constexpr unsigned char binary_flag_negative = 0x10;
+constexpr unsigned      binary_class_shift   = 5;
+
+enum binary_format_class : unsigned char
+{
+   binary_class_finite   = 0,
+   binary_class_zero     = 1,
+   binary_class_infinity = 2,
+   binary_class_nan      = 3
+};
+
+inline std::size_t binary_varint_size(std::uintmax_t v) noexcept
+{
+   std::size_t n = 1;
+   while (v >= 0x80)
+   {
+      v >>= 7;
+      ++n;
+   }
+   return n;
+}
+
+inline unsigned char* binary_write_varint(unsigned char* p, std::uintmax_t v) noexcept
+{
+   while (v >= 0x80)
+   {
+      *p++ = static_cast<unsigned char>(v | 0x80);
+      v >>= 7;
+   }
+   *p++ = static_cast<unsigned char>(v);
+   return p;
+}
+
+//
+// Returns nullptr if the input ends, or the value doesn't fit in std::uintmax_t:
+//
+inline const unsigned char* binary_read_varint(const unsigned char* p, const unsigned char* last, std::uintmax_t& v) noexcept
+{
+   v = 0;
+   for (unsigned shift = 0; p != last; shift += 7)
+   {
+      const std::uintmax_t b = *p++ & 0x7Fu;
+      if ((shift >= sizeof(std::uintmax_t) * CHAR_BIT) || ((b << shift) >> shift != b))
+         return nullptr;
+      v |= b << shift;
+      if (!(p[-1] & 0x80))
+         return p;
+   }
+   return nullptr;
+}
+
+inline std::uintmax_t binary_zigzag(std::intmax_t v) noexcept
+{
+   return v < 0 ? 2 * (static_cast<std::uintmax_t>(-(v + 1))) + 1 : 2 * static_cast<std::uintmax_t>(v);
+}
+
+inline std::intmax_t binary_unzigzag(std::uintmax_t v) noexcept
+{
+   return v & 1 ? -static_cast<std::intmax_t>(v >> 1) - 1 : static_cast<std::intmax_t>(v >> 1);
+}
+
+//
+// A little endian 32 bit cpp_dec_float digit:
+//
+inline std::uint32_t binary_read_digit(const unsigned char* p) noexcept
+{
+   std::uint32_t d = 0;
+   for (unsigned j = 0; j < 4; ++j)
+      d |= static_cast<std::uint32_t>(p[j]) << (CHAR_BIT * j);
+   return d;
+}
+
+//
+// Magnitudes of cpp_int_backend's: the number of significant bytes, writing the bytes
+// from byte skip upwards, and reading which returns false if the value doesn't fit:
+//
+template <class Int>
+inline std::size_t binary_magnitude_bytes(const Int& v, const std::integral_constant<bool, false>&) noexcept
+{
+   const limb_type top = v.limbs()[v.size() - 1];
+   std::size_t     n   = (v.size() - 1) * sizeof(limb_type);
+   for (limb_type t = top; t; t >>= CHAR_BIT)
+      ++n;
+   return n;
+}
+template <class Int>
+inline std::size_t binary_magnitude_bytes(const Int& v, const std::integral_constant<bool, true>&) noexcept
+{
+   std::size_t n = 0;
+   for (typename Int::local_limb_type t = *v.limbs(); t; t >>= CHAR_BIT)
+      ++n;
+   return n;
+}
+
+template <class Int>
+inline unsigned char* binary_write_bytes(unsigned char* p, const Int& v, std::size_t skip, std::size_t n, const std::integral_constant<bool, false>&) noexcept
+{
+#if BOOST_MP_ENDIAN_LITTLE_BYTE && !defined(BOOST_MP_TEST_NO_LE)
+   std::memcpy(p, reinterpret_cast<const unsigned char*>(v.limbs()) + skip, n);
+   return p + n;
+#else
+   for (std::size_t i = skip; i < skip + n; ++i)
+      *p++ = static_cast<unsigned char>(v.limbs()[i / sizeof(limb_type)] >> (CHAR_BIT * (i % sizeof(limb_type))));
+   return p;
+#endif
+}
+template <class Int>
+inline unsigned char* binary_write_bytes(unsigned char* p, const Int& v, std::size_t skip, std::size_t n, const std::integral_constant<bool, true>&) noexcept
+{
+   const typename Int::local_limb_type l = *v.limbs();
+   for (std::size_t i = skip; i < skip + n; ++i)
+      *p++ = static_cast<unsigned char>(l >> (CHAR_BIT * i));
+   return p;
+}
+
+template <class Int>
+inline bool binary_fits(const unsigned char* p, std::size_t n) noexcept
+{
+   using limits = std::numeric_limits<number<Int> >;
+   if (!n || !limits::is_bounded)
+      return true;
+   std::size_t bits = (n - 1) * CHAR_BIT;
+   for (unsigned t = p[n - 1]; t; t >>= 1)
+      ++bits;
+   return bits <= static_cast<std::size_t>(limits::digits);
+}
+
+template <class Int>
+inline void binary_read_bytes(const unsigned char* p, std::size_t n, Int& v, const std::integral_constant<bool, false>&)
+{
+   const std::size_t limbs = n ? (n - 1) / sizeof(limb_type) + 1 : 1;
+   v.resize(limbs, limbs);
+   BOOST_MP_ASSERT(v.size() == limbs);
+   limb_type* pl = v.limbs();
+   pl[limbs - 1] = 0;
+#if BOOST_MP_ENDIAN_LITTLE_BYTE && !defined(BOOST_MP_TEST_NO_LE)
+   std::memcpy(pl, p, n);
+#else
+   for (std::size_t i = 0; i < limbs; ++i)
+      pl[i] = 0;
+   for (std::size_t i = 0; i < n; ++i)
+      pl[i / sizeof(limb_type)] |= static_cast<limb_type>(p[i]) << (CHAR_BIT * (i % sizeof(limb_type)));
+#endif
+   v.normalize();
+}
+template <class Int>
+inline void binary_read_bytes(const unsigned char* p, std::size_t n, Int& v, const std::integral_constant<bool, true>&)
+{
+   typename Int::local_limb_type l = 0;
+   for (std::size_t i = 0; i < n; ++i)
+      l |= static_cast<typename Int::local_limb_type>(p[i]) << (CHAR_BIT * i);
+   *v.limbs() = l;
+}
+
+//
+// Reads the byte count of a magnitude and trims high zero bytes, returns nullptr
+// if the input ends first:
+//
+inline const unsigned char* binary_read_magnitude(const unsigned char* p, const unsigned char* last, std::size_t& n) noexcept
+{
+   std::uintmax_t count;
+   p = binary_read_varint(p, last, count);
+   if (!p || (count > static_cast<std::uintmax_t>(last - p)))
+      return nullptr;
+   n = static_cast<std::size_t>(count);
+   while (n && !p[n - 1])
+      --n;
+   return p;
+}
+
+template <class Int>
+struct binary_int_traits
+{
+   using trivial = std::integral_constant<bool, boost::multiprecision::backends::is_trivial_cpp_int<Int>::value>;
+};
+
+//
+// Specialized for each supported backend, with members kind, body_size, write_body and
+// read_body:
+//
+template <class Backend>
+struct binary_format;
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+struct binary_format<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >
+{
+   using backend_type = backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>;
+   using trivial      = typename binary_int_traits<backend_type>::trivial;
+
+   static constexpr unsigned char kind = binary_kind_integer;
+
+   static unsigned char flags(const backend_type& v) noexcept
+   {
+      return v.sign() ? binary_flag_negative : 0;
+   }
+   static std::size_t body_size(const backend_type& v) noexcept
+   {
+      const std::size_t n = binary_magnitude_bytes(v, trivial());
+      return binary_varint_size(n) + n;
+   }
+   static unsigned char* write_body(unsigned char* p, const backend_type& v) noexcept
+   {
+      const std::size_t n = binary_magnitude_bytes(v, trivial());
+      return binary_write_bytes(binary_write_varint(p, n), v, 0, n, trivial());
+   }
+   static read_from_result read_body(const unsigned char* p, const unsigned char* last, unsigned char flags, backend_type& v)
+   {
+      std::size_t n;
+      p = binary_read_magnitude(p, last, n);
+      if (!p)
+         return {last, std::errc::invalid_argument};
+      const bool neg = (flags & binary_flag_negative) && n;
+      if ((neg && !std::numeric_limits<number<backend_type> >::is_signed) || !binary_fits<backend_type>(p, n))
+         return {p, std::errc::result_out_of_range};
+      binary_read_bytes(p, n, v, trivial());
+      if (neg != v.sign())
+         v.negate();
+      return {p + n, std::errc()};
+   }
+};
+
+template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+struct binary_format<backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> >
+{
+   using backend_type = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using rep_type     = typename backend_type::rep_type;
+   using trivial      = typename binary_int_traits<rep_type>::trivial;
+
+   static constexpr unsigned char kind = binary_kind_binary;
+
+   static unsigned char flags(const backend_type& v) noexcept
+   {
+      const unsigned char c = v.exponent() == backend_type::exponent_zero ? binary_class_zero : v.exponent() == backend_type::exponent_infinity ? binary_class_infinity : v.exponent() == backend_type::exponent_nan ? binary_class_nan : binary_class_finite;
+      return static_cast<unsigned char>((c << binary_class_shift) | (v.sign() && (c != binary_class_nan) ? binary_flag_negative : 0));
+   }
+   //
+   // The mantissa is written without its low zero bits, so that each value has one encoding
+   // whatever the precision of the type:
+   //
+   static std::size_t mantissa_bytes(std::size_t shift) noexcept
+   {
+      return (backend_type::bit_count - 1 - shift) / CHAR_BIT + 1;
+   }
+   static std::size_t body_size(const backend_type& v) noexcept
+   {
+      if ((flags(v) >> binary_class_shift) != binary_class_finite)
+         return 0;
+      const std::size_t n = mantissa_bytes(eval_lsb(v.bits()));
+      return binary_varint_size(binary_zigzag(v.exponent())) + binary_varint_size(n) + n;
+   }
+   static unsigned char* write_body(unsigned char* p, const backend_type& v) noexcept
+   {
+      if ((flags(v) >> binary_class_shift) != binary_class_finite)
+         return p;
+      const std::size_t shift = eval_lsb(v.bits()), n = mantissa_bytes(shift);
+      p                       = binary_write_varint(binary_write_varint(p, binary_zigzag(v.exponent())), n);
+      if (shift % CHAR_BIT == 0)
+         return binary_write_bytes(p, v.bits(), shift / CHAR_BIT, n, trivial());
+      rep_type m(v.bits());
+      eval_right_shift(m, static_cast<unsigned>(shift));
+      return binary_write_bytes(p, m, 0, n, trivial());
+   }
+   static read_from_result read_body(const unsigned char* p, const unsigned char* last, unsigned char flags, backend_type& v)
+   {
+      const bool neg = (flags & binary_flag_negative) != 0;
+      switch (flags >> binary_class_shift)
+      {
+      case binary_class_zero:
+         v = limb_type(0);
+         v.sign() = neg;
+         return {p, std::errc()};
+      case binary_class_infinity:
+         v = std::numeric_limits<number<backend_type> >::infinity().backend();
+         v.sign() = neg;
+         return {p, std::errc()};
+      case binary_class_nan:
+         v = std::numeric_limits<number<backend_type> >::quiet_NaN().backend();
+         return {p, std::errc()};
+      default:
+         break;
+      }
+      std::uintmax_t e;
+      std::size_t    n;
+      p = binary_read_varint(p, last, e);
+      if (p)
+         p = binary_read_magnitude(p, last, n);
+      if (!p || !n)
+         return {last, std::errc::invalid_argument};
+      std::intmax_t exponent = binary_unzigzag(e);
+      if ((exponent < backend_type::min_exponent) || (exponent > backend_type::max_exponent))
+         return {p + n, std::errc::result_out_of_range};
+      std::size_t top_bit = (n - 1) * CHAR_BIT;
+      for (unsigned t = p[n - 1] >> 1; t; t >>= 1)
+         ++top_bit;
+      if (top_bit < backend_type::bit_count)
+      {
+         binary_read_bytes(p, n, v.bits(), trivial());
+         eval_left_shift(v.bits(), static_cast<unsigned>(backend_type::bit_count - 1 - top_bit));
+      }
+      else
+      {
+         // Written by a type with more precision, round to nearest:
+         cpp_int m;
+         binary_read_bytes(p, n, m.backend(), std::integral_constant<bool, false>());
+         const std::size_t shift   = top_bit + 1 - backend_type::bit_count;
+         const bool        roundup = bit_test(m, static_cast<unsigned>(shift - 1)) && ((lsb(m) < shift - 1) || bit_test(m, static_cast<unsigned>(shift)));
+         m >>= shift;
+         if (roundup && (msb(++m) == backend_type::bit_count))
+         {
+            m >>= 1;
+            if (++exponent > backend_type::max_exponent)
+               return {p + n, std::errc::result_out_of_range};
+         }
+         v.bits() = m.backend();
+      }
+      v.exponent() = static_cast<Exponent>(exponent);
+      v.sign()     = neg;
+      return {p + n, std::errc()};
+   }
+};
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+struct binary_format<backends::cpp_dec_float<Digits10, ExponentType, Allocator> >
+{
+   using backend_type = backends::cpp_dec_float<Digits10, ExponentType, Allocator>;
+
+   static constexpr unsigned char kind = binary_kind_decimal;
+
+   static unsigned char flags(const backend_type& v) noexcept
+   {
+      const unsigned char c = v.isnan() ? binary_class_nan : v.isinf() ? binary_class_infinity : v.iszero() ? binary_class_zero : binary_class_finite;
+      return static_cast<unsigned char>((c << binary_class_shift) | (v.neg && (c != binary_class_nan) && (c != binary_class_zero) ? binary_flag_negative : 0));
+   }
+   static std::size_t digit_count(const backend_type& v) noexcept
+   {
+      std::size_t n = static_cast<std::size_t>(backend_type::cpp_dec_float_elem_number);
+      while (n && !v.data[n - 1])
+         --n;
+      return n;
+   }
+   static std::size_t body_size(const backend_type& v) noexcept
+   {
+      if ((flags(v) >> binary_class_shift) != binary_class_finite)
+         return 0;
+      const std::size_t n = digit_count(v);
+      return binary_varint_size(binary_zigzag(v.exp)) + binary_varint_size(n) + 4 * n;
+   }
+   static unsigned char* write_body(unsigned char* p, const backend_type& v) noexcept
+   {
+      if ((flags(v) >> binary_class_shift) != binary_class_finite)
+         return p;
+      const std::size_t n = digit_count(v);
+      p                   = binary_write_varint(binary_write_varint(p, binary_zigzag(v.exp)), n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         const std::uint32_t d = v.data[i];
+         for (unsigned j = 0; j < 4; ++j)
+            *p++ = static_cast<unsigned char>(d >> (CHAR_BIT * j));
+      }
+      return p;
+   }
+   static read_from_result read_body(const unsigned char* p, const unsigned char* last, unsigned char flags, backend_type& v)
+   {
+      switch (flags >> binary_class_shift)
+      {
+      case binary_class_zero:
+         v = backend_type::zero();
+         return {p, std::errc()};
+      case binary_class_infinity:
+         v = backend_type::inf();
+         if (flags & binary_flag_negative)
+            v.negate();
+         return {p, std::errc()};
+      case binary_class_nan:
+         v = backend_type::nan();
+         return {p, std::errc()};
+      default:
+         break;
+      }
+      std::uintmax_t e, count;
+      p = binary_read_varint(p, last, e);
+      if (p)
+         p = binary_read_varint(p, last, count);
+      if (!p || !count || (count > static_cast<std::uintmax_t>(last - p) / 4))
+         return {last, std::errc::invalid_argument};
+      const std::size_t   n   = static_cast<std::size_t>(count);
+      const unsigned char* end = p + 4 * n;
+      const std::uint32_t first_digit = binary_read_digit(p);
+      const std::intmax_t exponent    = binary_unzigzag(e);
+      if (!first_digit || (exponent % backend_type::cpp_dec_float_elem_digits10))
+         return {end, std::errc::invalid_argument};
+      if ((exponent < backend_type::cpp_dec_float_min_exp10) || (exponent > backend_type::cpp_dec_float_max_exp10))
+         return {end, std::errc::result_out_of_range};
+      //
+      // Digits beyond our precision are truncated, as when assigning from a cpp_dec_float
+      // of higher precision:
+      //
+      // Every digit is checked before v is touched:
+      const std::size_t keep = (std::min)(n, static_cast<std::size_t>(backend_type::cpp_dec_float_elem_number));
+      for (const unsigned char* q = p; q != end; q += 4)
+      {
+         if (binary_read_digit(q) >= static_cast<std::uint32_t>(backend_type::cpp_dec_float_elem_mask))
+            return {end, std::errc::invalid_argument};
+      }
+      for (std::size_t i = 0; i < keep; ++i, p += 4)
+         v.data[i] = binary_read_digit(p);
+      for (std::size_t i = keep; i < static_cast<std::size_t>(backend_type::cpp_dec_float_elem_number); ++i)
+         v.data[i] = 0;
+      v.exp       = static_cast<ExponentType>(exponent);
+      v.neg       = (flags & binary_flag_negative) != 0;
+      v.fpclass   = backend_type::cpp_dec_float_finite;
+      v.prec_elem = backend_type::cpp_dec_float_elem_number;
+      return {end, std::errc()};
+   }
+};
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+struct binary_format<backends::rational_adaptor<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> > >
+{
+   using int_type     = backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>;
+   using backend_type = backends::rational_adaptor<int_type>;
+   using int_format   = binary_format<int_type>;
+
+   static constexpr unsigned char kind = binary_kind_rational;
+
+   static unsigned char flags(const backend_type& v) noexcept
+   {
+      return int_format::flags(v.num());
+   }
+   static std::size_t body_size(const backend_type& v) noexcept
+   {
+      return int_format::body_size(v.num()) + int_format::body_size(v.denom());
+   }
+   static unsigned char* write_body(unsigned char* p, const backend_type& v) noexcept
+   {
+      return int_format::write_body(int_format::write_body(p, v.num()), v.denom());
+   }
+   static read_from_result read_body(const unsigned char* p, const unsigned char* last, unsigned char flags, backend_type& v)
+   {
+      int_type         num, denom;
+      read_from_result r = int_format::read_body(p, last, flags, num);
+      if (r.ec != std::errc())
+         return r;
+      r = int_format::read_body(r.ptr, last, 0, denom);
+      if (r.ec != std::errc())
+         return r;
+      if (denom.size() == 1 && !*denom.limbs())
+         return {r.ptr, std::errc::invalid_argument};
+      // Only fractions in lowest terms are valid, as they're the only ones write_body produces:
+      int_type g;
+      eval_gcd(g, num, denom);
+      if ((g.size() != 1) || (*g.limbs() != 1))
+         return {r.ptr, std::errc::invalid_argument};
+      v.num()   = std::move(num);
+      v.denom() = std::move(denom);
+      return r;
+   }
+};
+
+} // namespace detail
+
+//
+// The number of bytes which write_to uses for v:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline std::size_t binary_size(const number<Backend, ExpressionTemplates>& v) noexcept
+{
+   return 2 + detail::binary_format<Backend>::body_size(v.backend());
+}
+
+//
+// Writes v to [first, last) and returns a pointer past the last byte written, or
+// std::errc::value_too_large if it does not fit:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline write_to_result write_to(unsigned char* first, unsigned char* last, const number<Backend, ExpressionTemplates>& v) noexcept
+{
+   using format = detail::binary_format<Backend>;
+   if (static_cast<std::size_t>(last - first) < binary_size(v))
+      return {last, std::errc::value_too_large};
+   *first++ = detail::binary_format_version;
+   *first++ = static_cast<unsigned char>(format::kind | format::flags(v.backend()));
+   return {format::write_body(first, v.backend()), std::errc()};
+}
+
+//
+// Reads a value written by write_to from [first, last), returns a pointer past the bytes read,
+// std::errc::invalid_argument if the input is not a value of this kind in a supported version
+// of the format, or std::errc::result_out_of_range if the value doesn't fit in v.  On error v
+// is unchanged:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline read_from_result read_from(const unsigned char* first, const unsigned char* last, number<Backend, ExpressionTemplates>& v)
+{
+   using format = detail::binary_format<Backend>;
+   if ((last - first < 2) || (first[0] != detail::binary_format_version) || ((first[1] & 0x8F) != format::kind))
+      return {first, std::errc::invalid_argument};
+   return format::read_body(first + 2, last, first[1], v.backend());
+}
+
+#ifdef __cpp_lib_span
+template <class Backend, expression_template_option ExpressionTemplates>
+inline write_to_result write_to(std::span<std::byte> buffer, const number<Backend, ExpressionTemplates>& v) noexcept
+{
+   unsigned char* first = reinterpret_cast<unsigned char*>(buffer.data());
+   return write_to(first, first + buffer.size(), v);
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline read_from_result read_from(std::span<const std::byte> buffer, number<Backend, ExpressionTemplates>& v)
+{
+   const unsigned char* first = reinterpret_cast<const unsigned char*>(buffer.data());
+   return read_from(first, first + buffer.size(), v);
+}
+#endif
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_BINARY_FORMAT_HPP
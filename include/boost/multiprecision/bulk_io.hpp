@@ -0,0 +1,489 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_BULK_IO_HPP
+#define BOOST_MP_BULK_IO_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <boost/multiprecision/charconv.hpp>
+#include <boost/multiprecision/write_digits.hpp>
+#include <boost/multiprecision/detail/parallel.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+
+//
+// The least amount of text, in characters, given to each thread by parse_many:
+//
+#ifndef BOOST_MP_PARSE_MANY_MIN_CHARS
+#define BOOST_MP_PARSE_MANY_MIN_CHARS 16384
+#endif
+//
+// The length in decimal digits above which arbitrary precision cpp_int's are parsed by
+// divide and conquer, rather than a limb at a time:
+//
+#ifndef BOOST_MP_PARSE_MANY_LEAF_DIGITS
+#define BOOST_MP_PARSE_MANY_LEAF_DIGITS 1200
+#endif
+
+namespace boost {
+namespace multiprecision {
+
+struct parse_many_result
+{
+   const char* ptr;
+   std::errc   ec;
+   std::size_t count;
+};
+
+namespace detail {
+
+inline bool many_is_space(char c) noexcept
+{
+   return (c == ' ') || ((c >= '\t') && (c <= '\r'));
+}
+
+template <class Number>
+struct is_many_chars_type : public std::integral_constant<bool, (number_category<Number>::value == number_kind_integer) || (number_category<Number>::value == number_kind_floating_point)>
+{};
+template <class Number>
+struct is_many_unbounded_cpp_int : public std::integral_constant<bool, is_chars_cpp_int<typename Number::backend_type>::value && !is_chars_fixed_cpp_int<typename Number::backend_type>::value>
+{};
+
+//
+// Parses single values for parse_many, each thread has its own, along with any scratch
+// space it needs.  Types without from_chars are parsed by the backend from a null
+// terminated copy of the text:
+//
+template <class Number, class Enable = void>
+class many_parser
+{
+ public:
+   const char* parse(const char* first, const char* last, Number& v, std::errc& ec)
+   {
+      m_text.assign(first, last);
+      ec = std::errc();
+      BOOST_MP_TRY
+      {
+         v.backend() = m_text.c_str();
+      }
+      BOOST_MP_CATCH(const std::exception&)
+      {
+         ec = std::errc::invalid_argument;
+         return first;
+      }
+      BOOST_MP_CATCH_END
+      return last;
+   }
+
+ private:
+   std::string m_text;
+};
+
+template <class Number>
+class many_parser<Number, typename std::enable_if<is_many_chars_type<Number>::value && !is_many_unbounded_cpp_int<Number>::value>::type>
+{
+ public:
+   const char* parse(const char* first, const char* last, Number& v, std::errc& ec)
+   {
+      const from_chars_result r = from_chars(first, last, v);
+      ec                        = r.ec;
+      return r.ptr;
+   }
+};
+
+//
+// Arbitrary precision cpp_int's accumulate their limbs in a scratch vector, which is then
+// copied to the result, so that there are no temporaries per value.  Long values are split
+// in two at the power of 10 which is 10^(block digits * 2^j), with both halves parsed in the
+// same way and then recombined with one multiplication, which makes use of Karatsuba
+// multiplication.  The powers of 10 and the upper halves at each level of the recursion are
+// kept for the next value:
+//
+template <class Number>
+class many_parser<Number, typename std::enable_if<is_many_unbounded_cpp_int<Number>::value>::type>
+{
+ public:
+   many_parser() : m_block(chars_block_digits(10, (std::numeric_limits<limb_type>::max)())) {}
+
+   const char* parse(const char* first, const char* last, Number& v, std::errc& ec)
+   {
+      const char* p   = first;
+      bool        neg = false;
+      BOOST_IF_CONSTEXPR(std::numeric_limits<Number>::is_signed)
+      {
+         if ((p != last) && (*p == '-'))
+         {
+            neg = true;
+            ++p;
+         }
+      }
+      const char* q = p;
+      while ((q != last) && (static_cast<unsigned char>(*q - '0') < 10))
+         ++q;
+      if (q == p)
+      {
+         ec = std::errc::invalid_argument;
+         return first;
+      }
+      ec = std::errc();
+      parse_digits(p, static_cast<std::size_t>(q - p), v, 0);
+      v.backend().sign(neg);
+      return q;
+   }
+
+ private:
+   void parse_digits(const char* p, std::size_t len, Number& r, std::size_t depth)
+   {
+      if (len <= BOOST_MP_PARSE_MANY_LEAF_DIGITS)
+      {
+         constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+         const char*           last      = p + len;
+         limb_type             chunk, mult;
+         m_acc.assign(1, 0);
+         for (const char* q; (q = chars_read_block(p, last, 10, m_block, chunk, mult)) != p; p = q)
+         {
+            double_limb_type carry = chunk;
+            for (limb_type& a : m_acc)
+            {
+               carry += static_cast<double_limb_type>(a) * mult;
+               a = static_cast<limb_type>(carry);
+               carry >>= limb_bits;
+            }
+            if (carry)
+               m_acc.push_back(static_cast<limb_type>(carry));
+         }
+         from_chars_assign_limbs(r.backend(), m_acc.data(), m_acc.size(), std::integral_constant<bool, false>());
+         r.backend().sign(false);
+         return;
+      }
+      //
+      // Split off the low k digits, with k < len <= 2k:
+      //
+      std::size_t k = m_block, j = 0;
+      while (2 * k < len)
+      {
+         k *= 2;
+         ++j;
+      }
+      if (m_pow10.empty())
+         m_pow10.push_back(pow(Number(10), static_cast<unsigned>(m_block)));
+      while (m_pow10.size() <= j)
+         m_pow10.push_back(Number(m_pow10.back() * m_pow10.back()));
+      if (m_high.size() <= depth)
+         m_high.resize(std::max<std::size_t>(depth + 1, 64));
+      Number& high = m_high[depth];
+      parse_digits(p, len - k, high, depth + 1);
+      parse_digits(p + (len - k), k, r, depth + 1);
+      high *= m_pow10[j];
+      r += high;
+   }
+
+   unsigned               m_block;
+   std::vector<limb_type> m_acc;
+   std::vector<Number>    m_pow10;
+   std::vector<Number>    m_high;
+};
+
+//
+// Formats single values for format_many.  Integers are written in base 10, floating point
+// values as by to_chars with the options given, and other types with str():
+//
+struct many_format_options
+{
+   bool         shortest;
+   bool         plain;
+   chars_format fmt;
+   int          precision;
+};
+
+template <class Number, int Category = number_category<Number>::value>
+class many_formatter
+{
+ public:
+   explicit many_formatter(const many_format_options&) {}
+
+   std::size_t size_hint(const Number&) const { return 64; }
+
+   to_chars_result format(char* first, char* last, const Number& v)
+   {
+      m_text = v.str();
+      if (static_cast<std::size_t>(last - first) < m_text.size())
+         return {last, std::errc::value_too_large};
+      std::memcpy(first, m_text.data(), m_text.size());
+      return {first + m_text.size(), std::errc()};
+   }
+
+ private:
+   std::string m_text;
+};
+
+template <class Number>
+class many_formatter<Number, number_kind_integer>
+{
+ public:
+   explicit many_formatter(const many_format_options&) {}
+
+   std::size_t size_hint(const Number& v) const
+   {
+      return size_hint(v, std::integral_constant<bool, is_chars_cpp_int<typename Number::backend_type>::value>());
+   }
+
+   to_chars_result format(char* first, char* last, const Number& v)
+   {
+      return format(first, last, v, std::integral_constant<bool, is_many_unbounded_cpp_int<Number>::value>());
+   }
+
+ private:
+   to_chars_result format(char* first, char* last, const Number& v, const std::integral_constant<bool, false>&)
+   {
+      return to_chars(first, last, v);
+   }
+   //
+   // to_chars divides out a block of digits at a time, which is quadratic in the length of
+   // the value, so long values use write_digits' divide and conquer, when there is
+   // certainly room for them:
+   //
+   to_chars_result format(char* first, char* last, const Number& v, const std::integral_constant<bool, true>&)
+   {
+      if ((v.backend().size() > BOOST_MP_WRITE_DIGITS_LEAF_LIMBS) && (static_cast<std::size_t>(last - first) >= size_hint(v)))
+         return {write_digits(first, v), std::errc()};
+      return to_chars(first, last, v);
+   }
+   std::size_t size_hint(const Number& v, const std::integral_constant<bool, true>&) const
+   {
+      // 30103 / 100000 > log10(2), plus room for the sign:
+      return v.backend().size() * sizeof(limb_type) * CHAR_BIT * 30103u / 100000u + 3;
+   }
+   std::size_t size_hint(const Number&, const std::integral_constant<bool, false>&) const
+   {
+      return 64;
+   }
+};
+
+template <class Number>
+class many_formatter<Number, number_kind_floating_point>
+{
+ public:
+   explicit many_formatter(const many_format_options& options) : m_options(options) {}
+
+   std::size_t size_hint(const Number&) const
+   {
+      return static_cast<std::size_t>((std::max)(m_options.precision, std::numeric_limits<Number>::max_digits10)) + 32;
+   }
+
+   to_chars_result format(char* first, char* last, const Number& v)
+   {
+      if (!m_options.shortest)
+         return to_chars(first, last, v, m_options.fmt, m_options.precision);
+      if (m_options.plain)
+         return to_chars(first, last, v);
+      return to_chars(first, last, v, m_options.fmt);
+   }
+
+ private:
+   many_format_options m_options;
+};
+
+//
+// Appends the values [v, v + n) to buf, each followed by a newline, growing buf as needed:
+//
+template <class Number>
+void format_many_append(std::string& buf, const Number* v, std::size_t n, many_formatter<Number>& f)
+{
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      const std::size_t pos  = buf.size();
+      std::size_t       room = f.size_hint(v[i]);
+      for (;;)
+      {
+         buf.resize(pos + room);
+         const to_chars_result r = f.format(&buf[pos], &buf[0] + buf.size(), v[i]);
+         if (r.ec == std::errc())
+         {
+            buf.resize(static_cast<std::size_t>(r.ptr - &buf[0]));
+            buf.push_back('\n');
+            break;
+         }
+         room *= 4;
+      }
+   }
+}
+
+template <class Number>
+to_chars_result format_many_imp(char* first, char* last, const Number* v, std::size_t n, std::size_t threads, const many_format_options& options)
+{
+   const std::size_t pieces = (std::max<std::size_t>)(1u, (std::min)(threads, n));
+   if (pieces == 1)
+   {
+      // Straight into the output:
+      many_formatter<Number> f(options);
+      char*                  p = first;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         const to_chars_result r = f.format(p, last, v[i]);
+         if ((r.ec != std::errc()) || (r.ptr == last))
+            return {last, std::errc::value_too_large};
+         p    = r.ptr;
+         *p++ = '\n';
+      }
+      return {p, std::errc()};
+   }
+   //
+   // Each thread formats its share of the values into its own buffer, then once their
+   // sizes, and hence positions in the output, are known, copies it into place:
+   //
+   std::vector<std::string> buffers(pieces);
+   parallel_for(0, pieces, pieces, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+         const std::size_t      first_value = n * i / pieces;
+         many_formatter<Number> f(options);
+         format_many_append(buffers[i], v + first_value, n * (i + 1) / pieces - first_value, f);
+      }
+   });
+   std::vector<std::size_t> offsets(pieces + 1, 0);
+   for (std::size_t i = 0; i < pieces; ++i)
+      offsets[i + 1] = offsets[i] + buffers[i].size();
+   if (offsets[pieces] > static_cast<std::size_t>(last - first))
+      return {last, std::errc::value_too_large};
+   parallel_for(0, pieces, pieces, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+         std::memcpy(first + offsets[i], buffers[i].data(), buffers[i].size());
+   });
+   return {first + offsets[pieces], std::errc()};
+}
+
+} // namespace detail
+
+//
+// Parses up to n whitespace separated values from [first, last) into out[0, n), with the
+// text split between up to "threads" threads at whitespace.  Integers are read in base 10,
+// and floating point values in chars_format::general, as by from_chars, and other types
+// as by their string constructors.  Returns the number of values read, and either the end
+// of the last one, or the start of the first which could not be parsed and the reason.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+parse_many_result parse_many(const char* first, const char* last, number<Backend, ExpressionTemplates>* out, std::size_t n, std::size_t threads = 1)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   const std::size_t len    = static_cast<std::size_t>(last - first);
+   const std::size_t pieces = (std::max<std::size_t>)(1u, (std::min)(threads, len / BOOST_MP_PARSE_MANY_MIN_CHARS));
+
+   std::vector<const char*> bounds(pieces + 1, last);
+   bounds[0] = first;
+   for (std::size_t i = 1; i < pieces; ++i)
+   {
+      const char* p = (std::max)(first + len / pieces * i, bounds[i - 1]);
+      while ((p != last) && !detail::many_is_space(*p))
+         ++p;
+      bounds[i] = p;
+   }
+   //
+   // With more than one piece, the index of the first value in each is found by counting
+   // the values in those before it:
+   //
+   std::vector<std::size_t> base(pieces + 1, 0);
+   if (pieces > 1)
+   {
+      detail::parallel_for(0, pieces, pieces, [&](std::size_t begin, std::size_t end) {
+         for (std::size_t i = begin; i < end; ++i)
+         {
+            std::size_t count = 0;
+            bool        space = true;
+            for (const char* p = bounds[i]; p != bounds[i + 1]; ++p)
+            {
+               const bool s = detail::many_is_space(*p);
+               count += space && !s;
+               space = s;
+            }
+            base[i + 1] = count;
+         }
+      });
+      for (std::size_t i = 1; i <= pieces; ++i)
+         base[i] += base[i - 1];
+   }
+
+   std::vector<parse_many_result> results(pieces);
+   detail::parallel_for(0, pieces, pieces, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+         detail::many_parser<number_type> parser;
+         parse_many_result&               result = results[i];
+         const char*                      p      = bounds[i];
+         const char* const                stop   = bounds[i + 1];
+         result                                  = {p, std::errc(), 0};
+         for (std::size_t index = base[i]; index < n; ++index)
+         {
+            while ((p != stop) && detail::many_is_space(*p))
+               ++p;
+            if (p == stop)
+               break;
+            const char* q = p;
+            while ((q != stop) && !detail::many_is_space(*q))
+               ++q;
+            std::errc ec = std::errc();
+            if ((parser.parse(p, q, out[index], ec) != q) || (ec != std::errc()))
+            {
+               result.ptr = p;
+               result.ec  = ec == std::errc() ? std::errc::invalid_argument : ec;
+               break;
+            }
+            result.ptr = p = q;
+            ++result.count;
+         }
+      }
+   });
+
+   parse_many_result result = {first, std::errc(), 0};
+   for (const parse_many_result& r : results)
+   {
+      result.count += r.count;
+      if (r.ec != std::errc())
+      {
+         result.ptr = r.ptr;
+         result.ec  = r.ec;
+         break;
+      }
+      if (r.count)
+         result.ptr = r.ptr;
+   }
+   return result;
+}
+
+//
+// Writes the values [v, v + n) to [first, last), each followed by a newline, with the
+// values split between up to "threads" threads.  Integers are written in base 10, and
+// floating point values by to_chars with the format and precision given, or as the
+// shortest strings which read back to the same values when there is no precision, or it's
+// negative.  Other types are written by str().  Returns the end of the text written, or
+// {last, std::errc::value_too_large} if it doesn't fit.  As with to_chars, the contents
+// of [ptr, last) are unspecified afterwards.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+to_chars_result format_many(char* first, char* last, const number<Backend, ExpressionTemplates>* v, std::size_t n, std::size_t threads = 1)
+{
+   const detail::many_format_options options = {true, true, chars_format::general, -1};
+   return detail::format_many_imp(first, last, v, n, threads, options);
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_floating_point, to_chars_result>::type
+format_many(char* first, char* last, const number<Backend, ExpressionTemplates>* v, std::size_t n, chars_format fmt, int precision = -1, std::size_t threads = 1)
+{
+   const detail::many_format_options options = {precision < 0, false, fmt, precision};
+   return detail::format_many_imp(first, last, v, n, threads, options);
+}
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_BULK_IO_HPP
@@ -0,0 +1,1362 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_CHARCONV_HPP
+#define BOOST_MP_CHARCONV_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/detail/digit_writer.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace backends {
+
+template <typename FloatingPointType>
+class cpp_double_fp_backend;
+
+} // namespace backends
+
+//
+// Counterparts of the C++17 <charconv> types, which are not available in C++11/14:
+//
+enum class chars_format
+{
+   scientific = 1,
+   fixed      = 2,
+   general    = fixed | scientific
+};
+
+struct to_chars_result
+{
+   char*     ptr;
+   std::errc ec;
+};
+
+struct from_chars_result
+{
+   const char* ptr;
+   std::errc   ec;
+};
+
+namespace detail {
+
+inline char chars_digit(unsigned d) noexcept
+{
+   return "0123456789abcdefghijklmnopqrstuvwxyz"[d];
+}
+
+inline unsigned chars_digit_value(char c) noexcept
+{
+   unsigned d = static_cast<unsigned char>(c - '0');
+   if (d < 10)
+      return d;
+   d = static_cast<unsigned char>((c | 0x20) - 'a');
+   return d < 26 ? d + 10 : 36;
+}
+
+//
+// The largest power of base which is no greater than limit, and the number of digits it
+// holds.  Formatting divides 32 bits at a time which keeps the divisions within 64 bit
+// arithmetic, parsing multiplies by whole limbs:
+//
+constexpr std::uint64_t chars_block(unsigned base, std::uint64_t limit = 0xFFFFFFFFu, std::uint64_t block = 1) noexcept
+{
+   return block > limit / base ? block : chars_block(base, limit, block * base);
+}
+constexpr unsigned chars_block_digits(unsigned base, std::uint64_t limit = 0xFFFFFFFFu, std::uint64_t block = 1, unsigned digits = 0) noexcept
+{
+   return block > limit / base ? digits : chars_block_digits(base, limit, block * base, digits + 1);
+}
+
+//
+// Divides the n limb magnitude at p by block in place and returns the remainder,
+// Base is either the base, or zero when it's only known at runtime:
+//
+template <unsigned Base>
+inline std::uint32_t chars_divide_block(limb_type* p, std::size_t n, unsigned base) noexcept
+{
+   constexpr std::uint64_t static_block = Base ? chars_block(Base) : 1;
+   const std::uint64_t     block        = Base ? static_block : chars_block(base);
+   std::uint64_t           r            = 0;
+   for (std::size_t i = n; i-- > 0;)
+   {
+      const limb_type l = p[i];
+      std::uint64_t   q = 0;
+      for (unsigned h = sizeof(limb_type) * CHAR_BIT; h > 0; h -= 32)
+      {
+         r = (r << 32) | ((l >> (h - 32)) & 0xFFFFFFFFu);
+         q = (q << 32) | (r / block);
+         r %= block;
+      }
+      p[i] = static_cast<limb_type>(q);
+   }
+   return static_cast<std::uint32_t>(r);
+}
+
+template <unsigned Base>
+inline char* chars_write_limbs_backwards(char* first, char* pos, limb_type* p, std::size_t n, unsigned base) noexcept
+{
+   const unsigned b            = Base ? Base : base;
+   const unsigned block_digits = chars_block_digits(b);
+   while (n)
+   {
+      std::uint32_t rem = chars_divide_block<Base>(p, n, base);
+      while (n && !p[n - 1])
+         --n;
+      BOOST_IF_CONSTEXPR(Base == 10)
+      {
+         // Two digits at a time:
+         static const char pairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                     "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                     "8081828384858687888990919293949596979899";
+         for (unsigned i = 0; n ? i + 1 < block_digits : rem >= 10; i += 2)
+         {
+            if (pos - first < 2)
+               return nullptr;
+            pos -= 2;
+            std::memcpy(pos, pairs + 2 * (rem % 100), 2);
+            rem /= 100;
+         }
+         if (n || rem)
+         {
+            if (pos == first)
+               return nullptr;
+            *--pos = static_cast<char>('0' + rem);
+         }
+      }
+      else
+      {
+         for (unsigned i = 0; n ? i < block_digits : rem != 0; ++i)
+         {
+            if (pos == first)
+               return nullptr;
+            *--pos = chars_digit(static_cast<unsigned>(rem % b));
+            rem /= b;
+         }
+      }
+   }
+   return pos;
+}
+
+//
+// Writes the digits of the n limb magnitude at p to [first, last), the magnitude is
+// destroyed in the process.  Returns the end of the digits, or nullptr if they don't fit:
+//
+inline char* chars_write_limbs(char* first, char* last, limb_type* p, std::size_t n, unsigned base) noexcept
+{
+   constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+   while (n && !p[n - 1])
+      --n;
+   if (!n)
+   {
+      if (first == last)
+         return nullptr;
+      *first = '0';
+      return first + 1;
+   }
+   if ((base & (base - 1)) == 0)
+   {
+      // Power of 2 bases read the digits straight out of the bits:
+      const unsigned    shift = boost::multiprecision::detail::find_msb(base);
+      const std::size_t bits  = (n - 1) * limb_bits + boost::multiprecision::detail::find_msb(p[n - 1]) + 1;
+      const std::size_t count = (bits + shift - 1) / shift;
+      if (count > static_cast<std::size_t>(last - first))
+         return nullptr;
+      for (std::size_t i = 0, bit = 0; i < count; ++i, bit += shift)
+      {
+         const std::size_t limb = bit / limb_bits, offset = bit % limb_bits;
+         limb_type         d    = p[limb] >> offset;
+         if ((offset + shift > limb_bits) && (limb + 1 < n))
+            d |= p[limb + 1] << (limb_bits - offset);
+         first[count - 1 - i] = chars_digit(static_cast<unsigned>(d & (base - 1)));
+      }
+      return first + count;
+   }
+   char* pos = base == 10 ? chars_write_limbs_backwards<10>(first, last, p, n, base) : chars_write_limbs_backwards<0>(first, last, p, n, base);
+   if (!pos)
+      return nullptr;
+   const std::size_t count = static_cast<std::size_t>(last - pos);
+   std::memmove(first, pos, count);
+   return first + count;
+}
+
+inline to_chars_result chars_write_signed(char* first, char* last, bool neg, limb_type* p, std::size_t n, unsigned base) noexcept
+{
+   if (neg)
+   {
+      if (first == last)
+         return {last, std::errc::value_too_large};
+      *first++ = '-';
+   }
+   char* r = chars_write_limbs(first, last, p, n, base);
+   if (!r)
+      return {last, std::errc::value_too_large};
+   return {r, std::errc()};
+}
+
+template <class Backend>
+struct is_chars_cpp_int : public std::integral_constant<bool, false>
+{};
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+struct is_chars_cpp_int<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> > : public std::integral_constant<bool, true>
+{};
+
+//
+// The bits of a trivial cpp_int's value above the first limb_type, which are present only
+// when its limb is wider than limb_type (an unsigned __int128 for example):
+//
+template <class T>
+inline limb_type chars_high_limb(const T& v, const std::integral_constant<bool, true>&) noexcept
+{
+   return static_cast<limb_type>(v >> (sizeof(limb_type) * CHAR_BIT));
+}
+template <class T>
+inline limb_type chars_high_limb(const T&, const std::integral_constant<bool, false>&) noexcept
+{
+   return 0;
+}
+template <class T>
+inline T chars_from_high_limb(const limb_type* acc, const std::integral_constant<bool, true>&) noexcept
+{
+   return static_cast<T>(static_cast<T>(acc[1]) << (sizeof(limb_type) * CHAR_BIT));
+}
+template <class T>
+inline T chars_from_high_limb(const limb_type*, const std::integral_constant<bool, false>&) noexcept
+{
+   return 0;
+}
+
+//
+// Integer formatting, cpp_int's are formatted from a copy of their limbs, which lives on
+// the stack unless the value is an unusually large arbitrary precision one:
+//
+template <class Backend>
+inline to_chars_result to_chars_integer(char* first, char* last, const Backend& b, unsigned base, const std::integral_constant<bool, true>&, const std::integral_constant<bool, true>&)
+{
+   // Trivial cpp_int:
+   using local_limb_type = typename std::remove_cv<typename std::remove_pointer<decltype(b.limbs())>::type>::type;
+   using wide_tag        = std::integral_constant<bool, (sizeof(local_limb_type) > sizeof(limb_type))>;
+   const local_limb_type v         = *b.limbs();
+   limb_type             buffer[2] = {static_cast<limb_type>(v), chars_high_limb(v, wide_tag())};
+   return chars_write_signed(first, last, b.sign() && v, buffer, 2, base);
+}
+template <class Backend>
+inline to_chars_result to_chars_integer(char* first, char* last, const Backend& b, unsigned base, const std::integral_constant<bool, true>&, const std::integral_constant<bool, false>&)
+{
+   constexpr std::size_t  stack_limbs = backends::is_fixed_precision<Backend>::value ? Backend::internal_limb_count : 64;
+   limb_type              buffer[stack_limbs];
+   std::vector<limb_type> heap;
+   const std::size_t      n = b.size();
+   limb_type*             p = buffer;
+   if (n > stack_limbs)
+   {
+      heap.assign(b.limbs(), b.limbs() + n);
+      p = heap.data();
+   }
+   else
+      std::copy(b.limbs(), b.limbs() + n, buffer);
+   return chars_write_signed(first, last, b.sign(), p, n, base);
+}
+template <class Number, class Tag>
+inline to_chars_result to_chars_integer(char* first, char* last, const Number& v, unsigned base, const std::integral_constant<bool, false>&, const Tag&)
+{
+   // Any other integer type, divide a block of digits at a time:
+   using value_type      = typename Number::value_type;
+   const limb_type block = static_cast<limb_type>(chars_block(base));
+   value_type      t     = v;
+   bool            neg   = t < 0;
+   char*           pos   = last;
+   if (neg)
+   {
+      t = value_type(0) - t;
+      if (first == last)
+         return {last, std::errc::value_too_large};
+      *first++ = '-';
+   }
+   do
+   {
+      limb_type rem = integer_modulus(t, block);
+      t /= block;
+      for (unsigned i = 0; t != 0 ? i < chars_block_digits(base) : (rem != 0) || (pos == last); ++i)
+      {
+         if (pos == first)
+            return {last, std::errc::value_too_large};
+         *--pos = chars_digit(static_cast<unsigned>(rem % base));
+         rem /= base;
+      }
+   } while (t != 0);
+   const std::size_t count = static_cast<std::size_t>(last - pos);
+   std::memmove(first, pos, count);
+   return {first + count, std::errc()};
+}
+
+//
+// Stores the limbs of a parsed fixed precision cpp_int:
+//
+template <class Backend>
+inline void from_chars_assign_limbs(Backend& b, const limb_type* acc, std::size_t, const std::integral_constant<bool, true>&)
+{
+   // Trivial cpp_int, at most 2 limbs:
+   using local_limb_type = typename std::remove_pointer<decltype(b.limbs())>::type;
+   using wide_tag        = std::integral_constant<bool, (sizeof(local_limb_type) > sizeof(limb_type))>;
+   *b.limbs()            = static_cast<local_limb_type>(static_cast<local_limb_type>(acc[0]) | chars_from_high_limb<local_limb_type>(acc, wide_tag()));
+}
+template <class Backend>
+inline void from_chars_assign_limbs(Backend& b, const limb_type* acc, std::size_t n, const std::integral_constant<bool, false>&)
+{
+   b.resize(n, n);
+   std::copy(acc, acc + n, b.limbs());
+   b.normalize();
+}
+
+//
+// Reads up to count digits from [p, last) into chunk, and sets mult to base^(digits read).
+// Returns the end of the digits:
+//
+inline const char* chars_read_block(const char* p, const char* last, unsigned base, unsigned count, limb_type& chunk, limb_type& mult) noexcept
+{
+   chunk = 0;
+   mult  = 1;
+   if (base == 10)
+   {
+      for (unsigned d; count && (p != last) && ((d = static_cast<unsigned char>(*p - '0')) < 10); --count, ++p)
+      {
+         chunk = chunk * 10 + d;
+         mult *= 10;
+      }
+      return p;
+   }
+   for (unsigned d; count && (p != last) && ((d = chars_digit_value(*p)) < base); --count, ++p)
+   {
+      chunk = chunk * base + d;
+      mult *= base;
+   }
+   return p;
+}
+
+//
+// Parses the digits at [p, last), returning their end.  result is unchanged if there are
+// no digits, or if the value is out of range in which case overflow is set.  Fixed precision cpp_int's accumulate
+// into a limb array on the stack:
+//
+template <class Number>
+inline const char* from_chars_integer(const char* p, const char* last, Number& result, unsigned base, bool neg, bool& overflow, const std::integral_constant<bool, true>&)
+{
+   using backend_type               = typename Number::backend_type;
+   constexpr std::size_t limb_bits  = sizeof(limb_type) * CHAR_BIT;
+   constexpr std::size_t max_bits   = backends::max_precision<backend_type>::value;
+   constexpr std::size_t limb_count = max_bits / limb_bits + (max_bits % limb_bits ? 1 : 0);
+   constexpr unsigned    top_bits   = max_bits % limb_bits;
+   const unsigned        block_dig  = chars_block_digits(base, (std::numeric_limits<limb_type>::max)());
+
+   limb_type   acc[limb_count] = {0};
+   std::size_t used            = 0;
+   limb_type   chunk, mult;
+   const char* start = p;
+   overflow          = false;
+   for (const char* q; (q = chars_read_block(p, last, base, block_dig, chunk, mult)) != p; p = q)
+   {
+      if (overflow)
+         continue;
+      double_limb_type carry = chunk;
+      for (std::size_t i = 0; i < used; ++i)
+      {
+         carry += static_cast<double_limb_type>(acc[i]) * mult;
+         acc[i] = static_cast<limb_type>(carry);
+         carry >>= limb_bits;
+      }
+      if (carry)
+      {
+         if (used == limb_count)
+            overflow = true;
+         else
+            acc[used++] = static_cast<limb_type>(carry);
+      }
+      BOOST_IF_CONSTEXPR(top_bits != 0)
+      {
+         if ((used == limb_count) && (acc[limb_count - 1] >> top_bits))
+            overflow = true;
+      }
+   }
+   if (!overflow && (p != start))
+   {
+      from_chars_assign_limbs(result.backend(), acc, used ? used : 1, std::integral_constant<bool, backends::is_trivial_cpp_int<backend_type>::value>());
+      result.backend().sign(neg && used);
+   }
+   return p;
+}
+template <class Number>
+inline const char* from_chars_integer(const char* p, const char* last, Number& result, unsigned base, bool neg, bool& overflow, const std::integral_constant<bool, false>&)
+{
+   // Any other integer type, arbitrary precision cpp_int included:
+   using value_type         = typename Number::value_type;
+   const unsigned block_dig = chars_block_digits(base, (std::numeric_limits<limb_type>::max)());
+   value_type     t(0);
+   limb_type      chunk, mult;
+   const char*    start = p;
+   overflow             = false;
+   for (const char* q; (q = chars_read_block(p, last, base, block_dig, chunk, mult)) != p; p = q)
+   {
+      if (overflow)
+         continue;
+      BOOST_IF_CONSTEXPR(std::numeric_limits<value_type>::is_bounded)
+      {
+         if (t > value_type((std::numeric_limits<value_type>::max)() - chunk) / mult)
+         {
+            overflow = true;
+            continue;
+         }
+      }
+      t *= mult;
+      t += chunk;
+   }
+   if (!overflow && (p != start))
+   {
+      if (neg)
+         t = value_type(0) - t;
+      result = std::move(t);
+   }
+   return p;
+}
+
+template <class Backend>
+struct is_chars_fixed_cpp_int : public std::integral_constant<bool, false>
+{};
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+struct is_chars_fixed_cpp_int<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >
+    : public backends::is_fixed_precision<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >
+{};
+
+//
+// Floating point layout: the significant digits are [d, d + nd), with the first at
+// 10^exp10, missing digits are zeros.  frac is the number of digits after the point.
+//
+inline to_chars_result chars_layout_fixed(char* first, char* last, bool neg, const char* d, std::ptrdiff_t nd, std::ptrdiff_t exp10, std::ptrdiff_t frac) noexcept
+{
+   const std::ptrdiff_t size = neg + (exp10 >= 0 ? exp10 + 1 : 1) + (frac ? frac + 1 : 0);
+   if (size > last - first)
+      return {last, std::errc::value_too_large};
+   if (neg)
+      *first++ = '-';
+   if (exp10 < 0)
+      *first++ = '0';
+   for (std::ptrdiff_t i = 0; i <= exp10; ++i)
+      *first++ = i < nd ? d[i] : '0';
+   if (frac)
+   {
+      *first++ = '.';
+      for (std::ptrdiff_t i = exp10 + 1; i <= exp10 + frac; ++i)
+         *first++ = (i >= 0) && (i < nd) ? d[i] : '0';
+   }
+   return {first, std::errc()};
+}
+
+inline to_chars_result chars_layout_scientific(char* first, char* last, bool neg, const char* d, std::ptrdiff_t nd, std::ptrdiff_t exp10, std::ptrdiff_t frac) noexcept
+{
+   char           exponent[24];
+   char*          pos = exponent + sizeof(exponent);
+   std::uintmax_t e   = exp10 < 0 ? 0u - static_cast<std::uintmax_t>(exp10) : static_cast<std::uintmax_t>(exp10);
+   do
+   {
+      *--pos = static_cast<char>('0' + e % 10);
+      e /= 10;
+   } while (e || (exponent + sizeof(exponent) - pos < BOOST_MP_MIN_EXPONENT_DIGITS));
+   const std::ptrdiff_t exp_size = exponent + sizeof(exponent) - pos;
+   const std::ptrdiff_t size     = neg + 1 + (frac ? frac + 1 : 0) + 2 + exp_size;
+   if (size > last - first)
+      return {last, std::errc::value_too_large};
+   if (neg)
+      *first++ = '-';
+   *first++ = d[0];
+   if (frac)
+   {
+      *first++ = '.';
+      for (std::ptrdiff_t i = 1; i <= frac; ++i)
+         *first++ = i < nd ? d[i] : '0';
+   }
+   *first++ = 'e';
+   *first++ = exp10 < 0 ? '-' : '+';
+   std::memcpy(first, pos, static_cast<std::size_t>(exp_size));
+   return {first + exp_size, std::errc()};
+}
+
+//
+// Lays out P significant digits in %g style, trailing zeros removed:
+//
+inline to_chars_result chars_layout_general(char* first, char* last, bool neg, const char* d, std::ptrdiff_t nd, std::ptrdiff_t exp10, std::ptrdiff_t P) noexcept
+{
+   while ((nd > 1) && (d[nd - 1] == '0'))
+      --nd;
+   if ((exp10 >= -4) && (exp10 < P))
+      return chars_layout_fixed(first, last, neg, d, nd, exp10, (std::max)(std::ptrdiff_t(0), nd - 1 - exp10));
+   return chars_layout_scientific(first, last, neg, d, nd, exp10, nd - 1);
+}
+
+inline to_chars_result chars_special(char* first, char* last, bool neg, const char* s) noexcept
+{
+   const std::size_t len = std::strlen(s);
+   if (neg + len > static_cast<std::size_t>(last - first))
+      return {last, std::errc::value_too_large};
+   if (neg)
+      *first++ = '-';
+   std::memcpy(first, s, len);
+   return {first + len, std::errc()};
+}
+
+inline to_chars_result chars_zero(char* first, char* last, bool neg, chars_format fmt, int precision) noexcept
+{
+   const char zero = '0';
+   switch (fmt)
+   {
+   case chars_format::fixed:
+      return chars_layout_fixed(first, last, neg, &zero, 1, 0, precision);
+   case chars_format::scientific:
+      return chars_layout_scientific(first, last, neg, &zero, 1, 0, precision);
+   default:
+      return chars_layout_fixed(first, last, neg, &zero, 1, 0, 0);
+   }
+}
+
+//
+// Splits the output of str() into its sign, significant digits, and the exponent of the
+// first digit, returns false if the value is zero:
+//
+inline bool chars_split_str(const std::string& s, bool& neg, std::string& digits, std::ptrdiff_t& exp10)
+{
+   std::string::size_type i     = 0;
+   std::ptrdiff_t         point = -1, count = 0;
+   neg                          = s[0] == '-';
+   exp10                        = 0;
+   if (neg)
+      ++i;
+   for (; (i < s.size()) && (s[i] != 'e'); ++i)
+   {
+      if (s[i] == '.')
+         point = count;
+      else if (digits.size() || (s[i] != '0'))
+      {
+         digits.push_back(s[i]);
+         ++count;
+      }
+      else if (point >= 0)
+         --exp10;
+   }
+   if (digits.empty())
+      return false;
+   exp10 += (point >= 0 ? point : count) - 1;
+   if (i < s.size())
+      exp10 += std::atol(s.c_str() + i + 1);
+   return true;
+}
+
+//
+// Generic floating point formatting, via the backend's str() whose output is re-parsed
+// into significant digits and an exponent, then laid out as above:
+//
+template <class Number>
+inline to_chars_result to_chars_float_generic(char* first, char* last, const Number& v, chars_format fmt, int precision)
+{
+   if (fmt == chars_format::fixed)
+   {
+      std::string s = v.str(precision, std::ios_base::fixed);
+      if (s.size() > static_cast<std::size_t>(last - first))
+         return {last, std::errc::value_too_large};
+      std::memcpy(first, s.data(), s.size());
+      return {first + s.size(), std::errc()};
+   }
+   const std::ptrdiff_t P = fmt == chars_format::scientific ? precision + 1 : (std::max)(precision, 1);
+   std::string          digits;
+   std::ptrdiff_t       exp10;
+   bool                 neg;
+   if (!chars_split_str(P > 1 ? v.str(P - 1, std::ios_base::scientific) : v.str(1, std::ios_base::fmtflags(0)), neg, digits, exp10))
+      return chars_zero(first, last, neg, fmt, precision);
+   if (fmt == chars_format::scientific)
+      return chars_layout_scientific(first, last, neg, digits.data(), static_cast<std::ptrdiff_t>(digits.size()), exp10, precision);
+   return chars_layout_general(first, last, neg, digits.data(), static_cast<std::ptrdiff_t>(digits.size()), exp10, P);
+}
+
+//
+// Exact decimal digits of a cpp_bin_float, computed in a fixed precision integer type on
+// the stack which has room for every exponent a double has, and more besides:
+//
+template <class Float>
+struct chars_float_work
+{
+   static constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+   static constexpr std::size_t bits      = ((2 * Float::bit_count + 2560) / limb_bits + 1) * limb_bits;
+   static constexpr std::size_t limbs     = bits / limb_bits;
+   static constexpr std::size_t max_chars = bits * 3 / 10 + 2;
+   using type                             = number<backends::cpp_int_backend<bits, bits, unsigned_magnitude, unchecked, void>, et_off>;
+};
+
+//
+// Multiplies n by 5^s, a limb at a time:
+//
+template <class Integer>
+inline void chars_multiply_pow5(Integer& n, std::uintmax_t s)
+{
+   constexpr unsigned step = sizeof(limb_type) * CHAR_BIT >= 64 ? 27 : 13;
+   constexpr limb_type pow5_step = sizeof(limb_type) * CHAR_BIT >= 64 ? static_cast<limb_type>(7450580596923828125uLL) : static_cast<limb_type>(1220703125u);
+   for (; s >= step; s -= step)
+      n *= pow5_step;
+   limb_type m = 1;
+   while (s--)
+      m *= 5;
+   n *= m;
+}
+
+//
+// Writes the digits of round-half-even(|v| * 10^s) to buf, returning how many there are,
+// or zero when the calculation doesn't fit in the work type:
+//
+template <class Float>
+inline std::ptrdiff_t chars_float_digits(const Float& v, std::intmax_t s, char* buf)
+{
+   using work          = chars_float_work<Float>;
+   using work_type     = typename work::type;
+   std::intmax_t a     = static_cast<std::intmax_t>(v.exponent()) - static_cast<std::intmax_t>(Float::bit_count - 1) + s;
+   double        pow5  = 2.33 * static_cast<double>(s < 0 ? -s : s) + 1;
+   double        nbits = Float::bit_count + (s > 0 ? pow5 : 0) + (a > 0 ? a : 0);
+   double        dbits = (s < 0 ? pow5 : 0) + (a < 0 ? -a : 0);
+   if ((std::max)(nbits, dbits) + 2 * work::limb_bits > work::bits)
+      return 0;
+
+   work_type n, q;
+   n.backend() = v.bits();
+   if (s > 0)
+      chars_multiply_pow5(n, static_cast<std::uintmax_t>(s));
+   if (a > 0)
+      n <<= static_cast<unsigned>(a);
+   if (s >= 0)
+   {
+      if (a < 0)
+      {
+         // Division by a power of 2 is a shift:
+         const unsigned shift = static_cast<unsigned>(-a);
+         bool           round = shift <= msb(n) + 1 ? bit_test(n, shift - 1) : false;
+         bool           tail  = round && (lsb(n) + 1 < shift);
+         q                    = n >> shift;
+         if (round && (tail || bit_test(q, 0)))
+            ++q;
+      }
+      else
+         q = std::move(n);
+   }
+   else
+   {
+      work_type d(1), r;
+      chars_multiply_pow5(d, static_cast<std::uintmax_t>(-s));
+      if (a < 0)
+         d <<= static_cast<unsigned>(-a);
+      divide_qr(n, d, q, r);
+      r <<= 1;
+      int c = r.compare(d);
+      if ((c > 0) || ((c == 0) && bit_test(q, 0)))
+         ++q;
+   }
+   limb_type         limbs[work::limbs];
+   const std::size_t size = q.backend().size();
+   std::copy(q.backend().limbs(), q.backend().limbs() + size, limbs);
+   return chars_write_limbs(buf, buf + work::max_chars, limbs, size, 10) - buf;
+}
+
+template <class Number, class Backend>
+inline to_chars_result to_chars_float(char* first, char* last, const Number& v, const Backend&, chars_format fmt, int precision)
+{
+   if ((boost::multiprecision::isinf)(v))
+      return chars_special(first, last, (boost::multiprecision::signbit)(v) != 0, "inf");
+   if ((boost::multiprecision::isnan)(v))
+      return chars_special(first, last, (boost::multiprecision::signbit)(v) != 0, "nan");
+   if (v == 0)
+      return chars_zero(first, last, (boost::multiprecision::signbit)(v) != 0, fmt, precision);
+   return to_chars_float_generic(first, last, v, fmt, precision);
+}
+
+template <class Number, unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline to_chars_result to_chars_float(char* first, char* last, const Number& v, const backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b, chars_format fmt, int precision)
+{
+   using float_type = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   if (b.exponent() == float_type::exponent_infinity)
+      return chars_special(first, last, b.sign(), "inf");
+   if (b.exponent() == float_type::exponent_nan)
+      return chars_special(first, last, b.sign(), "nan");
+   if (b.exponent() == float_type::exponent_zero)
+      return chars_zero(first, last, b.sign(), fmt, precision);
+
+   char buf[chars_float_work<float_type>::max_chars];
+   if (fmt == chars_format::fixed)
+   {
+      std::ptrdiff_t nd = chars_float_digits(b, precision, buf);
+      if (nd)
+      {
+         if ((nd == 1) && (buf[0] == '0'))
+            return chars_layout_fixed(first, last, b.sign(), buf, 1, 0, precision);
+         return chars_layout_fixed(first, last, b.sign(), buf, nd, nd - 1 - precision, precision);
+      }
+      return to_chars_float_generic(first, last, v, fmt, precision);
+   }
+   //
+   // The decimal exponent is either our estimate or one more, and rounding may carry into
+   // an extra digit, adjust and go again if we got the wrong number of digits:
+   //
+   const std::ptrdiff_t P     = fmt == chars_format::scientific ? precision + 1 : (std::max)(precision, 1);
+   std::ptrdiff_t       exp10 = static_cast<std::ptrdiff_t>(std::floor(0.30102999566398119521 * static_cast<double>(b.exponent())));
+   for (unsigned tries = 0; tries < 4; ++tries)
+   {
+      std::ptrdiff_t nd = chars_float_digits(b, P - 1 - exp10, buf);
+      if (!nd)
+         break;
+      if (nd != P)
+      {
+         exp10 += nd - P;
+         continue;
+      }
+      if (fmt == chars_format::scientific)
+         return chars_layout_scientific(first, last, b.sign(), buf, nd, exp10, precision);
+      return chars_layout_general(first, last, b.sign(), buf, nd, exp10, P);
+   }
+   return to_chars_float_generic(first, last, v, fmt, precision);
+}
+
+template <class Number, unsigned Digits10, class ExponentType, class Allocator>
+inline to_chars_result to_chars_float(char* first, char* last, const Number& v, const backends::cpp_dec_float<Digits10, ExponentType, Allocator>& b, chars_format fmt, int precision)
+{
+   using writer_type = digit_writer<backends::cpp_dec_float<Digits10, ExponentType, Allocator> >;
+   const bool neg    = (boost::multiprecision::signbit)(v) != 0;
+   if ((boost::multiprecision::isinf)(v))
+      return chars_special(first, last, neg, "inf");
+   if ((boost::multiprecision::isnan)(v))
+      return chars_special(first, last, neg, "nan");
+   if (v == 0)
+      return chars_zero(first, last, neg, fmt, precision);
+
+   writer_type    w(b);
+   char           buf[writer_type::max_digits];
+   std::ptrdiff_t exp10;
+   if (fmt == chars_format::fixed)
+   {
+      const std::intmax_t count = w.exponent10() + 1 + precision;
+      std::ptrdiff_t      nd    = count < 0 ? 0 : w.round_digits(buf, static_cast<std::size_t>(count), exp10);
+      if (!nd)
+      {
+         // Rounds to zero:
+         buf[0] = '0';
+         return chars_layout_fixed(first, last, neg, buf, 1, 0, precision);
+      }
+      return chars_layout_fixed(first, last, neg, buf, nd, exp10, precision);
+   }
+   const std::ptrdiff_t P  = fmt == chars_format::scientific ? precision + 1 : (std::max)(precision, 1);
+   const std::ptrdiff_t nd = w.round_digits(buf, static_cast<std::size_t>(P), exp10);
+   if (fmt == chars_format::scientific)
+      return chars_layout_scientific(first, last, neg, buf, nd, exp10, precision);
+   return chars_layout_general(first, last, neg, buf, nd, exp10, P);
+}
+
+//
+// cpp_double_fp is formatted via the cpp_bin_float type which its own str() uses:
+//
+template <class Backend>
+struct chars_double_fp_float
+{
+   using type = number<backends::cpp_bin_float<static_cast<unsigned>(Backend::my_digits), backends::digit_base_2, void, int, Backend::my_min_exponent - Backend::my_digits / 2, Backend::my_max_exponent>, et_off>;
+};
+
+template <class Number, class FloatingPointType>
+inline to_chars_result to_chars_float(char* first, char* last, const Number&, const backends::cpp_double_fp_backend<FloatingPointType>& b, chars_format fmt, int precision)
+{
+   typename chars_double_fp_float<backends::cpp_double_fp_backend<FloatingPointType> >::type f(b.my_first());
+   f += b.my_second();
+   return to_chars_float(first, last, f, f.backend(), fmt, precision);
+}
+
+//
+// Shortest round trip formatting.  Whether the digits are laid out in fixed or scientific
+// format: plain is the std::to_chars(first, last, value) overload which picks whichever is
+// shorter, general uses fixed format for exponents -4 to 5 as %g does with the default precision:
+//
+inline bool chars_shortest_fixed(std::ptrdiff_t nd, std::ptrdiff_t exp10, chars_format fmt, bool plain) noexcept
+{
+   if (plain)
+   {
+      std::ptrdiff_t e = exp10 < 0 ? -exp10 : exp10, exp_digits = 0;
+      do
+      {
+         ++exp_digits;
+         e /= 10;
+      } while (e);
+      const std::ptrdiff_t scientific = nd + (nd > 1) + 2 + (std::max)(exp_digits, std::ptrdiff_t(BOOST_MP_MIN_EXPONENT_DIGITS));
+      const std::ptrdiff_t fixed      = exp10 >= nd - 1 ? exp10 + 1 : exp10 >= 0 ? nd + 1 : nd + 1 - exp10;
+      return fixed <= scientific;
+   }
+   if (fmt == chars_format::general)
+      return (exp10 >= -4) && (exp10 < 6);
+   return fmt == chars_format::fixed;
+}
+
+inline to_chars_result chars_layout_shortest(char* first, char* last, bool neg, const char* d, std::ptrdiff_t nd, std::ptrdiff_t exp10, bool fixed) noexcept
+{
+   if (fixed)
+      return chars_layout_fixed(first, last, neg, d, nd, exp10, (std::max)(std::ptrdiff_t(0), nd - 1 - exp10));
+   return chars_layout_scientific(first, last, neg, d, nd, exp10, nd - 1);
+}
+
+//
+// Generic shortest formatting, by trial conversions at increasing precision:
+//
+template <class Number>
+inline to_chars_result to_chars_shortest_generic(char* first, char* last, const Number& v, chars_format fmt, bool plain)
+{
+   using value_type = typename Number::value_type;
+   const bool neg   = (boost::multiprecision::signbit)(v) != 0;
+   if ((boost::multiprecision::isinf)(v))
+      return chars_special(first, last, neg, "inf");
+   if ((boost::multiprecision::isnan)(v))
+      return chars_special(first, last, neg, "nan");
+   const char zero = '0';
+   if (v == 0)
+      return chars_layout_shortest(first, last, neg, &zero, 1, 0, chars_shortest_fixed(1, 0, fmt, plain));
+   std::string s;
+   for (std::streamsize P = 1; P < std::numeric_limits<value_type>::max_digits10; ++P)
+   {
+      s = v.str(P, std::ios_base::scientific);
+      if (value_type(s) == v)
+         break;
+   }
+   std::string    digits;
+   std::ptrdiff_t exp10;
+   bool           sign;
+   chars_split_str(s, sign, digits, exp10);
+   std::ptrdiff_t nd = static_cast<std::ptrdiff_t>(digits.size());
+   while ((nd > 1) && (digits[nd - 1] == '0'))
+      --nd;
+   return chars_layout_shortest(first, last, neg, digits.data(), nd, exp10, chars_shortest_fixed(nd, exp10, fmt, plain));
+}
+template <class Number, class Backend>
+inline to_chars_result to_chars_shortest(char* first, char* last, const Number& v, const Backend&, chars_format fmt, bool plain)
+{
+   return to_chars_shortest_generic(first, last, v, fmt, plain);
+}
+
+template <class Integer>
+inline void chars_divide(const Integer& n, const Integer& d, std::intmax_t shift, Integer& q, Integer& r)
+{
+   // d is 2^shift when shift is non-negative:
+   if (shift >= 0)
+   {
+      q = n >> static_cast<unsigned>(shift);
+      r = n - (q << static_cast<unsigned>(shift));
+   }
+   else
+      divide_qr(n, d, q, r);
+}
+
+inline limb_type chars_mod_limb(limb_type n, limb_type d) noexcept
+{
+   return n % d;
+}
+template <class Integer>
+inline limb_type chars_mod_limb(const Integer& n, limb_type d)
+{
+   return integer_modulus(n, d);
+}
+
+//
+// Removes trailing digits from vr, 8 and then 1 at a time, for as long as [lo, hi] contains a
+// multiple of 10, then rounds it, tail is the state of the digits which followed vr:
+//
+template <class Integer>
+inline void chars_remove_digits(Integer& vr, Integer& lo, Integer& hi, int tail, std::intmax_t& e10)
+{
+   limb_type p10 = 100000000u;
+   unsigned  p10_digits = 8;
+   while (true)
+   {
+      Integer lo_next = (lo + (p10 - 1)) / p10, hi_next = hi / p10;
+      if (hi_next < lo_next)
+      {
+         if (p10 == 10)
+            break;
+         p10        = 10;
+         p10_digits = 1;
+         continue;
+      }
+      const limb_type r = chars_mod_limb(vr, p10), half = p10 / 2;
+      vr /= p10;
+      tail = r == 0 ? (tail ? 1 : 0) : r < half ? 1 : r == half ? (tail ? 3 : 2) : 3;
+      lo   = std::move(lo_next);
+      hi   = std::move(hi_next);
+      e10 += p10_digits;
+   }
+   if ((tail == 3) || ((tail == 2) && (chars_mod_limb(vr, 2) != 0)))
+      ++vr;
+   if (vr < lo)
+      vr = lo;
+   else if (vr > hi)
+      vr = hi;
+}
+
+//
+// The shortest digits which round trip to a cpp_bin_float: in the manner of Steele & White
+// and Ryu, the interval of values which round to v is scaled to integers [lo, hi] just once,
+// at a decimal exponent where it's at least 10 wide, then digits are removed, with integer
+// divisions by powers of 10, for as long as the interval contains a multiple of 10.  Returns
+// the number of digits written to buf and sets exp10 to the exponent of the first, or returns
+// zero when the calculation doesn't fit in the work type.
+//
+template <class Float>
+inline std::ptrdiff_t chars_shortest_digits(const Float& v, char* buf, std::ptrdiff_t& exp10)
+{
+   using work      = chars_float_work<Float>;
+   using work_type = typename work::type;
+   //
+   // v is m * 2^e2 / 4, with the neighbouring values at (4m +- 2) * 2^e2 / 4, except that
+   // at a power of 2 the one below is nearer, and there is none at the minimum exponent:
+   //
+   const std::intmax_t e2   = static_cast<std::intmax_t>(v.exponent()) - static_cast<std::intmax_t>(Float::bit_count - 1);
+   std::intmax_t       e10  = static_cast<std::intmax_t>(std::floor(0.30102999566398119521 * static_cast<double>(e2 - 1))) - 2;
+   const std::intmax_t s    = -e10;
+   const std::intmax_t a    = e2 - 2 + s;
+   const double        pow5 = 2.33 * static_cast<double>(s < 0 ? -s : s) + 1;
+   if ((std::max)(Float::bit_count + 4 + (s > 0 ? pow5 : 0) + (a > 0 ? a : 0), (s < 0 ? pow5 : 0) + (a < 0 ? -a : 0)) + 2 * work::limb_bits > work::bits)
+      return 0;
+
+   work_type m;
+   m.backend()                 = v.bits();
+   const bool     accept_ends  = !bit_test(m, 0);
+   const unsigned lower_gap    = lsb(m) != Float::bit_count - 1 ? 2 : v.exponent() > Float::min_exponent ? 1 : 0;
+   const bool     accept_lower = accept_ends || !lower_gap;
+   work_type      f(1), d(1);
+   if (s > 0)
+      chars_multiply_pow5(f, static_cast<std::uintmax_t>(s));
+   else if (s < 0)
+      chars_multiply_pow5(d, static_cast<std::uintmax_t>(-s));
+   if (a > 0)
+      f <<= static_cast<unsigned>(a);
+   else if (a < 0)
+      d <<= static_cast<unsigned>(-a);
+   const std::intmax_t shift = s >= 0 ? (a < 0 ? -a : 0) : -1;
+   m <<= 2;
+   work_type n = m * f, vr, vr_rem, hi, hi_rem, lo, lo_rem;
+   chars_divide(n, d, shift, vr, vr_rem);
+   chars_divide(work_type(n + 2 * f), d, shift, hi, hi_rem);
+   chars_divide(work_type(n - lower_gap * f), d, shift, lo, lo_rem);
+   if (!accept_ends && !hi_rem)
+      --hi;
+   if (!accept_lower || lo_rem)
+      ++lo;
+   //
+   // What follows the digits of vr: 0 nothing, 1 less than a half, 2 a half, 3 more:
+   //
+   int tail = 0;
+   if (vr_rem != 0)
+   {
+      vr_rem <<= 1;
+      int c = vr_rem.compare(d);
+      tail  = c < 0 ? 1 : c == 0 ? 2 : 3;
+   }
+   if ((hi.backend().size() == 1) && !(*hi.backend().limbs() >> (work::limb_bits - 1)))
+   {
+      // The usual case, where the rest fits in a limb with a bit to spare:
+      limb_type vr_limb = *vr.backend().limbs(), lo_limb = *lo.backend().limbs(), hi_limb = *hi.backend().limbs();
+      chars_remove_digits(vr_limb, lo_limb, hi_limb, tail, e10);
+      vr = vr_limb;
+   }
+   else
+      chars_remove_digits(vr, lo, hi, tail, e10);
+
+   limb_type         limbs[work::limbs];
+   const std::size_t size = vr.backend().size();
+   std::copy(vr.backend().limbs(), vr.backend().limbs() + size, limbs);
+   std::ptrdiff_t nd = chars_write_limbs(buf, buf + work::max_chars, limbs, size, 10) - buf;
+   exp10             = static_cast<std::ptrdiff_t>(e10) + nd - 1;
+   return nd;
+}
+
+template <class Number, unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline to_chars_result to_chars_shortest(char* first, char* last, const Number& v, const backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b, chars_format fmt, bool plain)
+{
+   using float_type = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   const char zero  = '0';
+   if (b.exponent() == float_type::exponent_infinity)
+      return chars_special(first, last, b.sign(), "inf");
+   if (b.exponent() == float_type::exponent_nan)
+      return chars_special(first, last, b.sign(), "nan");
+   if (b.exponent() == float_type::exponent_zero)
+      return chars_layout_shortest(first, last, b.sign(), &zero, 1, 0, chars_shortest_fixed(1, 0, fmt, plain));
+
+   char           buf[chars_float_work<float_type>::max_chars];
+   std::ptrdiff_t exp10;
+   std::ptrdiff_t nd = chars_shortest_digits(b, buf, exp10);
+   if (!nd)
+      return to_chars_shortest_generic(first, last, v, fmt, plain);
+   const bool fixed = chars_shortest_fixed(nd, exp10, fmt, plain);
+   if (fixed && (exp10 >= nd - 1))
+   {
+      // An integer, which printf's %f would print exactly:
+      std::ptrdiff_t exact = chars_float_digits(b, 0, buf);
+      if (exact)
+         return chars_layout_fixed(first, last, b.sign(), buf, exact, exact - 1, 0);
+   }
+   return chars_layout_shortest(first, last, b.sign(), buf, nd, exp10, fixed);
+}
+
+//
+// A cpp_dec_float's shortest digits are those it holds, rounded to max_digits10 if there are more:
+//
+template <class Number, unsigned Digits10, class ExponentType, class Allocator>
+inline to_chars_result to_chars_shortest(char* first, char* last, const Number& v, const backends::cpp_dec_float<Digits10, ExponentType, Allocator>& b, chars_format fmt, bool plain)
+{
+   using writer_type = digit_writer<backends::cpp_dec_float<Digits10, ExponentType, Allocator> >;
+   const bool neg    = (boost::multiprecision::signbit)(v) != 0;
+   if ((boost::multiprecision::isinf)(v))
+      return chars_special(first, last, neg, "inf");
+   if ((boost::multiprecision::isnan)(v))
+      return chars_special(first, last, neg, "nan");
+   const char zero = '0';
+   if (v == 0)
+      return chars_layout_shortest(first, last, neg, &zero, 1, 0, chars_shortest_fixed(1, 0, fmt, plain));
+
+   writer_type    w(b);
+   char           buf[writer_type::max_digits];
+   std::ptrdiff_t exp10;
+   std::ptrdiff_t nd = w.round_digits(buf, (std::min)(w.significant_digits(), static_cast<std::size_t>(std::numeric_limits<typename Number::value_type>::max_digits10)), exp10);
+   while ((nd > 1) && (buf[nd - 1] == '0'))
+      --nd;
+   return chars_layout_shortest(first, last, neg, buf, nd, exp10, chars_shortest_fixed(nd, exp10, fmt, plain));
+}
+
+template <class Number, class FloatingPointType>
+inline to_chars_result to_chars_shortest(char* first, char* last, const Number&, const backends::cpp_double_fp_backend<FloatingPointType>& b, chars_format fmt, bool plain)
+{
+   typename chars_double_fp_float<backends::cpp_double_fp_backend<FloatingPointType> >::type f(b.my_first());
+   f += b.my_second();
+   return to_chars_shortest(first, last, f, f.backend(), fmt, plain);
+}
+
+//
+// Case insensitive match of the lower case string s at [p, end):
+//
+inline bool chars_match(const char* p, const char* end, const char* s) noexcept
+{
+   for (; *s; ++s, ++p)
+   {
+      if ((p == end) || ((*p | 0x20) != *s))
+         return false;
+   }
+   return true;
+}
+
+//
+// Parses the digits, point and exponent at [p, last), already checked by from_chars, straight
+// into the backend, or returns false and leaves it to the backend's string parser:
+//
+template <class Backend>
+inline bool from_chars_float(const char*, const char*, bool, Backend&)
+{
+   return false;
+}
+
+//
+// cpp_bin_float: the decimal digits D and exponent e10 are combined exactly, D * 5^e10, or
+// D * 2^s / 5^-e10 with enough bits to round correctly and a final bit set for any remainder,
+// in the fixed precision work type used for formatting, then rounded by copy_and_round.
+// Values which are zero, or would need a larger work type, are left to the backend:
+//
+template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline bool from_chars_float(const char* p, const char* last, bool neg, backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result)
+{
+   using float_type = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using work       = chars_float_work<float_type>;
+   using work_type  = typename work::type;
+   constexpr unsigned  block_digits = chars_block_digits(10, (std::numeric_limits<limb_type>::max)());
+   constexpr limb_type block        = static_cast<limb_type>(chars_block(10, (std::numeric_limits<limb_type>::max)()));
+
+   work_type     d;
+   limb_type     chunk = 0, mult = 1;
+   unsigned      chunk_digits = 0;
+   std::intmax_t digits = 0, e10 = 0;
+   bool          point  = false;
+   for (; p != last; ++p)
+   {
+      if (*p == '.')
+      {
+         point = true;
+         continue;
+      }
+      if ((*p < '0') || (*p > '9'))
+         break;
+      if (point)
+         --e10;
+      if (!digits && (*p == '0'))
+         continue;
+      if (static_cast<double>(++digits) * 3.33 + 2 * work::limb_bits > work::bits)
+         return false;
+      chunk = chunk * 10 + static_cast<limb_type>(*p - '0');
+      mult *= 10;
+      if (++chunk_digits == block_digits)
+      {
+         d *= block;
+         d += chunk;
+         chunk = 0;
+         mult  = 1;
+         chunk_digits = 0;
+      }
+   }
+   if (chunk_digits)
+   {
+      d *= mult;
+      d += chunk;
+   }
+   if (!digits)
+      return false;
+   if (p != last)
+   {
+      // The exponent, anything beyond the work type's range is left to the backend:
+      const bool    eneg = *++p == '-';
+      std::intmax_t e    = 0;
+      if ((*p == '-') || (*p == '+'))
+         ++p;
+      for (; p != last; ++p)
+      {
+         e = e * 10 + (*p - '0');
+         if (e > static_cast<std::intmax_t>(work::bits))
+            return false;
+      }
+      e10 += eneg ? -e : e;
+   }
+
+   const std::intmax_t bit_count = static_cast<std::intmax_t>(float_type::bit_count);
+   const std::intmax_t d_bits    = static_cast<std::intmax_t>(msb(d)) + 1;
+   const double        pow5      = 2.33 * static_cast<double>(e10 < 0 ? -e10 : e10) + 1;
+   std::intmax_t       e2;
+   if (e10 >= 0)
+   {
+      if (static_cast<double>(d_bits) + pow5 + 2 * work::limb_bits > work::bits)
+         return false;
+      chars_multiply_pow5(d, static_cast<std::uintmax_t>(e10));
+      e2 = e10;
+   }
+   else
+   {
+      const std::intmax_t s = (std::max)(std::intmax_t(0), bit_count + 2 + static_cast<std::intmax_t>(pow5) - d_bits);
+      if (static_cast<double>(d_bits + s) + 2 * work::limb_bits > work::bits)
+         return false;
+      work_type q, r, f(1);
+      chars_multiply_pow5(f, static_cast<std::uintmax_t>(-e10));
+      d <<= static_cast<unsigned>(s);
+      divide_qr(d, f, q, r);
+      q <<= 1;
+      if (r != 0)
+         q |= 1u;
+      d  = std::move(q);
+      e2 = e10 - s - 1;
+   }
+   const std::intmax_t exponent = e2 + static_cast<std::intmax_t>(msb(d));
+   if ((exponent > static_cast<std::intmax_t>(float_type::max_exponent)) || (exponent < static_cast<std::intmax_t>(float_type::min_exponent) - 1))
+   {
+      // Out of range, whatever the rounding:
+      result.exponent() = exponent > 0 ? float_type::exponent_infinity : float_type::exponent_zero;
+      result.bits()     = static_cast<limb_type>(0u);
+   }
+   else
+   {
+      if ((e2 + bit_count - 1 < static_cast<std::intmax_t>((std::numeric_limits<Exponent>::min)())) || (e2 + bit_count - 1 > static_cast<std::intmax_t>((std::numeric_limits<Exponent>::max)())))
+         return false;
+      result.exponent() = static_cast<Exponent>(e2 + bit_count - 1);
+      copy_and_round(result, d.backend());
+   }
+   result.sign() = neg;
+   return true;
+}
+
+} // namespace detail
+
+//
+// Integer conversions, in any base from 2 to 36, with the semantics of std::to_chars
+// and std::from_chars.  Fixed precision cpp_int's never allocate memory.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_integer && detail::is_chars_cpp_int<Backend>::value, to_chars_result>::type
+to_chars(char* first, char* last, const number<Backend, ExpressionTemplates>& v, int base = 10)
+{
+   BOOST_MP_ASSERT((base >= 2) && (base <= 36));
+   using is_trivial = std::integral_constant<bool, backends::is_trivial_cpp_int<Backend>::value>;
+   return detail::to_chars_integer(first, last, v.backend(), static_cast<unsigned>(base), std::integral_constant<bool, true>(), is_trivial());
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_integer && !detail::is_chars_cpp_int<Backend>::value, to_chars_result>::type
+to_chars(char* first, char* last, const number<Backend, ExpressionTemplates>& v, int base = 10)
+{
+   BOOST_MP_ASSERT((base >= 2) && (base <= 36));
+   return detail::to_chars_integer(first, last, v, static_cast<unsigned>(base), std::integral_constant<bool, false>(), std::integral_constant<bool, false>());
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_integer, from_chars_result>::type
+from_chars(const char* first, const char* last, number<Backend, ExpressionTemplates>& v, int base = 10)
+{
+   BOOST_MP_ASSERT((base >= 2) && (base <= 36));
+   const char* p   = first;
+   bool        neg = false;
+   BOOST_IF_CONSTEXPR(std::numeric_limits<number<Backend, ExpressionTemplates> >::is_signed)
+   {
+      if ((p != last) && (*p == '-'))
+      {
+         neg = true;
+         ++p;
+      }
+   }
+   const char* digits   = p;
+   bool        overflow = false;
+   p                    = detail::from_chars_integer(digits, last, v, static_cast<unsigned>(base), neg, overflow, std::integral_constant<bool, detail::is_chars_fixed_cpp_int<Backend>::value>());
+   if (p == digits)
+      return {first, std::errc::invalid_argument};
+   if (overflow)
+      return {p, std::errc::result_out_of_range};
+   return {p, std::errc()};
+}
+
+//
+// Floating point conversions with the semantics of std::to_chars and std::from_chars.
+// cpp_bin_float and cpp_double_fp_backend are formatted without allocating memory unless
+// the exponent, or the precision requested, is very large, cpp_dec_float from its limbs;
+// other backends go via their str() member.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_floating_point, to_chars_result>::type
+to_chars(char* first, char* last, const number<Backend, ExpressionTemplates>& v, chars_format fmt, int precision)
+{
+   if (precision < 0)
+      precision = 6;
+   return detail::to_chars_float(first, last, v, v.backend(), fmt, precision);
+}
+
+//
+// The shortest representations which read back to exactly the same value, in fixed or
+// scientific format, whichever is shorter, or in the format requested.  Exact for
+// cpp_bin_float, cpp_double_fp_backend and cpp_dec_float, other backends use trial conversions.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_floating_point, to_chars_result>::type
+to_chars(char* first, char* last, const number<Backend, ExpressionTemplates>& v)
+{
+   return detail::to_chars_shortest(first, last, v, v.backend(), chars_format::general, true);
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_floating_point, to_chars_result>::type
+to_chars(char* first, char* last, const number<Backend, ExpressionTemplates>& v, chars_format fmt)
+{
+   return detail::to_chars_shortest(first, last, v, v.backend(), fmt, false);
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<number_category<Backend>::value == number_kind_floating_point, from_chars_result>::type
+from_chars(const char* first, const char* last, number<Backend, ExpressionTemplates>& v, chars_format fmt = chars_format::general)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+   const char* p     = first;
+   bool        neg   = (p != last) && (*p == '-');
+   if (neg)
+      ++p;
+   if (detail::chars_match(p, last, "inf"))
+   {
+      p += detail::chars_match(p, last, "infinity") ? 8 : 3;
+      v = std::numeric_limits<number_type>::infinity();
+      if (neg)
+         v = -v;
+      return {p, std::errc()};
+   }
+   if (detail::chars_match(p, last, "nan"))
+   {
+      p += 3;
+      if ((p != last) && (*p == '('))
+      {
+         const char* q = p + 1;
+         while ((q != last) && ((detail::chars_digit_value(*q) < 36) || (*q == '_')))
+            ++q;
+         if ((q != last) && (*q == ')'))
+            p = q + 1;
+      }
+      v = std::numeric_limits<number_type>::quiet_NaN();
+      if (neg)
+         v = -v;
+      return {p, std::errc()};
+   }
+   const char* digits   = p;
+   bool        non_zero = false, any_digits = false;
+   for (; (p != last) && (*p >= '0') && (*p <= '9'); ++p)
+   {
+      any_digits = true;
+      non_zero |= *p != '0';
+   }
+   if ((p != last) && (*p == '.'))
+   {
+      for (++p; (p != last) && (*p >= '0') && (*p <= '9'); ++p)
+      {
+         any_digits = true;
+         non_zero |= *p != '0';
+      }
+   }
+   if (!any_digits)
+      return {first, std::errc::invalid_argument};
+   bool has_exponent = false;
+   if ((static_cast<int>(fmt) & static_cast<int>(chars_format::scientific)) && (p != last) && ((*p | 0x20) == 'e'))
+   {
+      const char* q = p + 1;
+      if ((q != last) && ((*q == '-') || (*q == '+')))
+         ++q;
+      if ((q != last) && (*q >= '0') && (*q <= '9'))
+      {
+         while ((q != last) && (*q >= '0') && (*q <= '9'))
+            ++q;
+         p            = q;
+         has_exponent = true;
+      }
+   }
+   if ((fmt == chars_format::scientific) && !has_exponent)
+      return {first, std::errc::invalid_argument};
+   number_type t;
+   if (!detail::from_chars_float(digits, p, neg, t.backend()))
+   {
+      //
+      // The backends parse null terminated strings, short ones are copied to the stack:
+      //
+      char              buffer[128];
+      std::string       heap;
+      const std::size_t len = static_cast<std::size_t>(p - first);
+      const char*       str = buffer;
+      if (len < sizeof(buffer))
+      {
+         std::memcpy(buffer, first, len);
+         buffer[len] = 0;
+      }
+      else
+      {
+         heap.assign(first, p);
+         str = heap.c_str();
+      }
+      t.backend() = str;
+   }
+   if ((boost::multiprecision::isinf)(t) || (non_zero && (t == 0)))
+      return {p, std::errc::result_out_of_range};
+   v = std::move(t);
+   return {p, std::errc()};
+}
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_CHARCONV_HPP
@@ -0,0 +1,319 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_COLUMN_VIEW_HPP
+#define BOOST_MP_COLUMN_VIEW_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/multiprecision/binary_format.hpp>
+#include <boost/multiprecision/detail/endian.hpp>
+
+//
+// Arrays of fixed precision values stored one after another in a fixed number of bytes
+// each, so that the i'th value of a file or memory mapping is at a known offset and may
+// be loaded directly with no parsing.  The layouts are the same on every platform:
+//
+// cpp_int_backend:        The magnitude in (MaxBits + 7) / 8 bytes, least significant first,
+//                         followed for signed types by a byte which is 1 for negative values.
+// cpp_bin_float:          The mantissa in (bit_count + 7) / 8 bytes, least significant first,
+//                         then the exponent in sizeof(Exponent) bytes of two's complement, least
+//                         significant first, then a byte which is 1 for negative values.
+// cpp_double_fp_backend:  The high then the low part, each as the IEEE representation of the
+//                         float type, least significant byte first.
+//
+namespace boost {
+namespace multiprecision {
+
+namespace backends {
+template <typename FloatingPointType>
+class cpp_double_fp_backend;
+}
+
+namespace detail {
+
+//
+// Reads the low Bits bits of the n = (Bits + 7) / 8 bytes at p into v, any bits above Bits
+// in the top byte are cleared first so that corrupt input still loads a value in range:
+//
+template <std::size_t Bits, class Int, class Trivial>
+inline void column_read_bits(const unsigned char* p, Int& v, const Trivial& trivial, const std::integral_constant<bool, false>&)
+{
+   binary_read_bytes(p, (Bits + CHAR_BIT - 1) / CHAR_BIT, v, trivial);
+}
+template <std::size_t Bits, class Int, class Trivial>
+inline void column_read_bits(const unsigned char* p, Int& v, const Trivial& trivial, const std::integral_constant<bool, true>&)
+{
+   constexpr std::size_t n = (Bits + CHAR_BIT - 1) / CHAR_BIT;
+   unsigned char         buffer[n];
+   std::memcpy(buffer, p, n);
+   buffer[n - 1] &= static_cast<unsigned char>((1u << (Bits % CHAR_BIT)) - 1);
+   binary_read_bytes(buffer, n, v, trivial);
+}
+template <std::size_t Bits, class Int, class Trivial>
+inline void column_read_bits(const unsigned char* p, Int& v, const Trivial& trivial)
+{
+   column_read_bits<Bits>(p, v, trivial, std::integral_constant<bool, (Bits % CHAR_BIT != 0)>());
+}
+
+//
+// Specialized for each supported backend, with members size, store and load:
+//
+template <class Backend>
+struct column_layout;
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+struct column_layout<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >
+{
+   using backend_type = backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>;
+   using trivial      = typename binary_int_traits<backend_type>::trivial;
+
+   static_assert(MaxBits != 0, "Only fixed precision cpp_int's have a fixed size layout.");
+
+   static constexpr bool        is_signed      = SignType == signed_magnitude || SignType == signed_packed;
+   static constexpr std::size_t magnitude_size = (MaxBits + CHAR_BIT - 1) / CHAR_BIT;
+   static constexpr std::size_t size           = magnitude_size + (is_signed ? 1 : 0);
+
+   static void store(unsigned char* p, const backend_type& v) noexcept
+   {
+      const std::size_t n = binary_magnitude_bytes(v, trivial());
+      p                   = binary_write_bytes(p, v, 0, n, trivial());
+      std::memset(p, 0, magnitude_size - n);
+      if (is_signed)
+         p[magnitude_size - n] = v.sign() ? 1 : 0;
+   }
+   static void load(const unsigned char* p, backend_type& v)
+   {
+      column_read_bits<MaxBits>(p, v, trivial());
+      if (is_signed && (p[magnitude_size] != 0) != v.sign())
+         v.negate();
+   }
+};
+
+template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+struct column_layout<backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> >
+{
+   using backend_type  = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using rep_type      = typename backend_type::rep_type;
+   using trivial       = typename binary_int_traits<rep_type>::trivial;
+   using unsigned_type = typename std::make_unsigned<Exponent>::type;
+
+   static constexpr std::size_t mantissa_size = (backend_type::bit_count + CHAR_BIT - 1) / CHAR_BIT;
+   static constexpr std::size_t size          = mantissa_size + sizeof(Exponent) + 1;
+
+   static void store(unsigned char* p, const backend_type& v) noexcept
+   {
+      const std::size_t n = binary_magnitude_bytes(v.bits(), trivial());
+      p                   = binary_write_bytes(p, v.bits(), 0, n, trivial());
+      std::memset(p, 0, mantissa_size - n);
+      p += mantissa_size - n;
+      const unsigned_type e = static_cast<unsigned_type>(v.exponent());
+      for (std::size_t i = 0; i < sizeof(Exponent); ++i)
+         *p++ = static_cast<unsigned char>(e >> (CHAR_BIT * i));
+      *p = v.sign() ? 1 : 0;
+   }
+   static void load(const unsigned char* p, backend_type& v)
+   {
+      column_read_bits<backend_type::bit_count>(p, v.bits(), trivial());
+      p += mantissa_size;
+      unsigned_type e = 0;
+      for (std::size_t i = 0; i < sizeof(Exponent); ++i)
+         e |= static_cast<unsigned_type>(static_cast<unsigned_type>(p[i]) << (CHAR_BIT * i));
+      v.exponent() = static_cast<Exponent>(e);
+      v.sign()     = p[sizeof(Exponent)] != 0;
+   }
+};
+
+template <typename FloatingPointType>
+struct column_layout<backends::cpp_double_fp_backend<FloatingPointType> >
+{
+   using backend_type = backends::cpp_double_fp_backend<FloatingPointType>;
+
+   static constexpr std::size_t size = 2 * sizeof(FloatingPointType);
+
+   static void copy(unsigned char* to, const unsigned char* from) noexcept
+   {
+#if BOOST_MP_ENDIAN_BIG_BYTE
+      std::reverse_copy(from, from + sizeof(FloatingPointType), to);
+#else
+      std::memcpy(to, from, sizeof(FloatingPointType));
+#endif
+   }
+   static void store(unsigned char* p, const backend_type& v) noexcept
+   {
+      copy(p, reinterpret_cast<const unsigned char*>(&v.crep().first));
+      copy(p + sizeof(FloatingPointType), reinterpret_cast<const unsigned char*>(&v.crep().second));
+   }
+   static void load(const unsigned char* p, backend_type& v) noexcept
+   {
+      copy(reinterpret_cast<unsigned char*>(&v.rep().first), p);
+      copy(reinterpret_cast<unsigned char*>(&v.rep().second), p + sizeof(FloatingPointType));
+   }
+};
+
+} // namespace detail
+
+//
+// The number of bytes taken by each value of type Number:
+//
+template <class Number>
+struct column_stride : public std::integral_constant<std::size_t, detail::column_layout<typename Number::backend_type>::size>
+{};
+
+//
+// A read only view of an array of values stored by write_column, typically a memory mapped
+// file.  Values are loaded from the underlying bytes when accessed, which needs no alignment:
+//
+template <class Number>
+class column_view
+{
+   using layout = detail::column_layout<typename Number::backend_type>;
+
+   const unsigned char* m_data;
+   std::size_t          m_size;
+
+ public:
+   using value_type      = Number;
+   using size_type       = std::size_t;
+   using difference_type = std::ptrdiff_t;
+
+   static constexpr std::size_t stride = layout::size;
+
+   //
+   // A proxy iterator: it has all the random access operations, but dereferencing loads
+   // a value rather than returning a reference, so reference is Number and not const Number&,
+   // which the standard's forward iterator requirements do not allow.  It is tagged random
+   // access all the same, as std::vector<bool>'s iterators are, so that std::distance,
+   // std::advance and std::lower_bound take their fast paths:
+   //
+   class const_iterator
+   {
+      const unsigned char* m_pos;
+
+    public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type        = Number;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = const Number*;
+      using reference         = Number;
+
+      const_iterator() noexcept : m_pos(nullptr) {}
+      explicit const_iterator(const unsigned char* pos) noexcept : m_pos(pos) {}
+
+      Number operator*() const
+      {
+         Number result;
+         layout::load(m_pos, result.backend());
+         return result;
+      }
+      const_iterator& operator++() noexcept
+      {
+         m_pos += stride;
+         return *this;
+      }
+      const_iterator operator++(int) noexcept
+      {
+         const_iterator t(*this);
+         m_pos += stride;
+         return t;
+      }
+      const_iterator& operator--() noexcept
+      {
+         m_pos -= stride;
+         return *this;
+      }
+      const_iterator operator--(int) noexcept
+      {
+         const_iterator t(*this);
+         m_pos -= stride;
+         return t;
+      }
+      const_iterator& operator+=(difference_type n) noexcept
+      {
+         m_pos += n * static_cast<difference_type>(stride);
+         return *this;
+      }
+      const_iterator& operator-=(difference_type n) noexcept
+      {
+         m_pos -= n * static_cast<difference_type>(stride);
+         return *this;
+      }
+      Number operator[](difference_type n) const
+      {
+         return *(*this + n);
+      }
+      friend const_iterator operator+(const_iterator i, difference_type n) noexcept { return i += n; }
+      friend const_iterator operator+(difference_type n, const_iterator i) noexcept { return i += n; }
+      friend const_iterator operator-(const_iterator i, difference_type n) noexcept { return i -= n; }
+      friend difference_type operator-(const const_iterator& a, const const_iterator& b) noexcept { return (a.m_pos - b.m_pos) / static_cast<difference_type>(stride); }
+      friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept { return a.m_pos == b.m_pos; }
+      friend bool operator!=(const const_iterator& a, const const_iterator& b) noexcept { return a.m_pos != b.m_pos; }
+      friend bool operator<(const const_iterator& a, const const_iterator& b) noexcept { return a.m_pos < b.m_pos; }
+      friend bool operator>(const const_iterator& a, const const_iterator& b) noexcept { return a.m_pos > b.m_pos; }
+      friend bool operator<=(const const_iterator& a, const const_iterator& b) noexcept { return a.m_pos <= b.m_pos; }
+      friend bool operator>=(const const_iterator& a, const const_iterator& b) noexcept { return a.m_pos >= b.m_pos; }
+   };
+
+   column_view() noexcept : m_data(nullptr), m_size(0) {}
+   //
+   // Views the whole values in the bytes [data, data + bytes):
+   //
+   column_view(const void* data, std::size_t bytes) noexcept : m_data(static_cast<const unsigned char*>(data)), m_size(bytes / stride) {}
+
+   std::size_t          size() const noexcept { return m_size; }
+   bool                 empty() const noexcept { return m_size == 0; }
+   const unsigned char* data() const noexcept { return m_data; }
+
+   Number operator[](std::size_t i) const
+   {
+      BOOST_MP_ASSERT(i < m_size);
+      Number result;
+      layout::load(m_data + i * stride, result.backend());
+      return result;
+   }
+   Number at(std::size_t i) const
+   {
+      if (i >= m_size)
+         BOOST_MP_THROW_EXCEPTION(std::out_of_range("Index out of range in column_view::at."));
+      return (*this)[i];
+   }
+   //
+   // Loads the i'th value into v, avoiding a temporary:
+   //
+   void load(std::size_t i, Number& v) const
+   {
+      BOOST_MP_ASSERT(i < m_size);
+      layout::load(m_data + i * stride, v.backend());
+   }
+
+   const_iterator begin() const noexcept { return const_iterator(m_data); }
+   const_iterator end() const noexcept { return const_iterator(m_data + m_size * stride); }
+};
+
+template <class Number>
+constexpr std::size_t column_view<Number>::stride;
+
+//
+// Stores the values [first, last) at out, which must have room for (last - first) * column_stride<Number>::value
+// bytes, and returns a pointer past the last byte written:
+//
+template <class Iterator>
+inline unsigned char* write_column(unsigned char* out, Iterator first, Iterator last)
+{
+   using number_type = typename std::iterator_traits<Iterator>::value_type;
+   using layout      = detail::column_layout<typename number_type::backend_type>;
+   for (; first != last; ++first, out += layout::size)
+      layout::store(out, first->backend());
+   return out;
+}
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_COLUMN_VIEW_HPP
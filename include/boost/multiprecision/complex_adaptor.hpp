@@ -262,10 +262,87 @@ inline void eval_subtract(complex_adaptor<Backend>& result, const complex_adapto
    eval_subtract(result.real_data(), o.real_data());
    eval_subtract(result.imag_data(), o.imag_data());
 }
+//
+// Minimum precisions, in decimal digits, at which complex squaring and division use the
+// formulas with fewer multiplications and divisions, and at which general complex
+// multiplication uses Gauss' 3 multiplication method.  Below these the extra additions cost
+// more than the multiplications and divisions they save:
+//
+#ifdef BOOST_MP_COMPLEX_FAST_ARITHMETIC_DIGITS10
+const unsigned complex_fast_arithmetic_digits10 = BOOST_MP_COMPLEX_FAST_ARITHMETIC_DIGITS10;
+#else
+const unsigned complex_fast_arithmetic_digits10 = 30;
+#endif
+#ifdef BOOST_MP_COMPLEX_GAUSS_MULTIPLY_DIGITS10
+const unsigned complex_gauss_multiply_digits10 = BOOST_MP_COMPLEX_GAUSS_MULTIPLY_DIGITS10;
+#else
+const unsigned complex_gauss_multiply_digits10 = 400;
+#endif
+
+template <class Backend>
+inline unsigned complex_adaptor_digits10(const Backend& val, const std::integral_constant<bool, true>&)
+{
+   return val.precision();
+}
+template <class Backend>
+inline constexpr unsigned complex_adaptor_digits10(const Backend&, const std::integral_constant<bool, false>&)
+{
+   return std::numeric_limits<number<Backend> >::digits10;
+}
+
+template <class Backend>
+inline bool is_finite_non_zero_part(const Backend& val)
+{
+   using default_ops::eval_fpclassify;
+   int c = eval_fpclassify(val);
+   return (c != static_cast<int>(FP_ZERO)) && (c != static_cast<int>(FP_INFINITE)) && (c != static_cast<int>(FP_NAN));
+}
+//
+// The fast paths are used only when all the parts are finite and non-zero, so that
+// infinities, NaN's and signed zeros propagate exactly as they do through the
+// textbook formulas:
+//
+template <class Backend>
+inline bool use_complex_fast_arithmetic(const complex_adaptor<Backend>& a, const complex_adaptor<Backend>& b, unsigned digits10)
+{
+   return (complex_adaptor_digits10(a.real_data(), boost::multiprecision::detail::is_variable_precision<Backend>()) >= digits10)
+      && is_finite_non_zero_part(a.real_data()) && is_finite_non_zero_part(a.imag_data())
+      && is_finite_non_zero_part(b.real_data()) && is_finite_non_zero_part(b.imag_data());
+}
+
 template <class Backend>
 inline void eval_multiply(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& o)
 {
    Backend t1, t2, t3;
+   if (&result == &o)
+   {
+      if (use_complex_fast_arithmetic(result, o, complex_fast_arithmetic_digits10))
+      {
+         // (a + bi)^2 = (a + b)(a - b) + 2abi
+         eval_add(t1, result.real_data(), result.imag_data());
+         eval_subtract(t2, result.real_data(), result.imag_data());
+         eval_multiply(t3, result.real_data(), result.imag_data());
+         eval_multiply(result.real_data(), t1, t2);
+         eval_add(result.imag_data(), t3, t3);
+         return;
+      }
+   }
+   else if (use_complex_fast_arithmetic(result, o, complex_gauss_multiply_digits10))
+   {
+      //
+      // Gauss: (a + bi)(c + di) = (k1 - k3) + (k1 + k2)i
+      // where k1 = c(a + b), k2 = a(d - c), k3 = b(c + d).
+      //
+      eval_add(t1, result.real_data(), result.imag_data());
+      eval_multiply(t2, t1, o.real_data());
+      eval_subtract(t1, o.imag_data(), o.real_data());
+      eval_multiply(t3, result.real_data(), t1);
+      eval_add(t1, o.real_data(), o.imag_data());
+      eval_multiply(t1, result.imag_data());
+      eval_subtract(result.real_data(), t2, t1);
+      eval_add(result.imag_data(), t2, t3);
+      return;
+   }
    eval_multiply(t1, result.real_data(), o.real_data());
    eval_multiply(t2, result.imag_data(), o.imag_data());
    eval_subtract(t3, t1, t2);
@@ -275,6 +352,78 @@ inline void eval_multiply(complex_adaptor<Backend>& result, const complex_adapto
    result.real_data() = std::move(t3);
    result.imag_data() = std::move(t1);
 }
+template <class Backend>
+inline void eval_multiply(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& a, const complex_adaptor<Backend>& b)
+{
+   if (&a == &b)
+   {
+      // Make sure squares get to the squaring code above:
+      if (&result != &a)
+         result = a;
+      eval_multiply(result, result);
+   }
+   else
+      default_ops::eval_multiply_default(result, a, b);
+}
+//
+// Computes (a + bi) / (c + di) as (a + bi)(c - di) * (1 / (c^2 + d^2)), which replaces the
+// 3 divisions of Smith's algorithm with a single reciprocal.  The product uses Gauss' method
+// only above the same threshold as multiplication.  Returns false, leaving result unchanged,
+// if the fast path is not applicable or if anything overflows or underflows.
+//
+template <class Backend>
+inline bool eval_divide_by_reciprocal(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& z)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_divide;
+   using default_ops::eval_multiply;
+   using default_ops::eval_subtract;
+
+   if ((&result == &z) || !use_complex_fast_arithmetic(result, z, complex_fast_arithmetic_digits10))
+      return false;
+
+   Backend r, t1, t2, k1;
+   eval_multiply(t1, z.real_data(), z.real_data());
+   eval_multiply(t2, z.imag_data(), z.imag_data());
+   eval_add(t1, t2);
+   if (!is_finite_non_zero_part(t1))
+      return false;
+   r = static_cast<typename std::tuple_element<0, typename Backend::unsigned_types>::type>(1u);
+   eval_divide(r, t1);
+   if (complex_adaptor_digits10(z.real_data(), boost::multiprecision::detail::is_variable_precision<Backend>()) >= complex_gauss_multiply_digits10)
+   {
+      //
+      // Gauss' method for (a + bi)(c - di) = (k1 - k3) + (k1 + k2)i
+      // where k1 = c(a + b), k2 = -a(c + d), k3 = b(c - d):
+      //
+      eval_add(t1, result.real_data(), result.imag_data());
+      eval_multiply(k1, t1, z.real_data());
+      eval_add(t1, z.real_data(), z.imag_data());
+      eval_multiply(t2, result.real_data(), t1);
+      eval_subtract(t2, k1, t2);
+      eval_subtract(t1, z.real_data(), z.imag_data());
+      eval_multiply(t1, result.imag_data());
+      eval_subtract(k1, t1);
+   }
+   else
+   {
+      // (a + bi)(c - di) = (ac + bd) + (bc - ad)i, as multiplication does below the Gauss threshold:
+      eval_multiply(k1, result.real_data(), z.real_data());
+      eval_multiply(t1, result.imag_data(), z.imag_data());
+      eval_add(k1, t1);
+      eval_multiply(t2, result.imag_data(), z.real_data());
+      eval_multiply(t1, result.real_data(), z.imag_data());
+      eval_subtract(t2, t1);
+   }
+   eval_multiply(k1, r);
+   eval_multiply(t2, r);
+   if (!is_finite_non_zero_part(k1) || !is_finite_non_zero_part(t2))
+      return false;
+   result.real_data() = std::move(k1);
+   result.imag_data() = std::move(t2);
+   return true;
+}
+
 template <class Backend>
 inline void eval_divide(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& z)
 {
@@ -301,7 +450,7 @@ inline void eval_divide(complex_adaptor<Backend>& result, const complex_adaptor<
       eval_divide(result.real_data(), z.real_data());
       eval_divide(result.imag_data(), z.real_data());
    }
-   else
+   else if (!eval_divide_by_reciprocal(result, z))
    {
       eval_fabs(t1, z.real_data());
       eval_fabs(t2, z.imag_data());
@@ -527,12 +676,15 @@ template <class Backend>
 inline void eval_pow(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& b, const complex_adaptor<Backend>& e)
 {
    using default_ops::eval_acos;
+   using default_ops::eval_convert_to;
    using default_ops::eval_cos;
    using default_ops::eval_exp;
+   using default_ops::eval_fpclassify;
    using default_ops::eval_get_sign;
    using default_ops::eval_is_zero;
    using default_ops::eval_multiply;
    using default_ops::eval_sin;
+   using default_ops::eval_trunc;
 
    if (eval_is_zero(e))
    {
@@ -565,6 +717,48 @@ inline void eval_pow(complex_adaptor<Backend>& result, const complex_adaptor<Bac
       }
       return;
    }
+   if (eval_is_zero(e.imag_data()) && is_finite_non_zero_part(e.real_data())
+      && (eval_fpclassify(b.real_data()) != static_cast<int>(FP_INFINITE)) && (eval_fpclassify(b.real_data()) != static_cast<int>(FP_NAN))
+      && (eval_fpclassify(b.imag_data()) != static_cast<int>(FP_INFINITE)) && (eval_fpclassify(b.imag_data()) != static_cast<int>(FP_NAN)))
+   {
+      //
+      // Small integer powers by repeated squaring need no transcendental functions at all:
+      //
+      using si_type = typename boost::multiprecision::detail::canonical<int, Backend>::type;
+      Backend n;
+      eval_trunc(n, e.real_data());
+      if ((n.compare(e.real_data()) == 0) && (n.compare(si_type(-64)) >= 0) && (n.compare(si_type(64)) <= 0))
+      {
+         long long p;
+         eval_convert_to(&p, n);
+         unsigned long long       m = p < 0 ? static_cast<unsigned long long>(-p) : static_cast<unsigned long long>(p);
+         complex_adaptor<Backend> x(b);
+         bool                     first = true;
+         while (true)
+         {
+            if (m & 1u)
+            {
+               if (first)
+                  result = x;
+               else
+                  eval_multiply(result, x);
+               first = false;
+            }
+            m >>= 1;
+            if (!m)
+               break;
+            eval_multiply(x, x);
+         }
+         if (p < 0)
+         {
+            x      = result;
+            result = static_cast<typename std::tuple_element<0, typename Backend::unsigned_types>::type>(1u);
+            eval_divide(result, x);
+         }
+         return;
+      }
+   }
+
    complex_adaptor<Backend> t;
    eval_log(t, b);
    eval_multiply(t, e);
@@ -574,11 +768,10 @@ inline void eval_pow(complex_adaptor<Backend>& result, const complex_adaptor<Bac
 template <class Backend>
 inline void eval_exp(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& arg)
 {
-   using default_ops::eval_cos;
    using default_ops::eval_exp;
    using default_ops::eval_is_zero;
    using default_ops::eval_multiply;
-   using default_ops::eval_sin;
+   using default_ops::eval_sincos;
 
    if (eval_is_zero(arg.imag_data()))
    {
@@ -587,10 +780,9 @@ inline void eval_exp(complex_adaptor<Backend>& result, const complex_adaptor<Bac
       result.imag_data() = zero;
       return;
    }
-   eval_cos(result.real_data(), arg.imag_data());
-   eval_sin(result.imag_data(), arg.imag_data());
    Backend e;
    eval_exp(e, arg.real_data());
+   eval_sincos(result.imag_data(), result.real_data(), arg.imag_data());
    if (eval_is_zero(result.real_data()))
       eval_multiply(result.imag_data(), e);
    else if (eval_is_zero(result.imag_data()))
@@ -645,40 +837,30 @@ inline void eval_log10(complex_adaptor<Backend>& result, const complex_adaptor<B
 template <class Backend>
 inline void eval_sin(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& arg)
 {
-   using default_ops::eval_cos;
-   using default_ops::eval_cosh;
-   using default_ops::eval_sin;
-   using default_ops::eval_sinh;
-
-   Backend t1, t2, t3;
-   eval_sin(t1, arg.real_data());
-   eval_cosh(t2, arg.imag_data());
-   eval_multiply(t3, t1, t2);
-
-   eval_cos(t1, arg.real_data());
-   eval_sinh(t2, arg.imag_data());
-   eval_multiply(result.imag_data(), t1, t2);
-   result.real_data() = t3;
+   using default_ops::eval_sincos;
+   using default_ops::eval_sinhcosh;
+
+   // sin(x + iy) = sin(x)cosh(y) + i cos(x)sinh(y)
+   Backend s, c, sh, ch;
+   eval_sincos(s, c, arg.real_data());
+   eval_sinhcosh(sh, ch, arg.imag_data());
+   eval_multiply(result.real_data(), s, ch);
+   eval_multiply(result.imag_data(), c, sh);
 }
 
 template <class Backend>
 inline void eval_cos(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& arg)
 {
-   using default_ops::eval_cos;
-   using default_ops::eval_cosh;
-   using default_ops::eval_sin;
-   using default_ops::eval_sinh;
-
-   Backend t1, t2, t3;
-   eval_cos(t1, arg.real_data());
-   eval_cosh(t2, arg.imag_data());
-   eval_multiply(t3, t1, t2);
-
-   eval_sin(t1, arg.real_data());
-   eval_sinh(t2, arg.imag_data());
-   eval_multiply(result.imag_data(), t1, t2);
+   using default_ops::eval_sincos;
+   using default_ops::eval_sinhcosh;
+
+   // cos(x + iy) = cos(x)cosh(y) - i sin(x)sinh(y)
+   Backend s, c, sh, ch;
+   eval_sincos(s, c, arg.real_data());
+   eval_sinhcosh(sh, ch, arg.imag_data());
+   eval_multiply(result.real_data(), c, ch);
+   eval_multiply(result.imag_data(), s, sh);
    result.imag_data().negate();
-   result.real_data() = t3;
 }
 
 template <class T>
@@ -816,39 +998,29 @@ inline void eval_atan(complex_adaptor<Backend>& result, const complex_adaptor<Ba
 template <class Backend>
 inline void eval_sinh(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& arg)
 {
-   using default_ops::eval_cos;
-   using default_ops::eval_cosh;
-   using default_ops::eval_sin;
-   using default_ops::eval_sinh;
-
-   Backend t1, t2, t3;
-   eval_cos(t1, arg.imag_data());
-   eval_sinh(t2, arg.real_data());
-   eval_multiply(t3, t1, t2);
-
-   eval_cosh(t1, arg.real_data());
-   eval_sin(t2, arg.imag_data());
-   eval_multiply(result.imag_data(), t1, t2);
-   result.real_data() = t3;
+   using default_ops::eval_sincos;
+   using default_ops::eval_sinhcosh;
+
+   // sinh(x + iy) = sinh(x)cos(y) + i cosh(x)sin(y)
+   Backend s, c, sh, ch;
+   eval_sincos(s, c, arg.imag_data());
+   eval_sinhcosh(sh, ch, arg.real_data());
+   eval_multiply(result.real_data(), sh, c);
+   eval_multiply(result.imag_data(), ch, s);
 }
 
 template <class Backend>
 inline void eval_cosh(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& arg)
 {
-   using default_ops::eval_cos;
-   using default_ops::eval_cosh;
-   using default_ops::eval_sin;
-   using default_ops::eval_sinh;
-
-   Backend t1, t2, t3;
-   eval_cos(t1, arg.imag_data());
-   eval_cosh(t2, arg.real_data());
-   eval_multiply(t3, t1, t2);
-
-   eval_sin(t1, arg.imag_data());
-   eval_sinh(t2, arg.real_data());
-   eval_multiply(result.imag_data(), t1, t2);
-   result.real_data() = t3;
+   using default_ops::eval_sincos;
+   using default_ops::eval_sinhcosh;
+
+   // cosh(x + iy) = cosh(x)cos(y) + i sinh(x)sin(y)
+   Backend s, c, sh, ch;
+   eval_sincos(s, c, arg.imag_data());
+   eval_sinhcosh(sh, ch, arg.real_data());
+   eval_multiply(result.real_data(), ch, c);
+   eval_multiply(result.imag_data(), sh, s);
 }
 
 template <class Backend>
@@ -0,0 +1,395 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_CONSTANT_TIME_HPP
+#define BOOST_MP_CONSTANT_TIME_HPP
+
+//
+// Constant time arithmetic for fixed precision unsigned cpp_int's.
+//
+// The regular cpp_int routines trim leading zero limbs, and branch on operand sizes and
+// on carries, so their running time depends on the values.  The routines here always
+// operate on every limb of the type, with carries and borrows propagated arithmetically,
+// and comparisons and selections made with masks rather than branches.  The values are
+// assumed secret, and the modulus passed to ct_powm public.
+//
+// Arguments are read with a masked loop over all the limbs, and results are written in full.
+// However every cpp_int must then be normalized, so the result of each function here leaks
+// its number of leading zero limbs: through the time normalize() takes, through size(), and
+// through the time of any regular operation later applied to it.  Intermediate values within
+// ct_powm never leave the fixed width limb arrays, so this applies only to the final result.
+//
+
+#include <climits>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+template <class Backend>
+struct is_constant_time_cpp_int : public std::integral_constant<bool, false>
+{};
+template <std::size_t Bits>
+struct is_constant_time_cpp_int<cpp_int_backend<Bits, Bits, unsigned_magnitude, unchecked, void> >
+    : public std::integral_constant<bool, !backends::is_trivial_cpp_int<cpp_int_backend<Bits, Bits, unsigned_magnitude, unchecked, void> >::value>
+{};
+
+template <std::size_t Bits>
+struct ct_limbs
+{
+   static constexpr unsigned    limb_bits  = sizeof(limb_type) * CHAR_BIT;
+   static constexpr std::size_t count      = Bits / limb_bits + ((Bits % limb_bits) ? 1 : 0);
+   static constexpr limb_type   upper_mask = (Bits % limb_bits) ? (static_cast<limb_type>(1u) << (Bits % limb_bits)) - 1 : ~static_cast<limb_type>(0u);
+
+   limb_type data[count];
+};
+
+template <std::size_t Bits>
+constexpr unsigned ct_limbs<Bits>::limb_bits;
+template <std::size_t Bits>
+constexpr std::size_t ct_limbs<Bits>::count;
+template <std::size_t Bits>
+constexpr limb_type ct_limbs<Bits>::upper_mask;
+
+// All ones when c is 1, zero when c is 0:
+inline limb_type ct_mask(limb_type c)
+{
+   return static_cast<limb_type>(static_cast<limb_type>(0u) - c);
+}
+// 1 when x is non-zero, 0 otherwise:
+inline limb_type ct_is_nonzero(limb_type x)
+{
+   return static_cast<limb_type>((x | static_cast<limb_type>(static_cast<limb_type>(0u) - x)) >> (sizeof(limb_type) * CHAR_BIT - 1));
+}
+
+template <std::size_t Bits, class Number>
+void ct_load(ct_limbs<Bits>& r, const Number& x)
+{
+   const limb_type*  p = x.backend().limbs();
+   const std::size_t n = x.backend().size();
+   // The storage of a fixed precision cpp_int always has room for every limb:
+   for (std::size_t i = 0; i < ct_limbs<Bits>::count; ++i)
+      r.data[i] = p[i] & ct_mask(static_cast<limb_type>(i < n));
+}
+
+template <std::size_t Bits, class Number>
+void ct_store(Number& x, const ct_limbs<Bits>& a)
+{
+   x.backend().resize(ct_limbs<Bits>::count, ct_limbs<Bits>::count);
+   for (std::size_t i = 0; i < ct_limbs<Bits>::count; ++i)
+      x.backend().limbs()[i] = a.data[i];
+   x.backend().normalize();
+}
+//
+// r = a + b + carry, returns the carry out:
+//
+template <std::size_t N>
+limb_type ct_add_n(limb_type* r, const limb_type* a, const limb_type* b, limb_type carry)
+{
+   for (std::size_t i = 0; i < N; ++i)
+   {
+      double_limb_type s = static_cast<double_limb_type>(a[i]) + b[i] + carry;
+      r[i]               = static_cast<limb_type>(s);
+      carry              = static_cast<limb_type>(s >> (sizeof(limb_type) * CHAR_BIT));
+   }
+   return carry;
+}
+//
+// r = a - b, returns the borrow out:
+//
+template <std::size_t N>
+limb_type ct_subtract_n(limb_type* r, const limb_type* a, const limb_type* b)
+{
+   limb_type borrow = 0;
+   for (std::size_t i = 0; i < N; ++i)
+   {
+      double_limb_type d = static_cast<double_limb_type>(a[i]) - b[i] - borrow;
+      r[i]               = static_cast<limb_type>(d);
+      borrow             = static_cast<limb_type>(d >> (sizeof(double_limb_type) * CHAR_BIT - 1));
+   }
+   return borrow;
+}
+//
+// r = mask ? a : b, limb by limb:
+//
+template <std::size_t N>
+void ct_select_n(limb_type* r, limb_type mask, const limb_type* a, const limb_type* b)
+{
+   for (std::size_t i = 0; i < N; ++i)
+      r[i] = (a[i] & mask) | (b[i] & ~mask);
+}
+
+template <std::size_t N>
+void ct_swap_n(limb_type* a, limb_type* b, limb_type mask)
+{
+   for (std::size_t i = 0; i < N; ++i)
+   {
+      limb_type t = (a[i] ^ b[i]) & mask;
+      a[i] ^= t;
+      b[i] ^= t;
+   }
+}
+//
+// Montgomery arithmetic modulo an odd m of N limbs, with R = 2^(N * limb_bits).
+//
+template <std::size_t N>
+class ct_montgomery
+{
+ public:
+   template <class Number>
+   explicit ct_montgomery(const Number& m)
+   {
+      const limb_type* p = m.backend().limbs();
+      for (std::size_t i = 0; i < N; ++i)
+         m_m[i] = i < m.backend().size() ? p[i] : 0u;
+      // -m^-1 mod 2^limb_bits by Newton's iteration, each step doubles the number of correct bits:
+      limb_type inv = m_m[0];
+      for (unsigned i = 0; i < 6; ++i)
+         inv *= static_cast<limb_type>(2u - m_m[0] * inv);
+      m_inv = static_cast<limb_type>(0u - inv);
+      //
+      // R^2 mod m, without a division or any wider type: 2^k R mod m is the Montgomery form
+      // of 2^k, so we double 2^msb(m) < m modulo m until we reach 2^s R, where s is
+      // N * limb_bits with its factors of two removed, and then Montgomery square that until
+      // we reach the form of 2^(N * limb_bits) = R, which is R^2 mod m.  The modulus is public, so basing the
+      // number of steps on its most significant bit reveals nothing:
+      //
+      constexpr unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+      unsigned           s = N * limb_bits, squarings = 0;
+      while (!(s & 1u))
+      {
+         s >>= 1;
+         ++squarings;
+      }
+      const unsigned top = static_cast<unsigned>(msb(m));
+      for (std::size_t i = 0; i < N; ++i)
+         m_r2[i] = 0u;
+      m_r2[top / limb_bits] = static_cast<limb_type>(1u) << (top % limb_bits);
+      for (unsigned i = top; i < N * limb_bits + s; ++i)
+         double_mod(m_r2);
+      for (unsigned i = 0; i < squarings; ++i)
+         multiply(m_r2, m_r2, m_r2);
+   }
+   //
+   // r = a * b / R mod m, by Coarsely Integrated Operand Scanning, see
+   // "Analyzing and Comparing Montgomery Multiplication Algorithms", Koc, Acar and Kaliski, 1996.
+   // The result is in [0, m) provided a * b < R * m, r may alias a or b.
+   //
+   void multiply(limb_type* r, const limb_type* a, const limb_type* b) const
+   {
+      constexpr unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+      limb_type          t[N + 2] = {0};
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         double_limb_type c = 0;
+         for (std::size_t j = 0; j < N; ++j)
+         {
+            c += static_cast<double_limb_type>(a[j]) * b[i] + t[j];
+            t[j] = static_cast<limb_type>(c);
+            c >>= limb_bits;
+         }
+         c += t[N];
+         t[N]     = static_cast<limb_type>(c);
+         t[N + 1] = static_cast<limb_type>(c >> limb_bits);
+
+         const limb_type q = static_cast<limb_type>(t[0] * m_inv);
+         c                 = static_cast<double_limb_type>(q) * m_m[0] + t[0];
+         c >>= limb_bits;
+         for (std::size_t j = 1; j < N; ++j)
+         {
+            c += static_cast<double_limb_type>(q) * m_m[j] + t[j];
+            t[j - 1] = static_cast<limb_type>(c);
+            c >>= limb_bits;
+         }
+         c += t[N];
+         t[N - 1] = static_cast<limb_type>(c);
+         t[N]     = static_cast<limb_type>(t[N + 1] + static_cast<limb_type>(c >> limb_bits));
+      }
+      // t < 2m, subtract m unless that borrows out of t[N]:
+      limb_type       d[N];
+      const limb_type borrow = ct_subtract_n<N>(d, t, m_m);
+      ct_select_n<N>(r, ct_mask(static_cast<limb_type>(ct_is_nonzero(t[N]) | (borrow ^ 1u))), d, t);
+   }
+   // a = 2a mod m, for any a < m:
+   void double_mod(limb_type* a) const
+   {
+      limb_type       t[N], d[N];
+      const limb_type carry  = ct_add_n<N>(t, a, a, 0u);
+      const limb_type borrow = ct_subtract_n<N>(d, t, m_m);
+      ct_select_n<N>(a, ct_mask(static_cast<limb_type>(carry | (borrow ^ 1u))), d, t);
+   }
+   // a * R mod m, for any a < R:
+   void to_montgomery(limb_type* r, const limb_type* a) const
+   {
+      multiply(r, a, m_r2);
+   }
+
+ private:
+   limb_type m_m[N];
+   limb_type m_r2[N];
+   limb_type m_inv;
+};
+
+} // namespace detail
+
+//
+// Returns true if a == b, examining every limb:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<detail::is_constant_time_cpp_int<Backend>::value, bool>::type
+ct_equal(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b)
+{
+   using limbs_type = detail::ct_limbs<std::numeric_limits<number<Backend> >::digits>;
+   limbs_type x, y;
+   detail::ct_load(x, a);
+   detail::ct_load(y, b);
+   limb_type diff = 0;
+   for (std::size_t i = 0; i < limbs_type::count; ++i)
+      diff |= x.data[i] ^ y.data[i];
+   return !detail::ct_is_nonzero(diff);
+}
+
+//
+// Returns true if a < b, from the borrow out of a full width subtraction:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<detail::is_constant_time_cpp_int<Backend>::value, bool>::type
+ct_less(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b)
+{
+   using limbs_type = detail::ct_limbs<std::numeric_limits<number<Backend> >::digits>;
+   limbs_type x, y;
+   detail::ct_load(x, a);
+   detail::ct_load(y, b);
+   return detail::ct_subtract_n<limbs_type::count>(x.data, x.data, y.data) != 0;
+}
+
+//
+// Returns c ? a : b without branching on c:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<detail::is_constant_time_cpp_int<Backend>::value, number<Backend, ExpressionTemplates> >::type
+ct_select(bool c, const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b)
+{
+   using limbs_type = detail::ct_limbs<std::numeric_limits<number<Backend> >::digits>;
+   limbs_type x, y;
+   detail::ct_load(x, a);
+   detail::ct_load(y, b);
+   detail::ct_select_n<limbs_type::count>(x.data, detail::ct_mask(static_cast<limb_type>(c)), x.data, y.data);
+   number<Backend, ExpressionTemplates> result;
+   detail::ct_store(result, x);
+   return result;
+}
+
+//
+// Full width a + b, a - b and a * b, modulo 2^digits as for the regular unchecked types:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<detail::is_constant_time_cpp_int<Backend>::value, number<Backend, ExpressionTemplates> >::type
+ct_add(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b)
+{
+   using limbs_type = detail::ct_limbs<std::numeric_limits<number<Backend> >::digits>;
+   limbs_type x, y;
+   detail::ct_load(x, a);
+   detail::ct_load(y, b);
+   detail::ct_add_n<limbs_type::count>(x.data, x.data, y.data, 0u);
+   x.data[limbs_type::count - 1] &= limbs_type::upper_mask;
+   number<Backend, ExpressionTemplates> result;
+   detail::ct_store(result, x);
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<detail::is_constant_time_cpp_int<Backend>::value, number<Backend, ExpressionTemplates> >::type
+ct_subtract(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b)
+{
+   using limbs_type = detail::ct_limbs<std::numeric_limits<number<Backend> >::digits>;
+   limbs_type x, y;
+   detail::ct_load(x, a);
+   detail::ct_load(y, b);
+   detail::ct_subtract_n<limbs_type::count>(x.data, x.data, y.data);
+   x.data[limbs_type::count - 1] &= limbs_type::upper_mask;
+   number<Backend, ExpressionTemplates> result;
+   detail::ct_store(result, x);
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<detail::is_constant_time_cpp_int<Backend>::value, number<Backend, ExpressionTemplates> >::type
+ct_multiply(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b)
+{
+   using limbs_type             = detail::ct_limbs<std::numeric_limits<number<Backend> >::digits>;
+   constexpr std::size_t n      = limbs_type::count;
+   limbs_type            x, y, r = {{0}};
+   detail::ct_load(x, a);
+   detail::ct_load(y, b);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      double_limb_type c = 0;
+      for (std::size_t j = 0; i + j < n; ++j)
+      {
+         c += static_cast<double_limb_type>(x.data[i]) * y.data[j] + r.data[i + j];
+         r.data[i + j] = static_cast<limb_type>(c);
+         c >>= sizeof(limb_type) * CHAR_BIT;
+      }
+   }
+   r.data[n - 1] &= limbs_type::upper_mask;
+   number<Backend, ExpressionTemplates> result;
+   detail::ct_store(result, r);
+   return result;
+}
+
+//
+// b^e mod m by a Montgomery ladder: every bit of e is processed, with the same two
+// Montgomery multiplications whatever its value, and the ladder's registers exchanged
+// by masked swaps.  The modulus is treated as public, and must be odd, otherwise a
+// std::domain_error is thrown.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<detail::is_constant_time_cpp_int<Backend>::value, number<Backend, ExpressionTemplates> >::type
+ct_powm(const number<Backend, ExpressionTemplates>& b, const number<Backend, ExpressionTemplates>& e, const number<Backend, ExpressionTemplates>& m)
+{
+   using limbs_type                = detail::ct_limbs<std::numeric_limits<number<Backend> >::digits>;
+   constexpr std::size_t n         = limbs_type::count;
+   constexpr unsigned    limb_bits = limbs_type::limb_bits;
+
+   if (!bit_test(m, 0))
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("ct_powm requires an odd modulus."));
+   number<Backend, ExpressionTemplates> result;
+   if (m == 1u)
+      return result;
+
+   const detail::ct_montgomery<n> mont(m);
+   limbs_type                     x, r0, r1, exponent, one = {{1u}};
+   detail::ct_load(x, b);
+   detail::ct_load(exponent, e);
+   mont.to_montgomery(r0.data, one.data);
+   mont.to_montgomery(r1.data, x.data);
+   //
+   // Invariant: r1 = r0 * b, at each step r0 becomes r0^2 or r0 * r1 as the bit is 0 or 1.
+   // Rather than swapping before and after each step, swap when the bit changes:
+   //
+   limb_type previous = 0;
+   for (std::size_t i = n * limb_bits; i-- > 0;)
+   {
+      const limb_type bit = (exponent.data[i / limb_bits] >> (i % limb_bits)) & 1u;
+      detail::ct_swap_n<n>(r0.data, r1.data, detail::ct_mask(bit ^ previous));
+      previous = bit;
+      mont.multiply(r1.data, r0.data, r1.data);
+      mont.multiply(r0.data, r0.data, r0.data);
+   }
+   detail::ct_swap_n<n>(r0.data, r1.data, detail::ct_mask(previous));
+   mont.multiply(r0.data, r0.data, one.data);
+   detail::ct_store(result, r0);
+   return result;
+}
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_CONSTANT_TIME_HPP
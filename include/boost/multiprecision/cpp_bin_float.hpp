@@ -2077,15 +2077,33 @@ int eval_signbit(const cpp_bin_float<D1, B1, A1, E1, M1, M2>& val)
 template <unsigned D1, backends::digit_base_type B1, class A1, class E1, E1 M1, E1 M2>
 inline std::size_t hash_value(const cpp_bin_float<D1, B1, A1, E1, M1, M2>& val)
 {
-   std::size_t result = hash_value(val.bits());
-   boost::multiprecision::detail::hash_combine(result, val.exponent(), val.sign());
-   return result;
+   //
+   // The mantissa is normalized so equal values have equal mantissas, exponents and signs,
+   // except that zero and NaN may have either sign and infinity and NaN any mantissa:
+   //
+   using float_type  = cpp_bin_float<D1, B1, A1, E1, M1, M2>;
+   using trivial_tag = std::integral_constant<bool, is_trivial_cpp_int<typename float_type::rep_type>::value>;
+   const std::uint64_t e = static_cast<std::uint64_t>(static_cast<std::int64_t>(val.exponent())) << 1u;
+   switch (val.exponent())
+   {
+   case float_type::exponent_zero:
+   case float_type::exponent_nan:
+      return boost::multiprecision::detail::hash_words(static_cast<const limb_type*>(nullptr), 0, e);
+   case float_type::exponent_infinity:
+      return boost::multiprecision::detail::hash_words(static_cast<const limb_type*>(nullptr), 0, e | val.sign());
+   default:
+      return hash_magnitude(val.bits(), e | val.sign(), trivial_tag());
+   }
 }
 
 } // namespace backends
 
 namespace detail {
 
+template <unsigned Digits, boost::multiprecision::backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinExponent, Exponent MaxExponent>
+struct is_avalanching_hash<boost::multiprecision::backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinExponent, MaxExponent> > : public std::integral_constant<bool, true>
+{};
+
 template <unsigned Digits, boost::multiprecision::backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinExponent, Exponent MaxExponent>
 struct transcendental_reduction_type<boost::multiprecision::backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinExponent, MaxExponent> >
 {
@@ -2146,6 +2164,7 @@ using boost::multiprecision::signbit;
 
 #include <boost/multiprecision/cpp_bin_float/io.hpp>
 #include <boost/multiprecision/cpp_bin_float/transcendental.hpp>
+#include <boost/multiprecision/cpp_bin_float/random.hpp>
 
 namespace std {
 
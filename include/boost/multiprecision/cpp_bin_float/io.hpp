@@ -8,6 +8,7 @@
 
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
+#include <vector>
 
 namespace boost { namespace multiprecision {
 namespace cpp_bf_io_detail {
@@ -165,6 +166,126 @@ inline int get_round_mode(cpp_int& r, cpp_int& d, std::int64_t error, const cpp_
    return 0;
 }
 
+//
+// Powers of 5 for exact conversions: 5^(pow5_step * i) are cached for i < pow5_cache_size,
+// where 5^pow5_step fits in a limb, so that any 5^k with k < max_cached_pow5 is a table
+// lookup plus a single limb multiplication:
+//
+constexpr unsigned      pow5_step       = sizeof(limb_type) * CHAR_BIT >= 64 ? 27 : 13;
+constexpr unsigned      pow5_cache_size = 64;
+constexpr std::intmax_t max_cached_pow5 = pow5_step * pow5_cache_size;
+
+inline std::vector<cpp_int> make_pow5_cache()
+{
+   std::vector<cpp_int> cache(pow5_cache_size);
+   limb_type            step = 1;
+   for (unsigned i = 0; i < pow5_step; ++i)
+      step *= 5;
+   cache[0] = 1;
+   for (unsigned i = 1; i < pow5_cache_size; ++i)
+      cache[i] = cache[i - 1] * step;
+   return cache;
+}
+
+inline void cached_pow5(cpp_int& result, std::intmax_t k)
+{
+   BOOST_MP_ASSERT((k >= 0) && (k < max_cached_pow5));
+   static const std::vector<cpp_int> cache = make_pow5_cache();
+   result                                  = cache[static_cast<std::size_t>(k / pow5_step)];
+   limb_type p                             = 1;
+   for (k %= pow5_step; k; --k)
+      p *= 5;
+   if (p != 1)
+      result *= p;
+}
+
+//
+// Gathers decimal digits into n a limb at a time, rather than with a multiply and add of n
+// for every digit:
+//
+class digit_accumulator
+{
+   cpp_int&  n;
+   limb_type block = 0;
+   limb_type scale = 1;
+
+ public:
+   static constexpr limb_type max_scale = sizeof(limb_type) * CHAR_BIT >= 64 ? static_cast<limb_type>(10000000000000000000uLL) : static_cast<limb_type>(1000000000u);
+
+   explicit digit_accumulator(cpp_int& result) : n(result) {}
+   void add(unsigned digit)
+   {
+      block = block * 10 + digit;
+      scale *= 10;
+      if (scale == max_scale)
+         flush();
+   }
+   void flush()
+   {
+      if (scale != 1)
+      {
+         n *= scale;
+         n += block;
+         block = 0;
+         scale = 1;
+      }
+   }
+};
+
+//
+// The fast path for inputs of few digits and small exponents: when n and 5^|decimal_exp|
+// both fit in a limb, n * 10^decimal_exp is calculated exactly as a double limb (a
+// quotient and remainder for negative exponents) and rounded to bits bits.  Returns
+// false if the input doesn't qualify, otherwise the result is m * 2^exponent:
+//
+inline bool parse_fast_path(const cpp_int& n, std::intmax_t decimal_exp, std::size_t bits, limb_type& m, std::intmax_t& exponent)
+{
+   constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+   if ((n.backend().size() != 1) || (bits >= limb_bits) || (decimal_exp <= -static_cast<std::intmax_t>(pow5_step)) || (decimal_exp >= static_cast<std::intmax_t>(pow5_step)))
+      return false;
+   limb_type p = 1;
+   for (std::intmax_t k = decimal_exp < 0 ? -decimal_exp : decimal_exp; k; --k)
+      p *= 5;
+   const limb_type  nl     = *n.backend().limbs();
+   double_limb_type v      = 0;
+   bool             sticky = false;
+   if (decimal_exp >= 0)
+   {
+      v        = static_cast<double_limb_type>(nl) * p;
+      exponent = decimal_exp;
+   }
+   else
+   {
+      // Scale n so that the quotient has at least limb_bits - 1 >= bits bits:
+      const std::size_t      shift = 2 * limb_bits - 2 - boost::multiprecision::detail::find_msb(nl);
+      const double_limb_type num   = static_cast<double_limb_type>(nl) << shift;
+      v                            = num / p;
+      sticky                       = num % p != 0;
+      exponent                     = decimal_exp - static_cast<std::intmax_t>(shift);
+   }
+   const std::size_t top = boost::multiprecision::detail::find_msb(v);
+   if (top < bits)
+   {
+      m = static_cast<limb_type>(v << (bits - 1 - top));
+      exponent -= static_cast<std::intmax_t>(bits - 1 - top);
+      return true;
+   }
+   const std::size_t      shift = top + 1 - bits;
+   const double_limb_type half  = static_cast<double_limb_type>(1u) << (shift - 1);
+   const double_limb_type rest  = v & ((half << 1) - 1);
+   m                            = static_cast<limb_type>(v >> shift);
+   exponent += static_cast<std::intmax_t>(shift);
+   if ((rest > half) || ((rest == half) && (sticky || (m & 1u))))
+   {
+      if (++m >> bits)
+      {
+         m >>= 1;
+         ++exponent;
+      }
+   }
+   return true;
+}
+
 } // namespace cpp_bf_io_detail
 
 namespace backends {
@@ -204,10 +325,10 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
    //
    // Digits before the point:
    //
+   boost::multiprecision::cpp_bf_io_detail::digit_accumulator digits(n);
    while (*s && (*s >= '0') && (*s <= '9'))
    {
-      n *= 10u;
-      n += *s - '0';
+      digits.add(static_cast<unsigned>(*s - '0'));
       if (digits_seen || (*s != '0'))
          ++digits_seen;
       ++s;
@@ -220,8 +341,7 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
    //
    while (*s && (*s >= '0') && (*s <= '9'))
    {
-      n *= 10u;
-      n += *s - '0';
+      digits.add(static_cast<unsigned>(*s - '0'));
       --decimal_exp;
       if (digits_seen || (*s != '0'))
          ++digits_seen;
@@ -229,6 +349,7 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
       if (digits_seen > max_digits_seen)
          break;
    }
+   digits.flush();
    //
    // Digits we're skipping:
    //
@@ -293,20 +414,37 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
    std::int64_t  error          = 0;
    std::intmax_t calc_exp       = 0;
    std::intmax_t final_exponent = 0;
+   //
+   // When the power of 5 is in our cache we use it exactly, so there's no error to track
+   // and the result is correctly rounded first time, otherwise we approximate it within
+   // max_bits and increase the precision until the rounding can be decided:
+   //
+   const bool exact = (decimal_exp > -boost::multiprecision::cpp_bf_io_detail::max_cached_pow5) && (decimal_exp < boost::multiprecision::cpp_bf_io_detail::max_cached_pow5);
+   limb_type  fast_bits;
 
-   if (decimal_exp >= 0)
+   if (boost::multiprecision::cpp_bf_io_detail::parse_fast_path(n, decimal_exp, cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count, fast_bits, final_exponent))
+   {
+      bits()     = fast_bits;
+      exponent() = 0;
+      sign()     = ss;
+      final_exponent += cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count - 1;
+   }
+   else if (decimal_exp >= 0)
    {
       // Nice and simple, the result is an integer...
       do
       {
          cpp_int t;
-         if (decimal_exp)
+         if (exact)
+         {
+            boost::multiprecision::cpp_bf_io_detail::cached_pow5(t, decimal_exp);
+            t *= n;
+         }
+         else
          {
             calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow(t, cpp_int(5), decimal_exp, max_bits, error);
             calc_exp += boost::multiprecision::cpp_bf_io_detail::restricted_multiply(t, t, n, max_bits, error);
          }
-         else
-            t = n;
          final_exponent = (std::int64_t)cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count - 1 + decimal_exp + calc_exp;
          std::ptrdiff_t rshift     = static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(msb(t)) - static_cast<std::ptrdiff_t>(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count) + 1);
          if (rshift > 0)
@@ -363,7 +501,10 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
       do
       {
          cpp_int d;
-         calc_exp                   = boost::multiprecision::cpp_bf_io_detail::restricted_pow(d, cpp_int(5), -decimal_exp, max_bits, error);
+         if (exact)
+            boost::multiprecision::cpp_bf_io_detail::cached_pow5(d, -decimal_exp);
+         else
+            calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow(d, cpp_int(5), -decimal_exp, max_bits, error);
          const std::ptrdiff_t shift = static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count) - static_cast<std::ptrdiff_t>(msb(n)) + static_cast<std::ptrdiff_t>(msb(d)));
          final_exponent             = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count - 1 + decimal_exp - calc_exp;
          if (shift > 0)
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Uniform random cpp_bin_float's in [0, 1) with every bit of the mantissa filled:
+//
+#ifndef BOOST_MP_CPP_BIN_FLOAT_RANDOM_HPP
+#define BOOST_MP_CPP_BIN_FLOAT_RANDOM_HPP
+
+#include <boost/multiprecision/detail/uniform_real_distribution.hpp>
+
+namespace boost { namespace multiprecision {
+namespace detail {
+
+//
+// The result is the infinitely precise uniform value 0.b1b2b3... rounded down, which gives
+// every representable value in [0, 1) the probability of the interval up to the next one.
+// The mantissa is filled with random limbs, and if its leading bit is not set it is shifted
+// up past the leading zeros, which each halve the value, and the vacated low bits filled
+// with more random bits.  An all zero mantissa is rare, and simply continues the zeros on
+// to the next one.  Values below the minimum exponent are returned as zero:
+//
+template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE, expression_template_option ET>
+struct uniform_01_generator<number<backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>, ET> >
+{
+   using float_type    = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using number_type   = number<float_type, ET>;
+   using rep_type      = typename float_type::rep_type;
+   using exponent_type = typename float_type::exponent_type;
+   using trivial_tag   = std::integral_constant<bool, backends::is_trivial_cpp_int<rep_type>::value>;
+
+   template <class Engine>
+   static number_type generate(Engine& eng)
+   {
+      return generate(eng, std::integral_constant<bool, boost::multiprecision::detail::is_integral<typename Engine::result_type>::value>());
+   }
+
+ private:
+   template <class Engine>
+   static number_type generate(Engine& eng, const std::integral_constant<bool, false>&)
+   {
+      return generate_uniform_01<number_type>(eng);
+   }
+   template <class Engine>
+   static number_type generate(Engine& eng, const std::integral_constant<bool, true>&)
+   {
+      using default_ops::eval_bitwise_or;
+      using default_ops::eval_is_zero;
+      using default_ops::eval_left_shift;
+      using default_ops::eval_msb;
+
+      constexpr std::size_t         bits = float_type::bit_count;
+      random_limb_generator<Engine> gen(eng);
+      number_type                   result;
+      float_type&                   f = result.backend();
+      exponent_type                 e = -1;
+      for (;;)
+      {
+         generate_random_bits(gen, f.bits(), bits, trivial_tag());
+         if (!eval_is_zero(f.bits()))
+            break;
+         if (e < float_type::min_exponent + static_cast<exponent_type>(bits))
+            return number_type(0);
+         e -= static_cast<exponent_type>(bits);
+      }
+      const std::size_t shift = bits - 1 - eval_msb(f.bits());
+      if (shift)
+      {
+         rep_type low;
+         eval_left_shift(f.bits(), shift);
+         generate_random_bits(gen, low, shift, trivial_tag());
+         eval_bitwise_or(f.bits(), low);
+         e -= static_cast<exponent_type>(shift);
+      }
+      if (e < float_type::min_exponent)
+         return number_type(0);
+      f.exponent() = e;
+      f.sign()     = false;
+      return result;
+   }
+};
+
+}}} // namespace boost::multiprecision::detail
+
+#endif
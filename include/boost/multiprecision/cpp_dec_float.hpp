@@ -69,6 +69,13 @@ template <unsigned Digits10, class ExponentType, class Allocator>
 struct number_category<backends::cpp_dec_float<Digits10, ExponentType, Allocator> > : public std::integral_constant<int, number_kind_floating_point>
 {};
 
+namespace detail {
+template <class Backend>
+struct digit_writer;
+template <class Backend>
+struct binary_format;
+}
+
 namespace backends {
 
 template <unsigned Digits10, class ExponentType, class Allocator>
@@ -258,11 +265,16 @@ class cpp_dec_float
 
    std::size_t hash() const
    {
-      std::size_t result = 0;
-      for (int i = 0; i < prec_elem; ++i)
-         boost::multiprecision::detail::hash_combine(result, data[i]);
-      boost::multiprecision::detail::hash_combine(result, exp, neg, static_cast<std::size_t>(fpclass));
-      return result;
+      // Equal values have equal digits, exponents and signs, except that zero and NaN may have
+      // either sign, and all the digits are compared whatever the current precision:
+      using boost::multiprecision::detail::hash_words;
+      if ((isnan)())
+         return hash_words(static_cast<const std::uint32_t*>(nullptr), 0, boost::multiprecision::detail::hash_secret0);
+      if ((isinf)())
+         return hash_words(static_cast<const std::uint32_t*>(nullptr), 0, neg ? boost::multiprecision::detail::hash_secret1 : boost::multiprecision::detail::hash_secret2);
+      if (iszero())
+         return hash_words(static_cast<const std::uint32_t*>(nullptr), 0, 0u);
+      return hash_words(data.data(), data.size(), (static_cast<std::uint64_t>(static_cast<std::int64_t>(exp)) << 1u) | (neg ? 1u : 0u));
    }
 
    // Specific special values.
@@ -727,6 +739,10 @@ class cpp_dec_float
 
    template <unsigned D, class ET, class A>
    friend class cpp_dec_float;
+   template <class Backend>
+   friend struct boost::multiprecision::detail::digit_writer;
+   template <class Backend>
+   friend struct boost::multiprecision::detail::binary_format;
 };
 
 template <unsigned Digits10, class ExponentType, class Allocator>
@@ -3531,6 +3547,10 @@ inline std::size_t hash_value(const cpp_dec_float<Digits10, ExponentType, Alloca
 
 namespace detail {
 
+template <unsigned Digits10, class ExponentType, class Allocator>
+struct is_avalanching_hash<boost::multiprecision::backends::cpp_dec_float<Digits10, ExponentType, Allocator> > : public std::integral_constant<bool, true>
+{};
+
 template <unsigned Digits10, class ExponentType, class Allocator>
 struct transcendental_reduction_type<boost::multiprecision::backends::cpp_dec_float<Digits10, ExponentType, Allocator> >
 {
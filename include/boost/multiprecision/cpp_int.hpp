@@ -158,6 +158,19 @@ struct is_fixed_precision<cpp_int_backend<MinBits, MaxBits, SignType, Checked, A
     : public std::integral_constant<bool, max_precision<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value != SIZE_MAX>
 {};
 
+//
+// Traits class, determines whether addition, subtraction and multiplication use the
+// unrolled full width routines: true for the unchecked, non-trivial fixed precision
+// types up to 1024 bits, for example uint256_t or int1024_t.
+//
+template <class T>
+struct is_unrolled_fixed_cpp_int : public std::integral_constant<bool, false>
+{};
+template <std::size_t MinBits, cpp_integer_type SignType>
+struct is_unrolled_fixed_cpp_int<cpp_int_backend<MinBits, MinBits, SignType, unchecked, void> >
+    : public std::integral_constant<bool, !is_trivial_cpp_int<cpp_int_backend<MinBits, MinBits, SignType, unchecked, void> >::value && (MinBits <= 1024)>
+{};
+
 namespace detail {
 
 inline BOOST_MP_CXX14_CONSTEXPR void verify_new_size(std::size_t new_size, std::size_t min_size, const std::integral_constant<int, checked>&)
@@ -2356,5 +2369,7 @@ struct is_convertible_arithmetic<uint128_type, backends::cpp_int_backend<MinBits
 #include <boost/multiprecision/cpp_int/literals.hpp>
 #include <boost/multiprecision/cpp_int/serialize.hpp>
 #include <boost/multiprecision/cpp_int/import_export.hpp>
+#include <boost/multiprecision/cpp_int/modular.hpp>
+#include <boost/multiprecision/cpp_int/random.hpp>
 
 #endif
@@ -167,6 +167,154 @@ inline BOOST_MP_CXX14_CONSTEXPR void subtract_unsigned_constexpr(CppInt1& result
       result.negate();
 }
 
+namespace detail {
+
+// std::index_sequence is C++14, so we have our own:
+template <std::size_t... I>
+struct unroll_sequence
+{};
+template <std::size_t N, std::size_t... I>
+struct make_unroll_sequence : public make_unroll_sequence<N - 1, N - 1, I...>
+{};
+template <std::size_t... I>
+struct make_unroll_sequence<0, I...>
+{
+   using type = unroll_sequence<I...>;
+};
+
+template <class F, std::size_t... I>
+BOOST_MP_FORCEINLINE void unroll_imp(F& f, unroll_sequence<I...>)
+{
+   // Braced initializers are evaluated in order, so f(0), f(1)... are called in sequence:
+   int expand[] = {0, (f(std::integral_constant<std::size_t, I>()), 0)...};
+   (void)expand;
+}
+//
+// Calls f(std::integral_constant<std::size_t, I>()) for I = 0...N-1, this is how the
+// fixed precision routines get their loops completely unrolled:
+//
+template <std::size_t N, class F>
+BOOST_MP_FORCEINLINE void unroll(F&& f)
+{
+   unroll_imp(f, typename make_unroll_sequence<N>::type());
+}
+} // namespace detail
+
+//
+// Full width addition and subtraction for the unchecked fixed precision types up to 1024 bits
+// (see is_unrolled_fixed_cpp_int): when both arguments use every limb, as is usual for hashes
+// and the like, the carry chain is a completely unrolled straight line.  These return false
+// if the argument types or values are not suitable, in which case the caller does the work instead:
+//
+template <class CppInt1, class CppInt2, class CppInt3>
+inline constexpr bool add_unsigned_full_width(CppInt1&, const CppInt2&, const CppInt3&) noexcept
+{
+   return false;
+}
+
+template <std::size_t MinBits, cpp_integer_type SignType>
+inline typename std::enable_if<is_unrolled_fixed_cpp_int<cpp_int_backend<MinBits, MinBits, SignType, unchecked, void> >::value, bool>::type
+add_unsigned_full_width(
+    cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>&       result,
+    const cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>& a,
+    const cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>& b) noexcept
+{
+   using cpp_int_type = cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>;
+   constexpr std::size_t limb_count = cpp_int_type::internal_limb_count;
+
+   if ((a.size() != limb_count) || (b.size() != limb_count))
+      return false;
+
+   const bool                                s  = a.sign();
+   typename cpp_int_type::const_limb_pointer pa = a.limbs();
+   typename cpp_int_type::const_limb_pointer pb = b.limbs();
+   typename cpp_int_type::limb_pointer       pr = result.limbs();
+   //
+   // Each limb of result is written after the corresponding limbs of a and b are read,
+   // so aliasing is fine:
+   //
+#ifdef BOOST_MP_HAS_IMMINTRIN_H
+   unsigned char carry = 0;
+   detail::unroll<limb_count>([&](std::size_t i) {
+      carry = ::boost::multiprecision::detail::addcarry_limb(carry, pa[i], pb[i], pr + i);
+   });
+#else
+   double_limb_type carry = 0;
+   detail::unroll<limb_count>([&](std::size_t i) {
+      carry += static_cast<double_limb_type>(pa[i]) + static_cast<double_limb_type>(pb[i]);
+      pr[i] = static_cast<limb_type>(carry);
+      carry >>= cpp_int_type::limb_bits;
+   });
+#endif
+   // Any carry out of the top limb is discarded, as is anything above MinBits:
+   result.resize(limb_count, limb_count);
+   result.normalize();
+   result.sign(s);
+   return true;
+}
+
+template <class CppInt1, class CppInt2, class CppInt3>
+inline constexpr bool subtract_unsigned_full_width(CppInt1&, const CppInt2&, const CppInt3&) noexcept
+{
+   return false;
+}
+
+template <std::size_t MinBits, cpp_integer_type SignType>
+inline typename std::enable_if<is_unrolled_fixed_cpp_int<cpp_int_backend<MinBits, MinBits, SignType, unchecked, void> >::value, bool>::type
+subtract_unsigned_full_width(
+    cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>&       result,
+    const cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>& a,
+    const cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>& b) noexcept
+{
+   using cpp_int_type = cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>;
+   constexpr std::size_t limb_count = cpp_int_type::internal_limb_count;
+
+   if ((a.size() != limb_count) || (b.size() != limb_count))
+      return false;
+
+   const bool                                s  = a.sign();
+   typename cpp_int_type::const_limb_pointer pa = a.limbs();
+   typename cpp_int_type::const_limb_pointer pb = b.limbs();
+   typename cpp_int_type::limb_pointer       pr = result.limbs();
+   bool                                      swapped = false;
+   //
+   // Unsigned types just wrap around, so only signed types need to subtract the smaller
+   // magnitude from the larger:
+   //
+   if (SignType != unsigned_magnitude)
+   {
+      int c = a.compare_unsigned(b);
+      if (c == 0)
+      {
+         result = static_cast<limb_type>(0u);
+         return true;
+      }
+      if (c < 0)
+      {
+         std_constexpr::swap(pa, pb);
+         swapped = true;
+      }
+   }
+#ifdef BOOST_MP_HAS_IMMINTRIN_H
+   unsigned char borrow = 0;
+   detail::unroll<limb_count>([&](std::size_t i) {
+      borrow = ::boost::multiprecision::detail::subborrow_limb(borrow, pa[i], pb[i], pr + i);
+   });
+#else
+   double_limb_type borrow = 0;
+   detail::unroll<limb_count>([&](std::size_t i) {
+      borrow = static_cast<double_limb_type>(pa[i]) - static_cast<double_limb_type>(pb[i]) - borrow;
+      pr[i]  = static_cast<limb_type>(borrow);
+      borrow = (borrow >> cpp_int_type::limb_bits) & 1u;
+   });
+#endif
+   result.resize(limb_count, limb_count);
+   result.normalize();
+   result.sign(s);
+   if (swapped)
+      result.negate();
+   return true;
+}
 
 #ifdef BOOST_MP_HAS_IMMINTRIN_H
 //
@@ -195,6 +343,7 @@ inline BOOST_MP_CXX14_CONSTEXPR void add_unsigned(CppInt1& result, const CppInt2
    }
    else
 #endif
+   if (!add_unsigned_full_width(result, a, b))
    {
       using std::swap;
 
@@ -271,6 +420,7 @@ inline BOOST_MP_CXX14_CONSTEXPR void subtract_unsigned(CppInt1& result, const Cp
    }
    else
 #endif
+   if (!subtract_unsigned_full_width(result, a, b))
    {
       using std::swap;
 
@@ -368,13 +518,23 @@ inline BOOST_MP_CXX14_CONSTEXPR void subtract_unsigned(CppInt1& result, const Cp
 template <class CppInt1, class CppInt2, class CppInt3>
 inline BOOST_MP_CXX14_CONSTEXPR void add_unsigned(CppInt1& result, const CppInt2& a, const CppInt3& b) noexcept(is_non_throwing_cpp_int<CppInt1>::value)
 {
-   add_unsigned_constexpr(result, a, b);
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (BOOST_MP_IS_CONST_EVALUATED(a.size()) || !add_unsigned_full_width(result, a, b))
+#else
+   if (!add_unsigned_full_width(result, a, b))
+#endif
+      add_unsigned_constexpr(result, a, b);
 }
 
 template <class CppInt1, class CppInt2, class CppInt3>
 inline BOOST_MP_CXX14_CONSTEXPR void subtract_unsigned(CppInt1& result, const CppInt2& a, const CppInt3& b) noexcept(is_non_throwing_cpp_int<CppInt1>::value)
 {
-   subtract_unsigned_constexpr(result, a, b);
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (BOOST_MP_IS_CONST_EVALUATED(a.size()) || !subtract_unsigned_full_width(result, a, b))
+#else
+   if (!subtract_unsigned_full_width(result, a, b))
+#endif
+      subtract_unsigned_constexpr(result, a, b);
 }
 
 #endif
@@ -619,6 +619,110 @@ eval_modulus(
    eval_modulus(result, result, b);
 }
 
+//
+// Exact division, when the remainder is known to be zero, see:
+//
+// "An Algorithm for Exact Division", Tudor Jebelean, J Symbolic Computation, 1993 (15), 169.
+//
+// Once any common powers of 2 are removed the divisor b is odd and so invertible
+// modulo 2^limb_bits.  The quotient limbs can then be generated from the least
+// significant end: each is just the current low limb of the remainder times that inverse,
+// with no division instructions and no correction steps.  Only the low q.size() limbs
+// of the remainder ever affect the result, so each multiply-subtract pass is truncated
+// to those, which is about half the work of a long division.
+//
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_divide_exact(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& b)
+{
+   using cpp_int_type = cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>;
+
+   if ((b.size() == 1) && (*b.limbs() == 0))
+   {
+      BOOST_MP_THROW_EXCEPTION(std::overflow_error("Integer Division by zero."));
+   }
+   bool s = a.sign() != b.sign();
+   //
+   // r is our working remainder, it must be a copy as we modify it, and
+   // this also takes care of result and a being the same object:
+   //
+   cpp_int_type r(a);
+   r.sign(false);
+   if ((r.size() == 1) && (*r.limbs() == 0))
+   {
+      result = r;
+      return;
+   }
+   std::size_t shift = eval_lsb_imp(b);
+   cpp_int_type bb;
+   const cpp_int_type* pdiv = &b;
+   if (shift || (&result == &b))
+   {
+      bb = b;
+      bb.sign(false);
+      if (shift)
+      {
+         eval_right_shift(bb, shift);
+         eval_right_shift(r, shift);
+      }
+      pdiv = &bb;
+   }
+   const std::size_t bn = pdiv->size();
+   if (r.size() < bn)
+   {
+      // Can only happen if the division is not exact, the result is truncated to zero as per eval_divide:
+      result = static_cast<limb_type>(0u);
+      return;
+   }
+   const std::size_t qn = r.size() - bn + 1;
+
+   // qn <= r.size(), so this always succeeds even for fixed precision types:
+   result.resize(qn, qn);
+   BOOST_MP_ASSERT(result.size() == qn);
+   typename cpp_int_type::limb_pointer       pr = r.limbs();
+   typename cpp_int_type::limb_pointer       pq = result.limbs();
+   typename cpp_int_type::const_limb_pointer pb = pdiv->limbs();
+   //
+   // Inverse of the low limb modulo 2^limb_bits by Newton iteration, an odd b is its own inverse
+   // modulo 8, and each iteration doubles the number of correct bits:
+   //
+   limb_type inv = pb[0];
+   for (unsigned bits = 3; bits < cpp_int_type::limb_bits; bits *= 2)
+      inv *= static_cast<limb_type>(2u - pb[0] * inv);
+   BOOST_MP_ASSERT(static_cast<limb_type>(inv * pb[0]) == 1u);
+
+   for (std::size_t i = 0; i < qn; ++i)
+   {
+      limb_type q = static_cast<limb_type>(pr[i] * inv);
+      pq[i]       = q;
+      //
+      // Subtract q * b from the remainder, but only as far as limb qn - 1:
+      //
+      std::size_t      m     = (bn < qn - i) ? bn : qn - i;
+      limb_type        carry = 0;
+      for (std::size_t j = 0; j < m; ++j)
+      {
+         double_limb_type prod = static_cast<double_limb_type>(q) * pb[j] + carry;
+         limb_type        lo   = static_cast<limb_type>(prod);
+         carry                 = static_cast<limb_type>(prod >> cpp_int_type::limb_bits);
+         if (pr[i + j] < lo)
+            ++carry;
+         pr[i + j] -= lo;
+      }
+      for (std::size_t j = i + m; carry && (j < qn); ++j)
+      {
+         limb_type t = pr[j];
+         pr[j] -= carry;
+         carry = t < carry ? 1u : 0u;
+      }
+   }
+   result.normalize();
+   result.sign(s);
+}
+
 //
 // Over again for trivial cpp_int's:
 //
@@ -156,6 +156,160 @@ import_bits_fast(
    result.normalize(); // In case data has leading zeros.
    return val;
 }
+
+//
+// Reverses the bytes of a limb, for reading and writing big endian data a limb at a time:
+//
+inline limb_type byteswap_limb(limb_type v) noexcept
+{
+#if defined(__GNUC__)
+   return sizeof(limb_type) == 8 ? static_cast<limb_type>(__builtin_bswap64(static_cast<std::uint64_t>(v))) : static_cast<limb_type>(__builtin_bswap32(static_cast<std::uint32_t>(v)));
+#elif defined(_MSC_VER)
+   return sizeof(limb_type) == 8 ? static_cast<limb_type>(_byteswap_uint64(static_cast<unsigned __int64>(v))) : static_cast<limb_type>(_byteswap_ulong(static_cast<unsigned long>(v)));
+#else
+   limb_type result = 0;
+   for (std::size_t i = 0; i < sizeof(limb_type); ++i, v >>= CHAR_BIT)
+      result = static_cast<limb_type>(result << CHAR_BIT) | (v & static_cast<unsigned char>(~0u));
+   return result;
+#endif
+}
+
+//
+// Bulk import of whole chunks whose size divides that of a limb, most commonly bytes: each limb
+// is assembled directly from its chunks, with no per chunk resizing or masking.  Element k of
+// [p, p + n), counting from the least significant, is at p[n - 1 - k] when msv_first is true:
+//
+template <class T>
+inline limb_type import_limb(const T* p, std::size_t n, std::size_t k, std::size_t count, bool msv_first) noexcept
+{
+   using unsigned_value_type = typename boost::multiprecision::detail::make_unsigned<T>::type;
+   constexpr std::size_t chunk_bits = sizeof(T) * CHAR_BIT;
+   limb_type             result     = 0;
+   if (msv_first)
+   {
+      const T* q = p + (n - k - count);
+      for (std::size_t m = 0; m < count; ++m)
+         result = static_cast<limb_type>(result << (chunk_bits % (sizeof(limb_type) * CHAR_BIT))) | static_cast<limb_type>(static_cast<unsigned_value_type>(q[m]));
+   }
+   else
+   {
+      for (std::size_t m = count; m-- > 0;)
+         result = static_cast<limb_type>(result << (chunk_bits % (sizeof(limb_type) * CHAR_BIT))) | static_cast<limb_type>(static_cast<unsigned_value_type>(p[k + m]));
+   }
+   return result;
+}
+
+template <class Backend, class T>
+void import_chunks(Backend& result, const T* p, std::size_t n, bool msv_first, const std::integral_constant<bool, false>&)
+{
+   constexpr std::size_t per_limb = sizeof(limb_type) / sizeof(T);
+   //
+   // Leading zeros don't count towards the size:
+   //
+   if (msv_first)
+   {
+      while (n && !p[0])
+      {
+         ++p;
+         --n;
+      }
+   }
+   else
+   {
+      while (n && !p[n - 1])
+         --n;
+   }
+   if (result.sign())
+      result.negate();
+   std::size_t limb_count = n ? (n - 1) / per_limb + 1 : 1;
+   result.resize(limb_count, limb_count); // checked types may throw here if they're not large enough to hold the data!
+   limb_count             = result.size();
+   limb_type*  pl         = result.limbs();
+   std::size_t whole      = (std::min)(n / per_limb, limb_count);
+   std::size_t k          = 0;
+#if BOOST_MP_ENDIAN_LITTLE_BYTE && !defined(BOOST_MP_TEST_NO_LE)
+   if (!msv_first)
+   {
+      std::memcpy(pl, p, whole * sizeof(limb_type));
+      k = whole;
+   }
+   else BOOST_IF_CONSTEXPR(sizeof(T) == 1)
+   {
+      for (; k < whole; ++k)
+      {
+         limb_type l;
+         std::memcpy(&l, p + n - (k + 1) * sizeof(limb_type), sizeof(limb_type));
+         pl[k] = byteswap_limb(l);
+      }
+   }
+#endif
+   for (; k < whole; ++k)
+      pl[k] = import_limb(p, n, k * per_limb, per_limb, msv_first);
+   if (whole < limb_count)
+      pl[whole] = n % per_limb ? import_limb(p, n, whole * per_limb, n % per_limb, msv_first) : 0;
+   result.normalize();
+}
+template <class Backend, class T>
+void import_chunks(Backend& result, const T* p, std::size_t n, bool msv_first, const std::integral_constant<bool, true>&)
+{
+   using local_limb_type     = typename Backend::local_limb_type;
+   using unsigned_value_type = typename boost::multiprecision::detail::make_unsigned<T>::type;
+   constexpr std::size_t per_limb = sizeof(local_limb_type) / sizeof(T);
+   if (msv_first)
+   {
+      while (n && !p[0])
+      {
+         ++p;
+         --n;
+      }
+   }
+   else
+   {
+      while (n && !p[n - 1])
+         --n;
+   }
+   if (n > per_limb)
+      backends::detail::verify_new_size(1, 2, typename Backend::checked_type()); // Throws for checked types
+   local_limb_type value = 0;
+   for (std::size_t k = (std::min)(n, per_limb); k-- > 0;)
+      value = static_cast<local_limb_type>(value << ((sizeof(T) * CHAR_BIT) % (sizeof(local_limb_type) * CHAR_BIT))) | static_cast<local_limb_type>(static_cast<unsigned_value_type>(msv_first ? p[n - 1 - k] : p[k]));
+   if (result.sign())
+      result.negate();
+   *result.limbs() = value;
+   result.normalize();
+}
+
+template <class Backend, bool Trivial = Backend::trivial_tag::value>
+struct import_limb_size
+{
+   static constexpr std::size_t value = sizeof(limb_type);
+};
+template <class Backend>
+struct import_limb_size<Backend, true>
+{
+   static constexpr std::size_t value = sizeof(typename Backend::local_limb_type);
+};
+
+template <class T, class Backend>
+struct is_bulk_import_chunk
+{
+   static constexpr bool value = boost::multiprecision::detail::is_integral<T>::value && (sizeof(limb_type) % sizeof(T) == 0) && (import_limb_size<Backend>::value % sizeof(T) == 0) && (std::numeric_limits<typename boost::multiprecision::detail::make_unsigned<T>::type>::digits == sizeof(T) * CHAR_BIT);
+};
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates, class T>
+inline bool import_bits_bulk(number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>& val, const T* i, const T* j, std::size_t chunk_size, bool msv_first, const std::integral_constant<bool, true>&)
+{
+   using tag_type = typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::trivial_tag;
+   if (chunk_size && (chunk_size != sizeof(T) * CHAR_BIT))
+      return false;
+   import_chunks(val.backend(), i, static_cast<std::size_t>(j - i), msv_first, tag_type());
+   return true;
+}
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates, class T>
+inline bool import_bits_bulk(number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>&, const T*, const T*, std::size_t, bool, const std::integral_constant<bool, false>&)
+{
+   return false;
+}
 } // namespace detail
 
 template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates, class Iterator>
@@ -171,6 +325,8 @@ inline number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, E
 import_bits(
     number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>& val, T* i, T* j, std::size_t chunk_size = 0, bool msv_first = true)
 {
+   if (detail::import_bits_bulk(val, i, j, chunk_size, msv_first, std::integral_constant<bool, detail::is_bulk_import_chunk<T, cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value>()))
+      return val;
 #if BOOST_MP_ENDIAN_LITTLE_BYTE
    if (((chunk_size % CHAR_BIT) == 0) && !msv_first && (sizeof(*i) * CHAR_BIT == chunk_size))
       return detail::import_bits_fast(val, i, j, chunk_size);
@@ -205,6 +361,104 @@ inline std::uintmax_t extract_bits(const Backend& val, std::size_t location, std
    return (result >> location) & mask;
 }
 
+//
+// Export of chunks which never straddle limbs, reading each one directly and stepping
+// through the limbs, returns false if the chunk size is not one we handle:
+//
+template <class Backend, class OutputIterator>
+bool export_chunks_generic(const Backend& val, OutputIterator& out, std::size_t bitcount, std::size_t chunk_size, bool msv_first)
+{
+   constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+   if (!chunk_size || (chunk_size > limb_bits) || (limb_bits % chunk_size))
+      return false;
+   const limb_type*  pl     = val.limbs();
+   const limb_type   mask   = chunk_size == limb_bits ? ~static_cast<limb_type>(0) : (static_cast<limb_type>(1u) << chunk_size) - 1;
+   const std::size_t chunks = (bitcount - 1) / chunk_size + 1;
+   std::size_t       limb   = msv_first ? (chunks - 1) * chunk_size / limb_bits : 0;
+   std::size_t       shift  = msv_first ? (chunks - 1) * chunk_size % limb_bits : 0;
+   for (std::size_t c = 0; c < chunks; ++c)
+   {
+      *out = (pl[limb] >> shift) & mask;
+      ++out;
+      if (msv_first)
+      {
+         if (!shift)
+         {
+            shift = limb_bits;
+            --limb;
+         }
+         shift -= chunk_size;
+      }
+      else if ((shift += chunk_size) == limb_bits)
+      {
+         shift = 0;
+         ++limb;
+      }
+   }
+   return true;
+}
+template <class Backend, class OutputIterator>
+bool export_chunks(const Backend& val, OutputIterator& out, std::size_t bitcount, std::size_t chunk_size, bool msv_first, const std::integral_constant<bool, false>&)
+{
+   return export_chunks_generic(val, out, bitcount, chunk_size, msv_first);
+}
+template <class Backend, class OutputIterator>
+bool export_chunks(const Backend&, OutputIterator&, std::size_t, std::size_t, bool, const std::integral_constant<bool, true>&)
+{
+   return false;
+}
+
+//
+// Writes the low bytes * CHAR_BIT bits of the magnitude of val to [p, p + bytes), zero padded, most
+// significant byte first when msv_first is true:
+//
+template <class Backend>
+void export_bytes(const Backend& val, unsigned char* p, std::size_t bytes, bool msv_first, const std::integral_constant<bool, false>&)
+{
+   const std::size_t n  = (std::min)(bytes, val.size() * sizeof(limb_type));
+   const limb_type*  pl = val.limbs();
+   std::size_t       k  = 0;
+#if BOOST_MP_ENDIAN_LITTLE_BYTE && !defined(BOOST_MP_TEST_NO_LE)
+   if (!msv_first)
+   {
+      std::memcpy(p, pl, n);
+      k = n;
+   }
+   for (; k + sizeof(limb_type) <= n; k += sizeof(limb_type))
+   {
+      const limb_type l = byteswap_limb(pl[k / sizeof(limb_type)]);
+      std::memcpy(p + bytes - k - sizeof(limb_type), &l, sizeof(limb_type));
+   }
+#endif
+   for (; k < n; ++k)
+      p[msv_first ? bytes - 1 - k : k] = static_cast<unsigned char>(pl[k / sizeof(limb_type)] >> (CHAR_BIT * (k % sizeof(limb_type))));
+   if (msv_first)
+      std::memset(p, 0, bytes - n);
+   else
+      std::memset(p + n, 0, bytes - n);
+}
+template <class Backend>
+void export_bytes(const Backend& val, unsigned char* p, std::size_t bytes, bool msv_first, const std::integral_constant<bool, true>&)
+{
+   const typename Backend::local_limb_type l = *val.limbs();
+   for (std::size_t k = 0; k < bytes; ++k)
+      p[msv_first ? bytes - 1 - k : k] = k < sizeof(l) ? static_cast<unsigned char>(l >> (CHAR_BIT * k)) : 0;
+}
+
+//
+// Bytes written through a pointer are copied a limb at a time:
+//
+template <class Backend>
+bool export_chunks(const Backend& val, unsigned char*& out, std::size_t bitcount, std::size_t chunk_size, bool msv_first, const std::integral_constant<bool, false>& tag)
+{
+   if (chunk_size != CHAR_BIT)
+      return export_chunks_generic(val, out, bitcount, chunk_size, msv_first);
+   const std::size_t bytes = (bitcount - 1) / CHAR_BIT + 1;
+   export_bytes(val, out, bytes, msv_first, tag);
+   out += bytes;
+   return true;
+}
+
 } // namespace detail
 
 template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates, class OutputIterator>
@@ -224,6 +478,9 @@ OutputIterator export_bits(
    }
    std::size_t bitcount = boost::multiprecision::backends::eval_msb_imp(val.backend()) + 1;
 
+   if (detail::export_chunks(val.backend(), out, bitcount, chunk_size, msv_first, tag_type()))
+      return out;
+
          std::ptrdiff_t bit_location = msv_first ? static_cast<std::ptrdiff_t>(bitcount - chunk_size) : 0;
    const std::ptrdiff_t bit_step     = msv_first ? static_cast<std::ptrdiff_t>(-static_cast<std::ptrdiff_t>(chunk_size)) : static_cast<std::ptrdiff_t>(chunk_size);
    while (bit_location % bit_step)
@@ -1405,16 +1405,39 @@ eval_msb(const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocato
    return eval_msb_imp(a);
 }
 
-template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
-inline BOOST_MP_CXX14_CONSTEXPR std::size_t hash_value(const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& val) noexcept
+//
+// Hashes the magnitude of a cpp_int, seed distinguishes the sign.  Trivial values are split
+// into limbs just as an arbitrary precision value would hold them, so that the hash depends
+// only on the value and not on the type:
+//
+template <class CppInt>
+inline BOOST_MP_CXX14_CONSTEXPR std::size_t hash_magnitude(const CppInt& val, std::uint64_t seed, const std::integral_constant<bool, false>&) noexcept
 {
-   std::size_t result = 0;
-   for (std::size_t i = 0; i < val.size(); ++i)
+   return boost::multiprecision::detail::hash_words(val.limbs(), val.size(), seed);
+}
+template <class CppInt>
+inline BOOST_MP_CXX14_CONSTEXPR std::size_t hash_magnitude(const CppInt& val, std::uint64_t seed, const std::integral_constant<bool, true>&) noexcept
+{
+   using local_limb_type = typename CppInt::local_limb_type;
+   constexpr unsigned    half_limb = sizeof(limb_type) * CHAR_BIT / 2;
+   const local_limb_type v         = *val.limbs();
+   limb_type             w[2]      = {static_cast<limb_type>(v), 0};
+   std::size_t           n         = 1;
+   BOOST_IF_CONSTEXPR(sizeof(local_limb_type) > sizeof(limb_type))
    {
-      boost::multiprecision::detail::hash_combine(result, val.limbs()[i]);
+      w[1] = static_cast<limb_type>(v >> half_limb >> half_limb);
+      if (w[1])
+         n = 2;
    }
-   boost::multiprecision::detail::hash_combine(result, val.sign());
-   return result;
+   return boost::multiprecision::detail::hash_words(w, n, seed);
+}
+
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline BOOST_MP_CXX14_CONSTEXPR std::size_t hash_value(const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& val) noexcept
+{
+   using trivial_tag = std::integral_constant<bool, is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>;
+   const bool negative = val.sign() && ((val.size() > 1) || *val.limbs());
+   return hash_magnitude(val, negative ? boost::multiprecision::detail::hash_secret3 : 0u, trivial_tag());
 }
 
 #ifdef BOOST_MSVC
@@ -1425,6 +1448,10 @@ inline BOOST_MP_CXX14_CONSTEXPR std::size_t hash_value(const cpp_int_backend<Min
 
 namespace detail {
 
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+struct is_avalanching_hash<backends::cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> > : public std::integral_constant<bool, true>
+{};
+
 #ifndef BOOST_MP_STANDALONE
 template <typename T>
 inline BOOST_CXX14_CONSTEXPR T constexpr_gcd(T a, T b) noexcept
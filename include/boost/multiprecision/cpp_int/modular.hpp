@@ -0,0 +1,382 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Modular reduction by special form moduli for cpp_int_backend:
+//
+#ifndef BOOST_MP_CPP_INT_MODULAR_HPP
+#define BOOST_MP_CPP_INT_MODULAR_HPP
+
+#include <climits>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/multiprecision/detail/constexpr.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+
+namespace boost { namespace multiprecision {
+namespace detail {
+
+//
+// A cheap test on the limbs of m > 0 which rules out most moduli which are not of special
+// form, without copying m: for |c| <= 2^(k/2 + 1) the bits of m from b/2 + 2 up to, but not
+// including, its most significant bit b are either all zeros or all ones:
+//
+template <class Backend>
+bool is_special_modulus_candidate(const Backend& m)
+{
+   constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const std::size_t     n         = m.size();
+   const limb_type*      p         = m.limbs();
+   const std::size_t     b         = (n - 1) * limb_bits + find_msb(p[n - 1]);
+   const std::size_t     lo        = b / 2 + 2;
+   bool                  zeros = true, ones = true;
+   for (std::size_t i = lo / limb_bits; (lo < b) && (i <= (b - 1) / limb_bits) && (zeros || ones); ++i)
+   {
+      limb_type mask = ~static_cast<limb_type>(0u);
+      if (i == lo / limb_bits)
+         mask &= ~static_cast<limb_type>(0u) << (lo % limb_bits);
+      if (i == b / limb_bits)
+         mask &= (static_cast<limb_type>(1u) << (b % limb_bits)) - 1u;
+      zeros = zeros && !(p[i] & mask);
+      ones  = ones && ((p[i] & mask) == mask);
+   }
+   return zeros || ones;
+}
+
+//
+// A modulus of the form m = 2^k - c, with |c| < 2^(k/2 + 1): this covers Mersenne numbers
+// 2^k - 1, pseudo-Mersenne primes such as 2^255 - 19 and 2^256 - 2^32 - 977, and Solinas
+// primes 2^k - 2^j +- 1 such as 2^448 - 2^224 - 1, or 2^k + 1 and the like, for j <= k/2.
+// Since 2^k = c mod m, writing x = h * 2^k + l gives x = h * c + l mod m, and each such
+// fold removes at least k/2 - 1 bits from x with a shift, a mask and either a multiplication
+// by the short value c, or when c has few non-zero digits in its non-adjacent form, a few
+// more shifts and additions.
+//
+template <class Integer>
+class special_modulus
+{
+ public:
+   //
+   // The smallest modulus considered, below this division is as fast:
+   //
+   static constexpr std::size_t min_limbs = 2;
+
+   //
+   // Returns true if m > 0 is of special form and sets up the reduction, otherwise returns false.
+   // Integer must be signed and have room for m^2 * 2^limb_bits:
+   //
+   bool init(const Integer& m)
+   {
+      const std::size_t n = m.backend().size();
+      if ((n < min_limbs) || (m.sign() <= 0) || !is_special_modulus_candidate(m.backend()))
+         return false;
+      const std::size_t b = msb(m);
+      // m = 2^(b+1) - c with c > 0, or m = 2^b - c with c <= 0:
+      Integer below(m), above(0u);
+      bit_unset(below, b);
+      bit_set(above, b + 1);
+      above -= m;
+      if (below < above)
+      {
+         m_k          = b;
+         m_c          = below;
+         m_c_negative = !m_c.is_zero();
+      }
+      else
+      {
+         m_k          = b + 1;
+         m_c          = above;
+         m_c_negative = false;
+      }
+      if (!m_c.is_zero() && (msb(m_c) > m_k / 2))
+         return false;
+      m_modulus = m;
+      //
+      // Try for the non-adjacent form of |c|, giving up if it has too many digits to be
+      // worth replacing the multiplication, which is a single pass when c fits in a limb:
+      //
+      m_term_count = 0;
+      Integer     v(m_c);
+      std::size_t shift = 0;
+      while (!v.is_zero() && (m_term_count < max_terms))
+      {
+         const std::size_t z = lsb(v);
+         v >>= z;
+         shift += z;
+         const bool negative_digit = (v.backend().limbs()[0] & 3u) != 1u;
+         m_terms[m_term_count++]   = std::make_pair(shift, negative_digit != m_c_negative);
+         if (negative_digit)
+            ++v;
+         else
+            --v;
+      }
+      m_sparse = v.is_zero() && ((m_term_count == 1) || (m_c.backend().size() > 1));
+      return true;
+   }
+
+   const Integer& modulus() const { return m_modulus; }
+
+   //
+   // Sets x to x mod m in [0, m) for any x < 2^limb_bits * m^2 in magnitude, h and t are scratch space:
+   //
+   void reduce(Integer& x, Integer& h, Integer& t) const
+   {
+      // The value is +-x, the sign kept separately so that the folds work on magnitudes:
+      bool negative = x.sign() < 0;
+      if (negative)
+         x.backend().negate();
+      while (!x.is_zero() && (msb(x) >= m_k))
+      {
+         h = x;
+         h >>= m_k;
+         truncate(x);
+         if (m_sparse)
+         {
+            for (std::size_t i = 0; i < m_term_count; ++i)
+            {
+               t = h;
+               t <<= m_terms[i].first;
+               if (m_terms[i].second)
+                  x -= t;
+               else
+                  x += t;
+            }
+         }
+         else
+         {
+            multiply(t, h, m_c);
+            if (m_c_negative)
+               x -= t;
+            else
+               x += t;
+         }
+         if (x.sign() < 0)
+         {
+            x.backend().negate();
+            negative = !negative;
+         }
+      }
+      // |x| < 2^k which is at most m + c:
+      while (x >= m_modulus)
+         x -= m_modulus;
+      if (negative && !x.is_zero())
+      {
+         x -= m_modulus;
+         x.backend().negate();
+      }
+   }
+
+ private:
+   static constexpr std::size_t max_terms = 4;
+
+   // x = x mod 2^k for x >= 0:
+   void truncate(Integer& x) const
+   {
+      constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+      const std::size_t     n         = m_k / limb_bits + 1;
+      if (x.backend().size() >= n)
+      {
+         x.backend().resize(n, n);
+         x.backend().limbs()[n - 1] &= (static_cast<limb_type>(1u) << (m_k % limb_bits)) - 1u;
+         x.backend().normalize();
+      }
+   }
+
+   Integer                             m_modulus, m_c;
+   std::size_t                         m_k          = 0;
+   bool                                m_c_negative = false;
+   bool                                m_sparse     = false;
+   std::size_t                         m_term_count = 0;
+   std::pair<std::size_t, bool>        m_terms[max_terms]; // shifts of c's non-adjacent form, with true to subtract.
+};
+
+//
+// The type in which special form reductions are done for a cpp_int_backend: signed, and
+// for fixed precision types wide enough for the square of the modulus.
+//
+template <class Backend, bool Fixed = backends::is_fixed_precision<Backend>::value>
+struct special_modulus_work_type
+{
+   using type = cpp_int;
+};
+template <class Backend>
+struct special_modulus_work_type<Backend, true>
+{
+   static constexpr std::size_t bits = 2 * backends::max_precision<Backend>::value + sizeof(limb_type) * CHAR_BIT;
+   using type                        = number<cpp_int_backend<bits, bits, signed_magnitude, unchecked, void>, et_off>;
+};
+
+//
+// result = b^e mod m by square and multiply, for b, e >= 0:
+//
+template <class Integer>
+void special_modulus_powm(Integer& result, const Integer& b, const Integer& e, const special_modulus<Integer>& m)
+{
+   Integer y(b), t, h, s;
+   m.reduce(y, h, s);
+   result                 = 1u;
+   const std::size_t bits = e.is_zero() ? 0 : msb(e) + 1;
+   for (std::size_t i = 0; i < bits; ++i)
+   {
+      if (bit_test(e, static_cast<unsigned>(i)))
+      {
+         multiply(t, result, y);
+         m.reduce(t, h, s);
+         result.swap(t);
+      }
+      if (i + 1 < bits)
+      {
+         multiply(t, y, y);
+         m.reduce(t, h, s);
+         y.swap(t);
+      }
+   }
+}
+
+} // namespace detail
+
+namespace backends {
+
+//
+// Computes a^p mod c and returns true if c is of special form, otherwise returns false.
+// Only called with a, p >= 0 and c > 0.  Most other moduli are rejected from their limbs
+// before anything is copied:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, class Exponent>
+bool eval_powm_special_modulus(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& a, const Exponent& p, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& c)
+{
+   using work_type = typename boost::multiprecision::detail::special_modulus_work_type<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::type;
+
+   if (!boost::multiprecision::detail::is_special_modulus_candidate(c))
+      return false;
+   boost::multiprecision::detail::special_modulus<work_type> mod;
+   if (!mod.init(work_type(c)))
+      return false;
+   work_type r;
+   boost::multiprecision::detail::special_modulus_powm(r, work_type(a), work_type(p), mod);
+   result = r.backend();
+   return true;
+}
+
+//
+// powm with a special form modulus reduces by shifts and additions rather than division,
+// other moduli, negative values and constant evaluation go to the generic code:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline BOOST_CXX14_CONSTEXPR_IF_DETECTION typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value>::type
+eval_powm(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& a, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& p, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& c)
+{
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(c.size()))
+#endif
+   {
+      if ((c.size() >= 2) && !a.sign() && !p.sign() && !c.sign() && eval_powm_special_modulus(result, a, p, c))
+         return;
+   }
+   default_ops::eval_powm(result, a, p, c);
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, class Integer>
+inline BOOST_CXX14_CONSTEXPR_IF_DETECTION typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value && boost::multiprecision::detail::is_unsigned<Integer>::value>::type
+eval_powm(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& a, Integer p, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& c)
+{
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(c.size()))
+#endif
+   {
+      if ((c.size() >= 2) && !a.sign() && !c.sign() && eval_powm_special_modulus(result, a, p, c))
+         return;
+   }
+   default_ops::eval_powm(result, a, p, c);
+}
+
+} // namespace backends
+
+//
+// Modular arithmetic by a fixed modulus m > 0 of cpp_int type, using shift and add reduction
+// when m is of special form (see detail::special_modulus above), and division otherwise.
+// All results are in [0, m), and products are formed at full width, so the fixed precision
+// types may be used for any m that fits.
+//
+template <class Integer>
+class modular_context
+{
+   using work_type = typename detail::special_modulus_work_type<typename Integer::backend_type>::type;
+
+ public:
+   explicit modular_context(const Integer& m) : m_modulus(m), m_work_modulus(m)
+   {
+      if (m.sign() <= 0)
+         BOOST_MP_THROW_EXCEPTION(std::domain_error("The modulus must be positive."));
+      m_is_special = m_special.init(m_work_modulus);
+   }
+
+   const Integer& modulus() const { return m_modulus; }
+   // True when reduction is by shifts and additions:
+   bool is_special_form() const { return m_is_special; }
+
+   Integer reduce(const Integer& x) const
+   {
+      work_type r(x);
+      reduce_imp(r);
+      return static_cast<Integer>(r);
+   }
+   Integer multiply(const Integer& a, const Integer& b) const
+   {
+      work_type r;
+      boost::multiprecision::multiply(r, work_type(a), work_type(b));
+      reduce_imp(r);
+      return static_cast<Integer>(r);
+   }
+   Integer square(const Integer& a) const
+   {
+      work_type r(a);
+      r *= r;
+      reduce_imp(r);
+      return static_cast<Integer>(r);
+   }
+   //
+   // b^e mod m, throws a std::runtime_error if e < 0, as the other powm overloads do:
+   //
+   Integer powm(const Integer& b, const Integer& e) const
+   {
+      if (e.sign() < 0)
+         BOOST_MP_THROW_EXCEPTION(std::runtime_error("powm requires a positive exponent."));
+      work_type r(b), x;
+      reduce_imp(r);
+      if (m_is_special)
+         detail::special_modulus_powm(x, r, work_type(e), m_special);
+      else
+         x = boost::multiprecision::powm(r, work_type(e), m_work_modulus);
+      return static_cast<Integer>(x);
+   }
+
+ private:
+   void reduce_imp(work_type& x) const
+   {
+      if (m_is_special)
+      {
+         work_type h, t;
+         m_special.reduce(x, h, t);
+      }
+      else
+      {
+         x %= m_work_modulus;
+         if (x.sign() < 0)
+            x += m_work_modulus;
+      }
+   }
+
+   Integer                            m_modulus;
+   work_type                          m_work_modulus;
+   detail::special_modulus<work_type> m_special;
+   bool                               m_is_special;
+};
+
+}} // namespace boost::multiprecision
+
+#endif
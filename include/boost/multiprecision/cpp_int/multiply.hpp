@@ -15,8 +15,52 @@
 #include <boost/multiprecision/detail/endian.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
 #include <boost/multiprecision/integer.hpp>
+#include <boost/multiprecision/cpp_int/mulx_adx.hpp>
+#include <boost/multiprecision/detail/parallel.hpp>
 
-namespace boost { namespace multiprecision { namespace backends {
+#ifdef BOOST_HAS_THREADS
+#include <atomic>
+#endif
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+#ifdef BOOST_HAS_THREADS
+inline std::atomic<std::size_t>& cpp_int_multiply_threads_value()
+{
+   static std::atomic<std::size_t> value(1);
+   return value;
+}
+#endif
+
+} // namespace detail
+
+//
+// The number of threads over which the multiplication of very large cpp_int's is shared
+// out, the default is 1, ie everything happens on the calling thread.  Only products
+// large enough to reach Karatsuba recursion levels where both arguments have at least
+// BOOST_MP_KARATSUBA_PARALLEL_CUTOFF limbs are affected:
+//
+inline std::size_t cpp_int_multiply_threads()
+{
+#ifdef BOOST_HAS_THREADS
+   return detail::cpp_int_multiply_threads_value().load(std::memory_order_relaxed);
+#else
+   return 1;
+#endif
+}
+
+inline void cpp_int_multiply_threads(std::size_t n)
+{
+#ifdef BOOST_HAS_THREADS
+   detail::cpp_int_multiply_threads_value().store(n ? n : 1, std::memory_order_relaxed);
+#else
+   static_cast<void>(n);
+#endif
+}
+
+namespace backends {
 
 #ifdef BOOST_MSVC
 #pragma warning(push)
@@ -43,6 +87,17 @@ eval_multiply(
    typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer       p     = result.limbs();
    typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer       pe    = result.limbs() + result.size();
    typename cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>::const_limb_pointer pa    = a.limbs();
+#ifdef BOOST_MP_HAS_MULX_ADX
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(val) && ::boost::multiprecision::detail::has_mulx_adx())
+#else
+   if (::boost::multiprecision::detail::has_mulx_adx())
+#endif
+   {
+      carry = ::boost::multiprecision::detail::mulx_mul_1(p, pa, result.size(), val);
+      p     = pe;
+   }
+#endif
    while (p != pe)
    {
       carry += static_cast<double_limb_type>(*pa) * static_cast<double_limb_type>(val);
@@ -89,17 +144,33 @@ const size_t karatsuba_cutoff = BOOST_MP_KARATSUBA_CUTOFF;
 const size_t karatsuba_cutoff = 40;
 #endif
 //
+// Minimum number of limbs in both arguments before the three sub-products at a level of
+// Karatsuba recursion are run on separate threads, see cpp_int_multiply_threads():
+//
+#ifdef BOOST_MP_KARATSUBA_PARALLEL_CUTOFF
+const size_t karatsuba_parallel_cutoff = BOOST_MP_KARATSUBA_PARALLEL_CUTOFF;
+#else
+const size_t karatsuba_parallel_cutoff = 2048;
+#endif
+//
 // Core (recursive) Karatsuba multiplication, all the storage required is allocated upfront and 
 // passed down the stack in this routine.  Note that all the cpp_int_backend's must be the same type
 // and full variable precision.  Karatsuba really doesn't play nice with fixed-size integers.  If necessary
 // fixed precision integers will get aliased as variable-precision types before this is called.
 //
+// When threads > 1 and both arguments have at least karatsuba_parallel_cutoff limbs, the three
+// sub-products are shared out over up to that many threads: the first uses the storage passed
+// in, the others allocate their own, as the shared storage is a simple stack.
+//
+inline std::size_t karatsuba_storage_size(std::size_t s);
+
 template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
 inline void multiply_karatsuba(
     cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
     const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
     const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
-    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage,
+    std::size_t threads = 1)
 {
    using cpp_int_type = cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>;
 
@@ -164,31 +235,65 @@ inline void multiply_karatsuba(
    //
    cpp_int_type result_low(result.limbs(), 0, 2 * n);
    cpp_int_type result_high(result.limbs(), 2 * n, result.size() - 2 * n);
-   //
-   // low part of result is a_l * b_l:
-   //
-   multiply_karatsuba(result_low, a_l, b_l, storage);
-   //
-   // We haven't zeroed out memory in result, so set to zero any unused limbs,
-   // if a_l and b_l have mostly random bits then nothing happens here, but if
-   // one is zero or nearly so, then a memset might be faster... it's not clear
-   // that it's worth the extra logic though (and is darn hard to measure
-   // what the "average" case is).
-   //
-   for (std::size_t i = result_low.size(); i < 2 * n; ++i)
-      result.limbs()[i] = 0;
-   //
-   // Set the high part of result to a_h * b_h:
-   //
-   multiply_karatsuba(result_high, a_h, b_h, storage);
-   for (std::size_t i = result_high.size() + 2 * n; i < result.size(); ++i)
-      result.limbs()[i] = 0;
-   //
-   // Now calculate (a_h+a_l)*(b_h+b_l):
-   //
-   add_unsigned(t2, a_l, a_h);
-   add_unsigned(t3, b_l, b_h);
-   multiply_karatsuba(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+
+   if ((threads > 1) && (as >= karatsuba_parallel_cutoff) && (bs >= karatsuba_parallel_cutoff))
+   {
+      //
+      // The three products write to disjoint memory, so can all run at once.  Each worker
+      // gets a share of the threads in proportion to the products it runs, and runs them
+      // one after another, so that no more than "threads" are ever busy:
+      //
+      add_unsigned(t2, a_l, a_h);
+      add_unsigned(t3, b_l, b_h);
+      ::boost::multiprecision::detail::parallel_for(0, 3, (std::min)(threads, std::size_t(3)), [&](std::size_t first, std::size_t last) {
+         const std::size_t sub_threads = (std::max)(std::size_t(1), threads * last / 3 - threads * first / 3);
+         for (std::size_t i = first; i < last; ++i)
+         {
+            if (i == 0)
+               multiply_karatsuba(result_low, a_l, b_l, storage, sub_threads);
+            else
+            {
+               typename cpp_int_type::scoped_shared_storage sub_storage(result.allocator(), karatsuba_storage_size(n + 1));
+               if (i == 1)
+                  multiply_karatsuba(result_high, a_h, b_h, sub_storage, sub_threads);
+               else
+                  multiply_karatsuba(t1, t2, t3, sub_storage, sub_threads);
+            }
+         }
+      });
+      for (std::size_t i = result_low.size(); i < 2 * n; ++i)
+         result.limbs()[i] = 0;
+      for (std::size_t i = result_high.size() + 2 * n; i < result.size(); ++i)
+         result.limbs()[i] = 0;
+   }
+   else
+   {
+      //
+      // low part of result is a_l * b_l:
+      //
+      multiply_karatsuba(result_low, a_l, b_l, storage);
+      //
+      // We haven't zeroed out memory in result, so set to zero any unused limbs,
+      // if a_l and b_l have mostly random bits then nothing happens here, but if
+      // one is zero or nearly so, then a memset might be faster... it's not clear
+      // that it's worth the extra logic though (and is darn hard to measure
+      // what the "average" case is).
+      //
+      for (std::size_t i = result_low.size(); i < 2 * n; ++i)
+         result.limbs()[i] = 0;
+      //
+      // Set the high part of result to a_h * b_h:
+      //
+      multiply_karatsuba(result_high, a_h, b_h, storage);
+      for (std::size_t i = result_high.size() + 2 * n; i < result.size(); ++i)
+         result.limbs()[i] = 0;
+      //
+      // Now calculate (a_h+a_l)*(b_h+b_l):
+      //
+      add_unsigned(t2, a_l, a_h);
+      add_unsigned(t3, b_l, b_h);
+      multiply_karatsuba(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+   }
    //
    // There is now a slight deviation from Karatsuba, we want to subtract
    // a_l*b_l + a_h*b_h from t1, but rather than use an addition and a subtraction
@@ -261,7 +366,7 @@ setup_karatsuba(
    else
    {
       typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::scoped_shared_storage storage(result.allocator(), storage_size);
-      multiply_karatsuba(result, a, b, storage);
+      multiply_karatsuba(result, a, b, storage, ::boost::multiprecision::cpp_int_multiply_threads());
    }
 }
 
@@ -294,7 +399,7 @@ setup_karatsuba(
       result.resize(sz, sz);
       variable_precision_type t(result.limbs(), 0, result.size());
       typename variable_precision_type::scoped_shared_storage storage(t.allocator(), storage_size);
-      multiply_karatsuba(t, a_t, b_t, storage);
+      multiply_karatsuba(t, a_t, b_t, storage, ::boost::multiprecision::cpp_int_multiply_threads());
       result.resize(t.size(), t.size());
    }
    else
@@ -305,7 +410,7 @@ setup_karatsuba(
       //
       typename variable_precision_type::scoped_shared_storage storage(variable_precision_type::allocator_type(), sz + storage_size);
       variable_precision_type t(storage, sz);
-      multiply_karatsuba(t, a_t, b_t, storage);
+      multiply_karatsuba(t, a_t, b_t, storage, ::boost::multiprecision::cpp_int_multiply_threads());
       //
       // If there is truncation, and result is a checked type then this will throw:
       //
@@ -333,7 +438,7 @@ setup_karatsuba(
    result.resize(sz, sz);
    variable_precision_type t(result.limbs(), 0, result.size());
    typename variable_precision_type::scoped_shared_storage storage(t.allocator(), storage_size);
-   multiply_karatsuba(t, a_t, b_t, storage);
+   multiply_karatsuba(t, a_t, b_t, storage, ::boost::multiprecision::cpp_int_multiply_threads());
 }
 
 template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, std::size_t MinBits2, std::size_t MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, std::size_t MinBits3, std::size_t MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
@@ -386,6 +491,71 @@ eval_multiply_comba(
          *pr = static_cast<limb_type>(carry);
    }
 }
+//
+// Full width multiplication for the unchecked fixed precision types up to 512 bits
+// (see is_unrolled_fixed_cpp_int): when both arguments use every limb only the low
+// limbs of the product are computed, and as the limb count is a compile time constant
+// the loops unroll completely.  Wider types gain nothing over the schoolbook rows.
+// Returns false if the arguments are not suitable, in which case the caller does the
+// work instead:
+//
+template <class CppInt1, class CppInt2, class CppInt3>
+inline constexpr bool eval_multiply_full_width(CppInt1&, const CppInt2&, const CppInt3&) noexcept
+{
+   return false;
+}
+
+namespace detail {
+//
+// Row I of the unrolled product: adds pa[I] * pb into tr, keeping only the low N limbs.
+// A generic lambda would do, but those are C++14:
+//
+template <std::size_t N>
+struct multiply_full_width_row
+{
+   const limb_type* pa;
+   const limb_type* pb;
+   limb_type*       tr;
+
+   template <std::size_t I>
+   BOOST_MP_FORCEINLINE void operator()(std::integral_constant<std::size_t, I>) const
+   {
+      double_limb_type carry = 0;
+      unroll<N - I>([&](std::size_t j) {
+         carry += static_cast<double_limb_type>(pa[I]) * static_cast<double_limb_type>(pb[j]) + tr[I + j];
+         tr[I + j] = static_cast<limb_type>(carry);
+         carry >>= sizeof(limb_type) * CHAR_BIT;
+      });
+   }
+};
+} // namespace detail
+
+template <std::size_t MinBits, cpp_integer_type SignType>
+inline typename std::enable_if<is_unrolled_fixed_cpp_int<cpp_int_backend<MinBits, MinBits, SignType, unchecked, void> >::value && (MinBits <= 512), bool>::type
+eval_multiply_full_width(
+    cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>&       result,
+    const cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>& a,
+    const cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>& b) noexcept
+{
+   using cpp_int_type = cpp_int_backend<MinBits, MinBits, SignType, unchecked, void>;
+   constexpr std::size_t limb_count = cpp_int_type::internal_limb_count;
+
+   if ((a.size() != limb_count) || (b.size() != limb_count))
+      return false;
+
+   typename cpp_int_type::const_limb_pointer pa = a.limbs();
+   typename cpp_int_type::const_limb_pointer pb = b.limbs();
+   limb_type                                 tr[limb_count] = {0};
+   const bool                                s = a.sign() != b.sign();
+
+   detail::unroll<limb_count>(detail::multiply_full_width_row<limb_count>{pa, pb, tr});
+   result.resize(limb_count, limb_count);
+   std::memcpy(result.limbs(), tr, sizeof(tr));
+   result.normalize();
+   result.sign(s);
+   return true;
+}
+
 template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, std::size_t MinBits2, std::size_t MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, std::size_t MinBits3, std::size_t MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
 inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits3, MaxBits3, SignType3, Checked3, Allocator3> >::value>::type
 eval_multiply(
@@ -400,6 +570,15 @@ eval_multiply(
    // Uses simple (O(n^2)) multiplication when the limbs are less
    // otherwise switches to karatsuba algorithm based on experimental value (~40 limbs)
    //
+   // Unrolled full width multiplication for small fixed precision types:
+   //
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(a.size()) && eval_multiply_full_width(result, a, b))
+#else
+   if (eval_multiply_full_width(result, a, b))
+#endif
+      return;
+   //
    // Trivial cases first:
    //
    std::size_t                                                                                          as = a.size();
@@ -483,11 +662,29 @@ eval_multiply(
 #else
 
    double_limb_type carry = 0;
+#ifdef BOOST_MP_HAS_MULX_ADX
+   //
+   // Use the MULX/ADCX/ADOX kernel when the CPU supports it, each row is
+   // then a single call accumulating pb * pa[i] into the result:
+   //
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   bool use_mulx_adx = !BOOST_MP_IS_CONST_EVALUATED(as) && ::boost::multiprecision::detail::has_mulx_adx();
+#else
+   bool use_mulx_adx = ::boost::multiprecision::detail::has_mulx_adx();
+#endif
+#endif
    for (std::size_t i = 0; i < as; ++i)
    {
       BOOST_MP_ASSERT(result.size() > i);
       std::size_t inner_limit = !is_fixed_precision<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value ? bs : (std::min)(result.size() - i, bs);
       std::size_t j           = 0;
+#ifdef BOOST_MP_HAS_MULX_ADX
+      if (use_mulx_adx)
+      {
+         carry = ::boost::multiprecision::detail::mulx_addmul_1(pr + i, pb, inner_limit, pa[i]);
+         j     = inner_limit;
+      }
+#endif
       for (; j < inner_limit; ++j)
       {
          BOOST_MP_ASSERT(i + j < result.size());
@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// x86-64 BMI2/ADX multiplication kernels for cpp_int_backend.
+//
+// MULX leaves the flags alone, and ADCX/ADOX propagate carries through CF and OF
+// respectively, so r += a * b can run two independent carry chains: one for
+// the low halves of the products and one for the high halves.  The compiler
+// can not generate this from portable code, so these are written as inline
+// assembler, and are selected at runtime via CPUID.
+//
+#ifndef BOOST_MP_CPP_INT_MULX_ADX_HPP
+#define BOOST_MP_CPP_INT_MULX_ADX_HPP
+
+#include <cstddef>
+#include <boost/multiprecision/cpp_int/cpp_int_config.hpp>
+
+#if !defined(BOOST_MP_NO_MULX_ADX) && defined(BOOST_HAS_INT128) && defined(__GNUC__) && !defined(BOOST_INTEL) \
+   && (defined(__x86_64__) || defined(__amd64__)) && defined(__has_include)
+#if __has_include(<cpuid.h>)
+#include <cpuid.h>
+#define BOOST_MP_HAS_MULX_ADX
+#endif
+#endif
+
+#ifdef BOOST_MP_HAS_MULX_ADX
+
+namespace boost { namespace multiprecision { namespace detail {
+
+inline bool detect_mulx_adx()
+{
+   unsigned eax, ebx, ecx, edx;
+   if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+      return false;
+   // EBX bit 8 is BMI2 (MULX), bit 19 is ADX (ADCX/ADOX):
+   return (ebx & (1u << 8)) && (ebx & (1u << 19));
+}
+
+inline bool has_mulx_adx()
+{
+   static const bool result = detect_mulx_adx();
+   return result;
+}
+
+//
+// r[0..n) = a[0..n) * b, returns the carry limb.  r may be the same as a.
+// Requires n > 0.
+//
+inline limb_type mulx_mul_1(limb_type* r, const limb_type* a, std::size_t n, limb_type b)
+{
+   limb_type   carry, lo, hi;
+   std::size_t blocks = n / 4;
+   n %= 4;
+   __asm__(
+       "xorl %k[c], %k[c]\n\t"   // carry = 0, clears CF
+       "jrcxz 2f\n"
+       "1:\n\t"
+       "mulx (%[a]), %[lo], %[hi]\n\t"
+       "adcx %[c], %[lo]\n\t"
+       "movq %[lo], (%[r])\n\t"
+       "movq %[hi], %[c]\n\t"
+       "leaq 8(%[a]), %[a]\n\t"
+       "leaq 8(%[r]), %[r]\n\t"
+       "leaq -1(%%rcx), %%rcx\n\t"
+       "jrcxz 2f\n\t"
+       "jmp 1b\n"
+       "2:\n\t"
+       "movq %[blocks], %%rcx\n\t"
+       "jrcxz 4f\n"
+       "3:\n\t"
+       "mulx (%[a]), %[lo], %[hi]\n\t"
+       "adcx %[c], %[lo]\n\t"
+       "movq %[lo], (%[r])\n\t"
+       "mulx 8(%[a]), %[lo], %[c]\n\t"
+       "adcx %[hi], %[lo]\n\t"
+       "movq %[lo], 8(%[r])\n\t"
+       "mulx 16(%[a]), %[lo], %[hi]\n\t"
+       "adcx %[c], %[lo]\n\t"
+       "movq %[lo], 16(%[r])\n\t"
+       "mulx 24(%[a]), %[lo], %[c]\n\t"
+       "adcx %[hi], %[lo]\n\t"
+       "movq %[lo], 24(%[r])\n\t"
+       "leaq 32(%[a]), %[a]\n\t"
+       "leaq 32(%[r]), %[r]\n\t"
+       "leaq -1(%%rcx), %%rcx\n\t"
+       "jrcxz 4f\n\t"
+       "jmp 3b\n"
+       "4:\n\t"
+       "movl $0, %k[lo]\n\t"
+       "adcx %[lo], %[c]\n\t"
+       : [c] "=&r"(carry), [lo] "=&r"(lo), [hi] "=&r"(hi), [a] "+r"(a), [r] "+r"(r), "+c"(n)
+       : "d"(b), [blocks] "r"(blocks)
+       : "cc", "memory");
+   return carry;
+}
+
+//
+// r[0..n) += a[0..n) * b, returns the carry limb.  r and a must not overlap.
+// Requires n > 0.
+//
+inline limb_type mulx_addmul_1(limb_type* r, const limb_type* a, std::size_t n, limb_type b)
+{
+   limb_type   carry, lo, hi;
+   std::size_t blocks = n / 4;
+   n %= 4;
+   __asm__(
+       "xorl %k[c], %k[c]\n\t"   // carry = 0, clears CF and OF
+       "jrcxz 2f\n"
+       "1:\n\t"
+       "mulx (%[a]), %[lo], %[hi]\n\t"
+       "adcx %[c], %[lo]\n\t"    // CF chain: low half plus previous high half
+       "adox (%[r]), %[lo]\n\t"  // OF chain: accumulate into r
+       "movq %[lo], (%[r])\n\t"
+       "movq %[hi], %[c]\n\t"
+       "leaq 8(%[a]), %[a]\n\t"
+       "leaq 8(%[r]), %[r]\n\t"
+       "leaq -1(%%rcx), %%rcx\n\t"
+       "jrcxz 2f\n\t"
+       "jmp 1b\n"
+       "2:\n\t"
+       "movq %[blocks], %%rcx\n\t"
+       "jrcxz 4f\n"
+       "3:\n\t"
+       "mulx (%[a]), %[lo], %[hi]\n\t"
+       "adcx %[c], %[lo]\n\t"
+       "adox (%[r]), %[lo]\n\t"
+       "movq %[lo], (%[r])\n\t"
+       "mulx 8(%[a]), %[lo], %[c]\n\t"
+       "adcx %[hi], %[lo]\n\t"
+       "adox 8(%[r]), %[lo]\n\t"
+       "movq %[lo], 8(%[r])\n\t"
+       "mulx 16(%[a]), %[lo], %[hi]\n\t"
+       "adcx %[c], %[lo]\n\t"
+       "adox 16(%[r]), %[lo]\n\t"
+       "movq %[lo], 16(%[r])\n\t"
+       "mulx 24(%[a]), %[lo], %[c]\n\t"
+       "adcx %[hi], %[lo]\n\t"
+       "adox 24(%[r]), %[lo]\n\t"
+       "movq %[lo], 24(%[r])\n\t"
+       "leaq 32(%[a]), %[a]\n\t"
+       "leaq 32(%[r]), %[r]\n\t"
+       "leaq -1(%%rcx), %%rcx\n\t"
+       "jrcxz 4f\n\t"
+       "jmp 3b\n"
+       "4:\n\t"
+       // Fold both outstanding carries into the final high half, this can not overflow:
+       "movl $0, %k[lo]\n\t"
+       "adcx %[lo], %[c]\n\t"
+       "adox %[lo], %[c]\n\t"
+       : [c] "=&r"(carry), [lo] "=&r"(lo), [hi] "=&r"(hi), [a] "+r"(a), [r] "+r"(r), "+c"(n)
+       : "d"(b), [blocks] "r"(blocks)
+       : "cc", "memory");
+   return carry;
+}
+
+}}} // namespace boost::multiprecision::detail
+
+#endif
+
+#endif
@@ -0,0 +1,248 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Uniform random cpp_int's generated a limb at a time:
+//
+#ifndef BOOST_MP_CPP_INT_RANDOM_HPP
+#define BOOST_MP_CPP_INT_RANDOM_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <boost/multiprecision/detail/assert.hpp>
+#include <boost/multiprecision/detail/bitscan.hpp>
+#include <boost/multiprecision/detail/uniform_int_distribution.hpp>
+#include <boost/multiprecision/traits/std_integer_traits.hpp>
+
+namespace boost { namespace multiprecision {
+namespace detail {
+
+//
+// Draws whole random limbs from an engine with a built in integer result_type.  Each call to
+// the engine supplies the w low bits of its output, where [min, min + 2^w) is the largest
+// power of 2 range the engine covers, and outputs beyond that are rejected, which for the
+// usual engines with a range of 2^32 or 2^64 never happens:
+//
+template <class Engine>
+class random_limb_generator
+{
+   using result_type   = typename Engine::result_type;
+   using base_unsigned = typename make_unsigned_mp<result_type>::type;
+
+   Engine&       m_engine;
+   result_type   m_min;
+   base_unsigned m_mask;
+   unsigned      m_bits;
+
+   limb_type next()
+   {
+      for (;;)
+      {
+         const base_unsigned v = static_cast<base_unsigned>(m_engine() - m_min);
+         if (v <= m_mask)
+            return static_cast<limb_type>(v);
+      }
+   }
+
+ public:
+   explicit random_limb_generator(Engine& eng) : m_engine(eng), m_min((eng.min)())
+   {
+      const base_unsigned range = static_cast<base_unsigned>((eng.max)() - m_min);
+      BOOST_MP_ASSERT(range);
+      unsigned bits = static_cast<unsigned>(find_msb(range));
+      if ((range & static_cast<base_unsigned>(range + 1u)) == 0)
+      {
+         // The range is all ones:
+         m_mask = range;
+         ++bits;
+      }
+      else
+         m_mask = static_cast<base_unsigned>((static_cast<base_unsigned>(1u) << bits) - 1u);
+      m_bits = (std::min)(bits, static_cast<unsigned>(sizeof(limb_type) * CHAR_BIT));
+   }
+
+   limb_type operator()()
+   {
+      limb_type result = next();
+      for (unsigned b = m_bits; b < sizeof(limb_type) * CHAR_BIT; b += m_bits)
+         result = static_cast<limb_type>(result << m_bits) | next();
+      return result;
+   }
+};
+
+//
+// Sets result[0, n) to a uniform random value in [0, range], where range[n - 1] is non-zero
+// unless n is 1.  The top limb is drawn uniformly from [0, range[n - 1]] by Lemire's multiply
+// and reject method, and the limbs below it are raw random limbs, so the value is only out of
+// range when the top limb equals that of range, and that is seen as soon as the first limb
+// which differs from range is drawn:
+//
+template <class Generator>
+void generate_uniform_limbs(Generator& gen, const limb_type* range, std::size_t n, limb_type* result)
+{
+   constexpr unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const limb_type    top       = range[n - 1];
+   for (;;)
+   {
+      limb_type t;
+      if (top == ~static_cast<limb_type>(0u))
+         t = gen();
+      else
+      {
+         const limb_type  s = static_cast<limb_type>(top + 1u);
+         double_limb_type m = static_cast<double_limb_type>(gen()) * s;
+         limb_type        l = static_cast<limb_type>(m);
+         if (l < s)
+         {
+            const limb_type threshold = static_cast<limb_type>(static_cast<limb_type>(~s + 1u) % s);
+            while (l < threshold)
+            {
+               m = static_cast<double_limb_type>(gen()) * s;
+               l = static_cast<limb_type>(m);
+            }
+         }
+         t = static_cast<limb_type>(m >> limb_bits);
+      }
+      result[n - 1] = t;
+
+      bool        tight    = t == top;
+      bool        rejected = false;
+      std::size_t i        = n - 1;
+      while (i--)
+      {
+         result[i] = gen();
+         if (tight)
+         {
+            if (result[i] > range[i])
+            {
+               rejected = true;
+               break;
+            }
+            tight = result[i] == range[i];
+         }
+      }
+      if (!rejected)
+         return;
+   }
+}
+
+//
+// The same for cpp_int_backend's, and their trivial variants which are split into at most 2 limbs:
+//
+template <class Generator, class CppInt>
+void generate_uniform_backend(Generator& gen, const CppInt& range, CppInt& result, const std::integral_constant<bool, false>&)
+{
+   const std::size_t n = range.size();
+   result.resize(n, n);
+   generate_uniform_limbs(gen, range.limbs(), n, result.limbs());
+   result.sign(false);
+   result.normalize();
+}
+template <class Generator, class CppInt>
+void generate_uniform_backend(Generator& gen, const CppInt& range, CppInt& result, const std::integral_constant<bool, true>&)
+{
+   using local_limb_type = typename CppInt::local_limb_type;
+   constexpr unsigned    half_limb = sizeof(limb_type) * CHAR_BIT / 2;
+   const local_limb_type r         = *range.limbs();
+   limb_type             w[2]      = {static_cast<limb_type>(r), 0};
+   limb_type             v[2]      = {0, 0};
+   std::size_t           n         = 1;
+   BOOST_IF_CONSTEXPR(sizeof(local_limb_type) > sizeof(limb_type))
+   {
+      w[1] = static_cast<limb_type>(r >> half_limb >> half_limb);
+      if (w[1])
+         n = 2;
+   }
+   generate_uniform_limbs(gen, w, n, v);
+   local_limb_type value = static_cast<local_limb_type>(v[0]);
+   BOOST_IF_CONSTEXPR(sizeof(local_limb_type) > sizeof(limb_type))
+      value |= static_cast<local_limb_type>(static_cast<local_limb_type>(v[1]) << half_limb << half_limb);
+   result = CppInt();
+   *result.limbs() = value;
+}
+
+//
+// Sets result to a value of bits random bits:
+//
+template <class Generator, class CppInt>
+void generate_random_bits(Generator& gen, CppInt& result, std::size_t bits, const std::integral_constant<bool, false>&)
+{
+   constexpr unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const std::size_t  n         = bits / limb_bits + (bits % limb_bits ? 1 : 0);
+   result.resize(n, n);
+   BOOST_MP_ASSERT(result.size() == n);
+   limb_type* p = result.limbs();
+   for (std::size_t i = 0; i < n; ++i)
+      p[i] = gen();
+   if (bits % limb_bits)
+      p[n - 1] &= static_cast<limb_type>((static_cast<limb_type>(1u) << (bits % limb_bits)) - 1u);
+   result.sign(false);
+   result.normalize();
+}
+template <class Generator, class CppInt>
+void generate_random_bits(Generator& gen, CppInt& result, std::size_t bits, const std::integral_constant<bool, true>&)
+{
+   using local_limb_type = typename CppInt::local_limb_type;
+   constexpr unsigned    limb_bits = sizeof(limb_type) * CHAR_BIT;
+   constexpr unsigned    half_limb = limb_bits / 2;
+   local_limb_type       value     = static_cast<local_limb_type>(gen());
+   BOOST_IF_CONSTEXPR(sizeof(local_limb_type) > sizeof(limb_type))
+   {
+      if (bits > limb_bits)
+         value |= static_cast<local_limb_type>(static_cast<local_limb_type>(gen()) << half_limb << half_limb);
+   }
+   if (bits < sizeof(local_limb_type) * CHAR_BIT)
+      value &= static_cast<local_limb_type>((static_cast<local_limb_type>(1u) << bits) - 1u);
+   result = CppInt();
+   *result.limbs() = value;
+}
+
+//
+// uniform_int_distribution for cpp_int's: engines whose result_type is a built in integer
+// supply the limbs directly, other engines, such as independent_bits_engine producing a
+// multiprecision type, go via generate_uniform_int as before:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ET>
+struct uniform_int_generator<number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ET> >
+{
+   using backend_type = backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>;
+   using number_type  = number<backend_type, ET>;
+   using trivial_tag  = std::integral_constant<bool, backends::is_trivial_cpp_int<backend_type>::value>;
+
+   template <class Engine>
+   static number_type generate(Engine& eng, const number_type& min_value, const number_type& max_value)
+   {
+      return generate(eng, min_value, max_value, std::integral_constant<bool, boost::multiprecision::detail::is_integral<typename Engine::result_type>::value>());
+   }
+
+ private:
+   template <class Engine>
+   static number_type generate(Engine& eng, const number_type& min_value, const number_type& max_value, const std::integral_constant<bool, false>&)
+   {
+      return generate_uniform_int(eng, min_value, max_value);
+   }
+   template <class Engine>
+   static number_type generate(Engine& eng, const number_type& min_value, const number_type& max_value, const std::integral_constant<bool, true>&)
+   {
+      BOOST_MP_ASSERT(min_value <= max_value);
+      random_limb_generator<Engine> gen(eng);
+      number_type                   result;
+      if (min_value.is_zero())
+         generate_uniform_backend(gen, max_value.backend(), result.backend(), trivial_tag());
+      else
+      {
+         const number_type range = max_value - min_value;
+         generate_uniform_backend(gen, range.backend(), result.backend(), trivial_tag());
+         result += min_value;
+      }
+      return result;
+   }
+};
+
+}}} // namespace boost::multiprecision::detail
+
+#endif
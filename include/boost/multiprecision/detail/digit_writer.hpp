@@ -0,0 +1,299 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_DETAIL_DIGIT_WRITER_HPP
+#define BOOST_MP_DETAIL_DIGIT_WRITER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <boost/multiprecision/number.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// Reads the digits of a cpp_dec_float straight from its base 10^8 limbs.  round_digits() copies
+// the leading digits to an array, and write() writes the whole value in fixed or scientific
+// notation to any buffer with put, write and fill members, both with the same result as str():
+//
+template <class Backend>
+struct digit_writer;
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+struct digit_writer<backends::cpp_dec_float<Digits10, ExponentType, Allocator> >
+{
+   using backend_type = backends::cpp_dec_float<Digits10, ExponentType, Allocator>;
+
+   static constexpr std::size_t   elem_digits = static_cast<std::size_t>(backend_type::cpp_dec_float_elem_digits10);
+   static constexpr std::uint32_t elem_mask   = static_cast<std::uint32_t>(backend_type::cpp_dec_float_elem_mask);
+   static constexpr std::size_t   max_digits  = static_cast<std::size_t>(backend_type::cpp_dec_float_max_digits10);
+
+   const backend_type& m_value;
+   std::size_t         m_lead;     // The number of digits in the first limb.
+   std::size_t         m_stored;   // The number of significant digits held.
+   std::size_t         m_round_at; // The digit incremented by rounding, the digits after it become zero.
+   bool                m_carry;    // Rounding carried out of the first digit.
+
+   explicit digit_writer(const backend_type& v) : m_value(v), m_lead(1), m_stored(1), m_round_at(static_cast<std::size_t>(-1)), m_carry(false)
+   {
+      for (std::uint32_t d = v.data[0]; d >= 10; d /= 10)
+         ++m_lead;
+      if (v.data[0])
+         m_stored = m_lead + (v.data.size() - 1) * elem_digits;
+   }
+
+   //
+   // The j'th significant digit, before rounding, zero beyond those held:
+   //
+   unsigned digit(std::size_t j) const
+   {
+      std::uint32_t d;
+      std::size_t   place;
+      if (j < m_lead)
+      {
+         d     = m_value.data[0];
+         place = m_lead - 1 - j;
+      }
+      else if (j < m_stored)
+      {
+         d     = m_value.data[1 + (j - m_lead) / elem_digits];
+         place = elem_digits - 1 - (j - m_lead) % elem_digits;
+      }
+      else
+         return 0;
+      while (place--)
+         d /= 10;
+      return d % 10;
+   }
+   bool nonzero_from(std::size_t j) const
+   {
+      for (; (j < m_stored) && ((j < m_lead) || ((j - m_lead) % elem_digits)); ++j)
+      {
+         if (digit(j))
+            return true;
+      }
+      for (std::size_t i = j < m_stored ? 1 + (j - m_lead) / elem_digits : m_value.data.size(); i < m_value.data.size(); ++i)
+      {
+         if (m_value.data[i])
+            return true;
+      }
+      return false;
+   }
+   //
+   // The decimal exponent of the first digit, before rounding:
+   //
+   std::intmax_t exponent10() const
+   {
+      return m_value.data[0] ? static_cast<std::intmax_t>(m_value.exp) + static_cast<std::intmax_t>(m_lead) - 1 : 0;
+   }
+   //
+   // The number of significant digits held, less trailing zeros:
+   //
+   std::size_t significant_digits() const
+   {
+      std::size_t i = m_value.data.size();
+      while ((i > 1) && !m_value.data[i - 1])
+         --i;
+      std::size_t   result = i > 1 ? m_lead + (i - 1) * elem_digits : m_lead;
+      std::uint32_t d      = m_value.data[i - 1];
+      for (; d && !(d % 10) && (result > 1); d /= 10)
+         --result;
+      return result;
+   }
+   //
+   // Rounds to the first count digits, ties to even, and returns the change in the exponent:
+   //
+   int round(std::size_t count)
+   {
+      const unsigned d = digit(count);
+      if ((d < 5) || ((d == 5) && (!count || !(digit(count - 1) & 1u)) && !nonzero_from(count + 1)))
+         return 0;
+      while (count && (digit(count - 1) == 9))
+         --count;
+      if (count)
+      {
+         m_round_at = count - 1;
+         return 0;
+      }
+      m_carry = true;
+      return 1;
+   }
+   //
+   // Writes digits [first, last) after rounding:
+   //
+   template <class Buffer>
+   void write_range(Buffer& out, std::size_t first, std::size_t last) const
+   {
+      if (m_carry)
+      {
+         if (first < last && !first)
+         {
+            out.put('1');
+            ++first;
+         }
+         out.fill('0', last - first);
+         return;
+      }
+      while (first < last)
+      {
+         if (first >= m_round_at)
+         {
+            if (first == m_round_at)
+            {
+               out.put(static_cast<char>('0' + digit(first) + 1));
+               ++first;
+            }
+            out.fill('0', last - first);
+            return;
+         }
+         std::size_t   end, place;
+         std::uint32_t d;
+         if (first < m_lead)
+         {
+            end   = m_lead;
+            place = m_lead - first;
+            d     = m_value.data[0];
+         }
+         else if (first < m_stored)
+         {
+            const std::size_t offset = (first - m_lead) % elem_digits;
+            end                      = first - offset + elem_digits;
+            place                    = elem_digits - offset;
+            d                        = m_value.data[1 + (first - m_lead) / elem_digits];
+         }
+         else
+         {
+            out.fill('0', last - first);
+            return;
+         }
+         end = (std::min)((std::min)(end, last), m_round_at);
+         char buf[elem_digits];
+         for (std::size_t i = place; i-- > 0; d /= 10)
+            buf[i] = static_cast<char>('0' + d % 10);
+         out.write(buf, end - first);
+         first = end;
+      }
+   }
+
+   //
+   // A Buffer which writes to an array with room for max_digits:
+   //
+   struct array_buffer
+   {
+      char* pos;
+
+      void put(char c) { *pos++ = c; }
+      void write(const char* p, std::size_t n)
+      {
+         std::memcpy(pos, p, n);
+         pos += n;
+      }
+      void fill(char c, std::size_t n)
+      {
+         std::memset(pos, c, n);
+         pos += n;
+      }
+   };
+   //
+   // Rounds to the first count digits, and writes the significant ones of them to buf, of
+   // which there are none when the value rounds to zero.  exp10 is the exponent of the first:
+   //
+   std::ptrdiff_t round_digits(char* buf, std::size_t count, std::ptrdiff_t& exp10)
+   {
+      exp10 = static_cast<std::ptrdiff_t>(exponent10() + round(count));
+      const std::size_t n = m_carry ? 1 : (std::min)(count, m_stored);
+      array_buffer      out{buf};
+      write_range(out, 0, n);
+      return static_cast<std::ptrdiff_t>(n);
+   }
+
+   template <class Buffer>
+   void write(Buffer& out, std::streamsize digits, std::ios_base::fmtflags f)
+   {
+      const bool showpoint = (f & std::ios_base::showpoint) == std::ios_base::showpoint;
+      if ((m_value.isinf)())
+      {
+         if (m_value.isneg())
+            out.write("-inf", 4);
+         else
+            out.write((f & std::ios_base::showpos) ? "+inf" : "inf", (f & std::ios_base::showpos) ? 4 : 3);
+         return;
+      }
+      if ((m_value.isnan)())
+      {
+         out.write("nan", 3);
+         return;
+      }
+      if (m_value.isneg())
+         out.put('-');
+      else if (f & std::ios_base::showpos)
+         out.put('+');
+      std::intmax_t exp10 = exponent10();
+      if ((f & std::ios_base::floatfield) == std::ios_base::fixed)
+      {
+         const std::size_t   frac  = static_cast<std::size_t>((std::max)(digits, std::streamsize(0)));
+         const std::intmax_t count = exp10 + 1 + static_cast<std::intmax_t>(frac);
+         if (count < 0)
+         {
+            // Rounds to zero:
+            out.put('0');
+            if (frac || showpoint)
+               out.put('.');
+            out.fill('0', frac);
+            return;
+         }
+         exp10 += round(static_cast<std::size_t>(count));
+         if (exp10 >= 0)
+         {
+            const std::size_t whole = static_cast<std::size_t>(exp10) + 1;
+            write_range(out, 0, whole);
+            if (frac || showpoint)
+               out.put('.');
+            write_range(out, whole, whole + frac);
+         }
+         else
+         {
+            const std::size_t zeros = (std::min)(static_cast<std::size_t>(-1 - exp10), frac);
+            out.put('0');
+            if (frac || showpoint)
+               out.put('.');
+            out.fill('0', zeros);
+            write_range(out, 0, frac - zeros);
+         }
+      }
+      else
+      {
+         const std::size_t count = digits > 0 ? static_cast<std::size_t>(digits) + 1 : static_cast<std::size_t>(std::numeric_limits<number<backend_type> >::max_digits10);
+         if (m_value.data[0])
+            exp10 += round(count);
+         write_range(out, 0, 1);
+         if ((count > 1) || showpoint)
+            out.put('.');
+         write_range(out, 1, count);
+         out.put('e');
+         out.put(exp10 < 0 ? '-' : '+');
+         char        buf[std::numeric_limits<std::intmax_t>::digits10 + 2];
+         char*       pos = buf + sizeof(buf);
+         std::uintmax_t e   = exp10 < 0 ? 0u - static_cast<std::uintmax_t>(exp10) : static_cast<std::uintmax_t>(exp10);
+         do
+         {
+            *--pos = static_cast<char>('0' + e % 10);
+            e /= 10;
+         } while (e);
+         for (std::ptrdiff_t i = buf + sizeof(buf) - pos; i < BOOST_MP_MIN_EXPONENT_DIGITS; ++i)
+            out.put('0');
+         out.write(pos, static_cast<std::size_t>(buf + sizeof(buf) - pos));
+      }
+   }
+};
+
+}}} // namespace boost::multiprecision::detail
+
+#endif // BOOST_MP_DETAIL_DIGIT_WRITER_HPP
@@ -907,6 +907,20 @@ inline void eval_cosh(T& result, const T& x)
    detail::sinhcosh(x, static_cast<T*>(0), &result);
 }
 
+template <class T>
+inline void eval_sinhcosh(T& result_sinh, T& result_cosh, const T& x)
+{
+   static_assert(number_category<T>::value == number_kind_floating_point, "The sinh and cosh functions are only valid for floating point types.");
+   BOOST_MP_ASSERT(&result_sinh != &result_cosh);
+   if ((&result_sinh == &x) || (&result_cosh == &x))
+   {
+      T temp(x);
+      detail::sinhcosh(temp, &result_sinh, &result_cosh);
+      return;
+   }
+   detail::sinhcosh(x, &result_sinh, &result_cosh);
+}
+
 template <class T>
 inline void eval_tanh(T& result, const T& x)
 {
@@ -485,6 +485,101 @@ void eval_cos(T& result, const T& x)
    BOOST_MATH_INSTRUMENT_CODE(result.str(0, std::ios_base::scientific));
 }
 
+//
+// Computes both sin(x) and cos(x) with a single argument reduction and a single series
+// evaluation: x is reduced to r = x - n * pi / 2 with |r| <= pi / 4, then sin(r) is found by
+// series and cos(r) from sqrt(1 - sin(r)^2), where sin(r)^2 <= 1/2 so there is no
+// cancellation error.  Reducing to the nearest multiple of pi / 2, rather than the one
+// below as eval_sin does, means the small argument always comes straight out of the
+// extended precision reduction.
+//
+template <class T>
+void eval_sincos(T& result_sin, T& result_cos, const T& x)
+{
+   static_assert(number_category<T>::value == number_kind_floating_point, "The sin and cos functions are only valid for floating point types.");
+   BOOST_MP_ASSERT(&result_sin != &result_cos);
+   if ((&result_sin == &x) || (&result_cos == &x))
+   {
+      T temp(x);
+      eval_sincos(result_sin, result_cos, temp);
+      return;
+   }
+
+   using ui_type = typename boost::multiprecision::detail::canonical<std::uint32_t, T>::type;
+
+   switch (eval_fpclassify(x))
+   {
+   case FP_INFINITE:
+   case FP_NAN:
+      eval_sin(result_sin, x);
+      eval_cos(result_cos, x);
+      return;
+   case FP_ZERO:
+      result_sin = x;
+      result_cos = ui_type(1);
+      return;
+   default:;
+   }
+
+   T    xx           = x;
+   bool b_negate_sin = false;
+   if (eval_get_sign(x) < 0)
+   {
+      xx.negate();
+      b_negate_sin = true;
+   }
+
+   T n_pi, t;
+   T half_pi = get_constant_pi<T>();
+   eval_ldexp(half_pi, half_pi, -1); // divide by 2
+   eval_ldexp(t, half_pi, -1);
+   unsigned quadrant = 0;
+   if (xx.compare(t) > 0)
+   {
+      eval_divide(n_pi, xx, half_pi);
+      eval_round(n_pi, n_pi);
+      //
+      // As in eval_sin and eval_cos, once n_pi is no longer an exact integer we cannot
+      // reliably reduce the argument:
+      //
+      if (n_pi.compare(get_constant_one_over_epsilon<T>()) > 0)
+      {
+         result_sin = ui_type(0);
+         result_cos = ui_type(1);
+         return;
+      }
+      t = ui_type(4);
+      eval_fmod(t, n_pi, t);
+      while ((quadrant < 3) && (t.compare(ui_type(quadrant)) != 0))
+         ++quadrant;
+      reduce_n_half_pi(xx, n_pi, false);
+   }
+
+   eval_sin(result_sin, xx);
+   eval_multiply(t, result_sin, result_sin);
+   eval_subtract(t, ui_type(1), t);
+   eval_sqrt(result_cos, t);
+
+   switch (quadrant)
+   {
+   case 1:
+      result_sin.swap(result_cos);
+      result_cos.negate();
+      break;
+   case 2:
+      result_sin.negate();
+      result_cos.negate();
+      break;
+   case 3:
+      result_sin.swap(result_cos);
+      result_sin.negate();
+      break;
+   default:;
+   }
+   if (b_negate_sin)
+      result_sin.negate();
+}
+
 template <class T>
 void eval_tan(T& result, const T& x)
 {
@@ -497,8 +592,7 @@ void eval_tan(T& result, const T& x)
       return;
    }
    T t;
-   eval_sin(result, x);
-   eval_cos(t, x);
+   eval_sincos(result, t, x);
    eval_divide(result, t);
 }
 
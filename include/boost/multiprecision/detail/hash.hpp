@@ -7,7 +7,9 @@
 #define BOOST_MP_DETAIL_HASH_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
 #include <boost/multiprecision/detail/standalone_config.hpp>
 
 namespace boost { namespace multiprecision { namespace detail {
@@ -40,6 +42,75 @@ inline void hash_combine(std::size_t& seed, const T& v, Args... args)
     hash_combine(seed, args...);
 }
 
+//
+// Limb wide hashing of the words of a value, after wyhash by Wang Yi: each pair of 64 bit
+// words is mixed into the state with one full width multiply, the high and low halves of the
+// product xor'ed together.  Two independent states are updated per round of four words, so
+// that the multiplies overlap, and a last multiply folds them together.  The result is well
+// mixed in all its bits, so is suitable for use directly as a hash table index:
+//
+constexpr std::uint64_t hash_secret0 = 0xa0761d6478bd642fuLL;
+constexpr std::uint64_t hash_secret1 = 0xe7037ed1a0b428dbuLL;
+constexpr std::uint64_t hash_secret2 = 0x8ebc6af09c88c6e3uLL;
+constexpr std::uint64_t hash_secret3 = 0x589965cc75374cc3uLL;
+
+inline BOOST_MP_CXX14_CONSTEXPR std::uint64_t hash_mum(std::uint64_t a, std::uint64_t b) noexcept
+{
+#if defined(BOOST_HAS_INT128)
+   const uint128_type r = static_cast<uint128_type>(a) * b;
+   return static_cast<std::uint64_t>(r) ^ static_cast<std::uint64_t>(r >> 64);
+#else
+   const std::uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32, b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+   const std::uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+   const std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+   return ((mid << 32) | (ll & 0xFFFFFFFFu)) ^ (hh + (lh >> 32) + (hl >> 32) + (mid >> 32));
+#endif
+}
+
+//
+// Hashes the n words at p, which are of an unsigned type of up to 64 bits.  seed carries
+// whatever else distinguishes the value, such as its sign or exponent:
+//
+template <class Word>
+inline BOOST_MP_CXX14_CONSTEXPR std::size_t hash_words(const Word* p, std::size_t n, std::uint64_t seed) noexcept
+{
+   static_assert(std::is_unsigned<Word>::value && (sizeof(Word) <= sizeof(std::uint64_t)), "Words must be unsigned and no wider than 64 bits.");
+   std::uint64_t s1 = seed ^ hash_secret0, s2 = seed ^ hash_secret3;
+   std::size_t   i  = 0;
+   for (; n - i >= 4; i += 4)
+   {
+      s1 = hash_mum(static_cast<std::uint64_t>(p[i]) ^ hash_secret1, static_cast<std::uint64_t>(p[i + 1]) ^ s1);
+      s2 = hash_mum(static_cast<std::uint64_t>(p[i + 2]) ^ hash_secret2, static_cast<std::uint64_t>(p[i + 3]) ^ s2);
+   }
+   if (n - i >= 2)
+   {
+      s1 = hash_mum(static_cast<std::uint64_t>(p[i]) ^ hash_secret1, static_cast<std::uint64_t>(p[i + 1]) ^ s1);
+      i += 2;
+   }
+   if (i < n)
+      s2 = hash_mum(static_cast<std::uint64_t>(p[i]) ^ hash_secret2, s2);
+   const std::uint64_t result = hash_mum(s1 ^ hash_secret1 ^ static_cast<std::uint64_t>(n), s2 ^ hash_secret2);
+   return static_cast<std::size_t>(sizeof(std::size_t) < sizeof(std::uint64_t) ? result ^ (result >> 32) : result);
+}
+
+//
+// True when hash_value for Backend is computed with hash_words, std::hash then declares
+// itself avalanching so that hash containers which support it, such as boost::unordered_flat_map,
+// use its result directly without mixing it again:
+//
+template <class Backend>
+struct is_avalanching_hash : public std::integral_constant<bool, false>
+{};
+
+template <class Backend, bool = is_avalanching_hash<Backend>::value>
+struct avalanching_hash_base
+{};
+template <class Backend>
+struct avalanching_hash_base<Backend, true>
+{
+   using is_avalanching = std::true_type;
+};
+
 #if defined(BOOST_HAS_INT128)
 
 inline std::size_t hash_value(const uint128_type& val)
@@ -95,6 +95,16 @@ inline BOOST_MP_CXX14_CONSTEXPR void eval_gcd(B& result, const B& a, const B& b)
    eval_left_shift(result, shift);
 }
 
+//
+// Division where the remainder is known to be zero, backends may override
+// this with something cheaper than a full division:
+//
+template <class Backend>
+inline BOOST_MP_CXX14_CONSTEXPR void eval_divide_exact(Backend& result, const Backend& a, const Backend& b)
+{
+   eval_divide(result, a, b);
+}
+
 template <class B>
 inline BOOST_MP_CXX14_CONSTEXPR void eval_lcm(B& result, const B& a, const B& b)
 {
@@ -150,6 +160,38 @@ divide_qr(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x, cons
    divide_qr(number<Backend, ExpressionTemplates>(x), number<Backend, ExpressionTemplates>(y), q, r);
 }
 
+template <class Backend, expression_template_option ExpressionTemplates>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+divide_exact(const number<Backend, ExpressionTemplates>& x, const number<Backend, ExpressionTemplates>& y)
+{
+   using default_ops::eval_divide_exact;
+   number<Backend, ExpressionTemplates> result;
+   eval_divide_exact(result.backend(), x.backend(), y.backend());
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates, class tag, class A1, class A2, class A3, class A4>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+divide_exact(const number<Backend, ExpressionTemplates>& x, const multiprecision::detail::expression<tag, A1, A2, A3, A4>& y)
+{
+   return divide_exact(x, number<Backend, ExpressionTemplates>(y));
+}
+
+template <class tag, class A1, class A2, class A3, class A4, class Backend, expression_template_option ExpressionTemplates>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+divide_exact(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x, const number<Backend, ExpressionTemplates>& y)
+{
+   return divide_exact(number<Backend, ExpressionTemplates>(x), y);
+}
+
+template <class tag, class A1, class A2, class A3, class A4, class tagb, class A1b, class A2b, class A3b, class A4b>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<number_category<typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type>::value == number_kind_integer, typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type>::type
+divide_exact(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x, const multiprecision::detail::expression<tagb, A1b, A2b, A3b, A4b>& y)
+{
+   using number_type = typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type;
+   return divide_exact(number_type(x), number_type(y));
+}
+
 template <class Backend, expression_template_option ExpressionTemplates, class Integer>
 inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<boost::multiprecision::detail::is_integral<Integer>::value && (number_category<Backend>::value == number_kind_integer), Integer>::type
 integer_modulus(const number<Backend, ExpressionTemplates>& x, Integer val)
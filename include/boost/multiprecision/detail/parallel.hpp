@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_DETAIL_PARALLEL_HPP
+#define BOOST_MP_DETAIL_PARALLEL_HPP
+
+#include <cstddef>
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+
+#ifdef BOOST_HAS_THREADS
+#include <exception>
+#include <thread>
+#include <vector>
+#endif
+
+namespace boost { namespace multiprecision { namespace detail {
+
+//
+// Splits [first, last) into at most "threads" contiguous sub-ranges and calls
+// f(begin, end) on each, with all but the first running on their own thread.
+// Each invocation of f gets a whole sub-range, so that any scratch space can be
+// allocated once per thread rather than once per element.
+//
+// When threads are not supported, or threads <= 1, this is just f(first, last).
+// If a thread can't be started, the sub-ranges not yet handed out are run on the
+// calling thread instead.  The first exception thrown by any of the workers is
+// rethrown to the caller.
+//
+template <class F>
+void parallel_for(std::size_t first, std::size_t last, std::size_t threads, F f)
+{
+#ifdef BOOST_HAS_THREADS
+   std::size_t count = last - first;
+   if ((threads > 1) && (count > 1))
+   {
+      if (threads > count)
+         threads = count;
+      std::size_t chunk = count / threads;
+      std::size_t extra = count % threads;
+
+      std::vector<std::thread>        workers;
+      std::vector<std::exception_ptr> errors(threads);
+      workers.reserve(threads - 1);
+
+      std::size_t begin = first + chunk + (extra ? 1 : 0);
+      for (std::size_t i = 1; i < threads; ++i)
+      {
+         std::size_t end    = begin + chunk + (i < extra ? 1 : 0);
+         auto        worker = [&f, &errors, i, begin, end]() {
+#ifndef BOOST_NO_EXCEPTIONS
+            try
+            {
+               f(begin, end);
+            }
+            catch (...)
+            {
+               errors[i] = std::current_exception();
+            }
+#else
+            f(begin, end);
+#endif
+         };
+#ifndef BOOST_NO_EXCEPTIONS
+         try
+         {
+            workers.emplace_back(worker);
+         }
+         catch (...)
+         {
+            // Out of threads, [begin, last) is left to this one:
+            break;
+         }
+#else
+         workers.emplace_back(worker);
+#endif
+         begin = end;
+      }
+#ifndef BOOST_NO_EXCEPTIONS
+      try
+      {
+         f(first, first + chunk + (extra ? 1 : 0));
+         if (begin != last)
+            f(begin, last);
+      }
+      catch (...)
+      {
+         errors[0] = std::current_exception();
+      }
+#else
+      f(first, first + chunk + (extra ? 1 : 0));
+#endif
+      for (std::thread& w : workers)
+         w.join();
+#ifndef BOOST_NO_EXCEPTIONS
+      for (const std::exception_ptr& e : errors)
+         if (e)
+            std::rethrow_exception(e);
+#endif
+      return;
+   }
+#else
+   static_cast<void>(threads);
+#endif
+   f(first, last);
+}
+
+}}} // namespace boost::multiprecision::detail
+
+#endif // BOOST_MP_DETAIL_PARALLEL_HPP
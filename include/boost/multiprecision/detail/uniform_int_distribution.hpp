@@ -147,6 +147,21 @@ T generate_uniform_int (Engine& eng, T min_value, T max_value)
     }
 }
 
+//
+// Generates the values of uniform_int_distribution<Integer>, number types which can do
+// better than generate_uniform_int, such as cpp_int which fills its limbs directly from the
+// engine, specialize this:
+//
+template <typename Integer>
+struct uniform_int_generator
+{
+    template <typename Engine>
+    static Integer generate(Engine& eng, const Integer& min_value, const Integer& max_value)
+    {
+        return generate_uniform_int(eng, min_value, max_value);
+    }
+};
+
 } // Namespace detail
 
 template <typename Integer = int>
@@ -197,13 +212,13 @@ public:
     template <typename Engine>
     Integer operator() (Engine& eng) const
     {
-        return detail::generate_uniform_int(eng, min_, max_);
+        return detail::uniform_int_generator<Integer>::generate(eng, min_, max_);
     }
 
     template <typename Engine>
     Integer operator() (Engine& eng, const param_type& param_arg) const
     {
-        return detail::generate_uniform_int(eng, param_arg.a(), param_arg.b());
+        return detail::uniform_int_generator<Integer>::generate(eng, param_arg.a(), param_arg.b());
     }
 };
 
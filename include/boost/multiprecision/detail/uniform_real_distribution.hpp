@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+//  A counterpart to uniform_int_distribution for floating point types,
+//  which fills all the digits of the result with random bits.
+
+#ifndef BOOST_MP_UNIFORM_REAL_DISTRIBUTION_HPP
+#define BOOST_MP_UNIFORM_REAL_DISTRIBUTION_HPP
+
+#include <limits>
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/assert.hpp>
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+//
+// Generates uniform values in [0, 1).  As std::generate_canonical this sums as many engine
+// outputs, scaled by powers of the engine's range, as are needed to fill the digits of Real,
+// so the results are spaced epsilon / 2 apart and values below 1/2 have fewer random digits:
+//
+template <typename Real, typename Engine>
+Real generate_uniform_01(Engine& eng)
+{
+    const Real range = Real((eng.max)() - (eng.min)()) + 1;
+    const Real limit = 2 / std::numeric_limits<Real>::epsilon();
+    for(;;)
+    {
+        Real sum(0), mult(1);
+        do
+        {
+            sum += Real(eng() - (eng.min)()) * mult;
+            mult *= range;
+        } while (mult < limit);
+        sum /= mult;
+        if (sum < 1)
+        {
+            return sum;
+        }
+    }
+}
+
+//
+// Types which can do better, such as cpp_bin_float which fills its mantissa directly from
+// the engine, specialize this:
+//
+template <typename Real>
+struct uniform_01_generator
+{
+    template <typename Engine>
+    static Real generate(Engine& eng)
+    {
+        return generate_uniform_01<Real>(eng);
+    }
+};
+
+template <typename Engine, typename Real>
+Real generate_uniform_real(Engine& eng, const Real& min_value, const Real& max_value)
+{
+    for(;;)
+    {
+        Real result = uniform_01_generator<Real>::generate(eng);
+        result *= max_value - min_value;
+        result += min_value;
+        if (result < max_value)
+        {
+            return result;
+        }
+    }
+}
+
+} // Namespace detail
+
+template <typename Real = double>
+class uniform_real_distribution
+{
+private:
+    Real min_;
+    Real max_;
+
+public:
+    class param_type
+    {
+    private:
+        Real min_;
+        Real max_;
+
+    public:
+        explicit param_type(Real min_val, Real max_val) : min_ {min_val}, max_ {max_val}
+        {
+            BOOST_MP_ASSERT(min_ < max_);
+        }
+
+        Real a() const { return min_; }
+        Real b() const { return max_; }
+    };
+
+    explicit uniform_real_distribution(Real min_arg = Real(0), Real max_arg = Real(1)) : min_ {min_arg}, max_ {max_arg}
+    {
+        BOOST_MP_ASSERT(min_ < max_);
+    }
+
+    explicit uniform_real_distribution(const param_type& param_arg) : min_ {param_arg.a()}, max_ {param_arg.b()} {}
+
+    Real min BOOST_PREVENT_MACRO_SUBSTITUTION () const { return min_; }
+    Real max BOOST_PREVENT_MACRO_SUBSTITUTION () const { return max_; }
+
+    Real a() const { return min_; }
+    Real b() const { return max_; }
+
+    param_type param() const { return param_type(min_, max_); }
+
+    void param(const param_type& param_arg)
+    {
+        min_ = param_arg.a();
+        max_ = param_arg.b();
+    }
+
+    template <typename Engine>
+    Real operator() (Engine& eng) const
+    {
+        return detail::generate_uniform_real(eng, min_, max_);
+    }
+
+    template <typename Engine>
+    Real operator() (Engine& eng, const param_type& param_arg) const
+    {
+        return detail::generate_uniform_real(eng, param_arg.a(), param_arg.b());
+    }
+};
+
+}} // Namespaces
+
+#endif // BOOST_MP_UNIFORM_REAL_DISTRIBUTION_HPP
@@ -583,6 +583,12 @@ inline void eval_cos(float128_backend& result, const float128_backend& arg)
 {
    result.value() = cosq(arg.value());
 }
+inline void eval_sincos(float128_backend& result_sin, float128_backend& result_cos, const float128_backend& arg)
+{
+   float128_type x    = arg.value();
+   result_sin.value() = sinq(x);
+   result_cos.value() = cosq(x);
+}
 inline void eval_tan(float128_backend& result, const float128_backend& arg)
 {
    result.value() = tanq(arg.value());
@@ -607,6 +613,12 @@ inline void eval_cosh(float128_backend& result, const float128_backend& arg)
 {
    result.value() = coshq(arg.value());
 }
+inline void eval_sinhcosh(float128_backend& result_sinh, float128_backend& result_cosh, const float128_backend& arg)
+{
+   float128_type x     = arg.value();
+   result_sinh.value() = sinhq(x);
+   result_cosh.value() = coshq(x);
+}
 inline void eval_tanh(float128_backend& result, const float128_backend& arg)
 {
    result.value() = tanhq(arg.value());
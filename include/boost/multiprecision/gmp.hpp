@@ -1964,6 +1964,12 @@ inline void eval_modulus(gmp_int& t, const gmp_int& p, const gmp_int& o)
 {
    mpz_tdiv_r(t.data(), p.data(), o.data());
 }
+inline void eval_divide_exact(gmp_int& t, const gmp_int& p, const gmp_int& o)
+{
+   if (eval_is_zero(o))
+      BOOST_MP_THROW_EXCEPTION(std::overflow_error("Division by zero."));
+   mpz_divexact(t.data(), p.data(), o.data());
+}
 inline void eval_add(gmp_int& t, const gmp_int& p, unsigned long i)
 {
    mpz_add_ui(t.data(), p.data(), i);
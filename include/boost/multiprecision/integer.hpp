@@ -7,10 +7,18 @@
 #ifndef BOOST_MP_INTEGER_HPP
 #define BOOST_MP_INTEGER_HPP
 
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/multiprecision/detail/bitscan.hpp>
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
+#include <boost/multiprecision/detail/parallel.hpp>
 #include <boost/multiprecision/detail/standalone_config.hpp>
 
 namespace boost {
@@ -42,6 +50,12 @@ inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<boost::multiprecision::d
    r = x % y;
 }
 
+template <class Integer>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<boost::multiprecision::detail::is_integral<Integer>::value, Integer>::type divide_exact(const Integer& x, const Integer& y)
+{
+   return x / y;
+}
+
 template <class I1, class I2>
 inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<boost::multiprecision::detail::is_integral<I1>::value && boost::multiprecision::detail::is_integral<I2>::value, I2>::type integer_modulus(const I1& x, I2 val)
 {
@@ -358,6 +372,1036 @@ BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<boost::multiprecision::detail::
    return sqrt(x, r);
 }
 
+namespace detail {
+
+//
+// Modular inverse by the extended Euclidean algorithm, for 0 <= a < m and unsigned builtin U.
+// Only the magnitudes of the cofactors are kept: their signs alternate.  Returns 0 when
+// gcd(a, m) != 1.
+//
+template <class U>
+U inverse_mod_small(U a, U m)
+{
+   U    r0 = m, r1 = a, t0 = 0, t1 = 1;
+   bool t0_negative = true;
+   while (r1)
+   {
+      const U q = r0 / r1;
+      const U r = r0 - q * r1;
+      const U t = t0 + q * t1;
+      r0        = r1;
+      r1        = r;
+      t0        = t1;
+      t1        = t;
+      t0_negative = !t0_negative;
+   }
+   if (r0 != 1)
+      return 0;
+   return t0_negative && t0 ? m - t0 : t0;
+}
+//
+// Modular inverse for integer number types, by Lehmer's extended Euclidean algorithm: the
+// quotients are found from the leading 62 bits of U and V in single precision, for as long
+// as Jebelean's conditions guarantee they match the true quotients, then applied to the full
+// values as a 2x2 matrix of single words.  Each step of the outer loop then reduces U by
+// around 30 bits for the cost of a few multiplications by a single word, rather than one
+// long division per quotient.
+//
+// "A Double Digit Lehmer-Euclid Algorithm for Finding the GCD of Long Integers",
+// Tudor Jebelean, J Symbolic Computation, 1995 (19), 145.
+//
+// a must be in [0, m), returns 0 when gcd(a, m) != 1.
+//
+template <class Integer>
+Integer inverse_mod_lehmer(const Integer& a, const Integer& m)
+{
+   //
+   // Invariants: U = TU * a and V = TV * a modulo m, TU and TV have opposite signs, and
+   // we keep only their magnitudes, plus the sign of TU:
+   //
+   Integer U(m), V(a), TU(0u), TV(1u), q, r, t1, t2;
+   bool    tu_negative = true;
+   while (V != 0u)
+   {
+      if (msb(U) < 64)
+      {
+         // Finish in single precision:
+         std::uint64_t u = static_cast<std::uint64_t>(U), v = static_cast<std::uint64_t>(V);
+         while (v)
+         {
+            const std::uint64_t qq = u / v, rr = u - qq * v;
+            q                      = TV;
+            q *= qq;
+            q += TU;
+            TU.swap(TV);
+            TV.swap(q);
+            u           = v;
+            v           = rr;
+            tu_negative = !tu_negative;
+         }
+         U = u;
+         break;
+      }
+      const std::size_t shift = msb(U) + 1 - 62;
+      std::uint64_t     u = static_cast<std::uint64_t>(Integer(U >> shift)), v = static_cast<std::uint64_t>(Integer(V >> shift));
+      //
+      // Cosequence magnitudes: u = s0 U +- t0 V and v = s1 U +- t1 V, where the signs
+      // alternate with the number of steps k:
+      //
+      std::uint64_t s0 = 1, t0 = 0, s1 = 0, t1_ = 1;
+      unsigned      k  = 0;
+      while (v)
+      {
+         const std::uint64_t qq = u / v, rr = u - qq * v;
+         const std::uint64_t s2 = s0 + qq * s1, t2_ = t0 + qq * t1_;
+         // Jebelean's conditions for the new quotient to be exact:
+         if ((k + 1) & 1u)
+         {
+            if ((rr < t2_) || (v - rr < s2 + s1))
+               break;
+         }
+         else if ((rr < s2) || (v - rr < t2_ + t1_))
+            break;
+         u   = v;
+         v   = rr;
+         s0  = s1;
+         s1  = s2;
+         t0  = t1_;
+         t1_ = t2_;
+         ++k;
+      }
+      if (k == 0)
+      {
+         // No progress from the leading bits, take a full Euclidean step:
+         divide_qr(U, V, q, r);
+         q *= TV;
+         q += TU;
+         TU.swap(TV);
+         TV.swap(q);
+         U.swap(V);
+         V.swap(r);
+         tu_negative = !tu_negative;
+         continue;
+      }
+      //
+      // U, V = s0 U - t0 V, t1 V - s1 U for even k, and the other way around for odd k:
+      //
+      q = U;
+      q *= s0;
+      r = V;
+      r *= t0;
+      t1 = U;
+      t1 *= s1;
+      t2 = V;
+      t2 *= t1_;
+      if (k & 1u)
+      {
+         U = r - q;
+         V = t1 - t2;
+      }
+      else
+      {
+         U = q - r;
+         V = t2 - t1;
+      }
+      // The cofactors of opposite sign add in magnitude:
+      q = TU;
+      q *= s0;
+      r = TV;
+      r *= t0;
+      t1 = TU;
+      t1 *= s1;
+      t2 = TV;
+      t2 *= t1_;
+      TU = q + r;
+      TV = t1 + t2;
+      if (k & 1u)
+         tu_negative = !tu_negative;
+   }
+   if (U != 1u)
+      return Integer(0u);
+   if (tu_negative && (TU != 0u))
+      TU = m - TU;
+   return TU;
+}
+//
+// The type in which inverse_mod_lehmer runs: the products of U, V and the cofactors with a
+// single word are up to a word wider than the modulus, so fixed precision cpp_int's use an
+// unchecked unsigned type one limb wider, and all other types their own type:
+//
+template <class Number, class Enable = void>
+struct inverse_mod_work_type
+{
+   using type = Number;
+};
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+struct inverse_mod_work_type<number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>, typename std::enable_if<backends::is_fixed_precision<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value>::type>
+{
+   static constexpr std::size_t bits = backends::max_precision<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value + sizeof(limb_type) * CHAR_BIT;
+   using type                        = number<cpp_int_backend<bits, bits, unsigned_magnitude, unchecked, void>, et_off>;
+};
+//
+// Jacobi symbol (a/n) for odd n by the binary algorithm, with no divisions: factors of 2
+// are removed from a using the second supplement (2/n) = -1 when n = 3 or 5 mod 8, and
+// then for odd a < n reciprocity swaps a and n, with a sign change when both are 3 mod 4.
+// result is the sign accumulated so far.
+//
+template <class U>
+int jacobi_small(U a, U n, int result)
+{
+   while (a)
+   {
+      unsigned zeros = 0;
+      while (!(a & 1u))
+      {
+         a >>= 1;
+         ++zeros;
+      }
+      if ((zeros & 1u) && (((n & 7u) == 3) || ((n & 7u) == 5)))
+         result = -result;
+      if (a < n)
+      {
+         std::swap(a, n);
+         if (((a & 3u) == 3) && ((n & 3u) == 3))
+            result = -result;
+      }
+      a -= n;
+   }
+   return n == 1 ? result : 0;
+}
+
+template <class Integer>
+int jacobi_imp(Integer a, Integer n, int result)
+{
+   while (a != 0u)
+   {
+      if (msb(n) < 64)
+      {
+         if (msb(a) >= 64)
+            a %= n;
+         return jacobi_small(static_cast<std::uint64_t>(a), static_cast<std::uint64_t>(n), result);
+      }
+      const std::size_t zeros = lsb(a);
+      a >>= zeros;
+      if ((zeros & 1u) && (bit_test(n, 1) != bit_test(n, 2)))
+         result = -result;
+      if (a < n)
+      {
+         a.swap(n);
+         if (bit_test(a, 1) && bit_test(n, 1))
+            result = -result;
+      }
+      a -= n;
+   }
+   return n == 1u ? result : 0;
+}
+
+} // namespace detail
+
+//
+// Returns the inverse of a modulo m in [0, m), or 0 if a and m are not coprime.  Throws a
+// std::domain_error if m is not positive.
+//
+template <class Integer>
+typename std::enable_if<boost::multiprecision::detail::is_integral<Integer>::value, Integer>::type
+inverse_mod(const Integer& a, const Integer& m)
+{
+   using unsigned_type = typename boost::multiprecision::detail::make_unsigned<Integer>::type;
+
+   if (!(m > 0))
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("The modulus must be positive."));
+   Integer r = a % m;
+   if (r < 0)
+      r += m;
+   return static_cast<Integer>(detail::inverse_mod_small(static_cast<unsigned_type>(r), static_cast<unsigned_type>(m)));
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+inverse_mod(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& m)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+   using work_type   = typename detail::inverse_mod_work_type<number_type>::type;
+
+   if (m.sign() <= 0)
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("The modulus must be positive."));
+   if ((a.sign() < 0) || (a >= m))
+   {
+      number_type r = a % m;
+      if (r.sign() < 0)
+         r += m;
+      return static_cast<number_type>(detail::inverse_mod_lehmer(static_cast<work_type>(r), static_cast<work_type>(m)));
+   }
+   return static_cast<number_type>(detail::inverse_mod_lehmer(static_cast<work_type>(a), static_cast<work_type>(m)));
+}
+
+//
+// The Jacobi symbol (a/n) for odd positive n, throws a std::domain_error otherwise:
+//
+template <class Integer>
+typename std::enable_if<boost::multiprecision::detail::is_integral<Integer>::value, int>::type
+jacobi(const Integer& a, const Integer& n)
+{
+   using unsigned_type = typename boost::multiprecision::detail::make_unsigned<Integer>::type;
+
+   if (!(n > 0) || !(n & 1))
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("The Jacobi symbol requires an odd positive n."));
+   // (-1/n) = -1 when n = 3 mod 4:
+   const bool          negative = a < 0;
+   const unsigned_type x        = negative ? static_cast<unsigned_type>(0u - static_cast<unsigned_type>(a)) : static_cast<unsigned_type>(a);
+   return detail::jacobi_small(x, static_cast<unsigned_type>(n), negative && ((n & 3) == 3) ? -1 : 1);
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, int>::type
+jacobi(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& n)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   if ((n.sign() <= 0) || !bit_test(n, 0))
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("The Jacobi symbol requires an odd positive n."));
+   if (a.sign() < 0)
+      return detail::jacobi_imp(number_type(number_type(0u) - a), n, bit_test(n, 1) ? -1 : 1);
+   return detail::jacobi_imp(a, n, 1);
+}
+
+//
+// The Kronecker symbol (a/n), which extends the Jacobi symbol to all n:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, int>::type
+kronecker(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& n)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   if (n == 0u)
+      return (a == 1u) || (a.sign() < 0 && a == number_type(0u) - number_type(1u)) ? 1 : 0;
+   int         result = 1;
+   number_type m(n);
+   if (m.sign() < 0)
+   {
+      // (a/-1) = -1 for negative a:
+      m = number_type(0u) - m;
+      if (a.sign() < 0)
+         result = -result;
+   }
+   const std::size_t zeros = lsb(m);
+   if (zeros)
+   {
+      // (a/2) is 0 for even a, and -1 when a = 3 or 5 mod 8:
+      if (!bit_test(a, 0))
+         return 0;
+      m >>= zeros;
+      if ((zeros & 1u) && (bit_test(a, 1) != bit_test(a, 2)))
+         result = -result;
+   }
+   return result * jacobi(a, m);
+}
+
+template <class Integer>
+typename std::enable_if<boost::multiprecision::detail::is_integral<Integer>::value, int>::type
+kronecker(const Integer& a, const Integer& n)
+{
+   using unsigned_type = typename boost::multiprecision::detail::make_unsigned<Integer>::type;
+
+   if (n == 0)
+      return (a == 1) || (a == static_cast<Integer>(-1)) ? 1 : 0;
+   int           result = 1;
+   const bool    a_negative = a < 0;
+   unsigned_type m          = n < 0 ? static_cast<unsigned_type>(0u - static_cast<unsigned_type>(n)) : static_cast<unsigned_type>(n);
+   if ((n < 0) && a_negative)
+      result = -result;
+   const unsigned_type x = a_negative ? static_cast<unsigned_type>(0u - static_cast<unsigned_type>(a)) : static_cast<unsigned_type>(a);
+   if (!(m & 1u))
+   {
+      if (!(x & 1u))
+         return 0;
+      unsigned zeros = 0;
+      while (!(m & 1u))
+      {
+         m >>= 1;
+         ++zeros;
+      }
+      // The residue of a modulo 8 is that of x, negated when a is negative:
+      const unsigned a8 = static_cast<unsigned>(a_negative ? (8u - (x & 7u)) & 7u : x & 7u);
+      if ((zeros & 1u) && ((a8 == 3) || (a8 == 5)))
+         result = -result;
+   }
+   if (a_negative && ((m & 3u) == 3))
+      result = -result;
+   return detail::jacobi_small(x, m, result);
+}
+
+namespace detail {
+
+//
+// Product and remainder trees, see for example:
+//
+// "How to find smooth parts of integers", Daniel J. Bernstein, 2004.
+// "Fast multiplication and its applications", Daniel J. Bernstein, 2008.
+//
+// Multiplying a list of values together one at a time multiplies an ever growing value
+// by a small one, which can never make use of Karatsuba.  Multiplying them in pairs,
+// then the pairs in pairs and so on balances the operands at every step.
+//
+// In product_tree, tree[0] is the list of values, and tree[k][i] = tree[k-1][2i] * tree[k-1][2i+1],
+// with any odd value at the end of a level carried up unchanged, up to the single root.
+// balanced_product computes just the root, discarding each level as it goes.
+//
+template <class Integer>
+Integer balanced_product(std::vector<Integer> values, std::size_t threads)
+{
+   if (values.empty())
+      return Integer(1u);
+   while (values.size() > 1)
+   {
+      std::vector<Integer> level((values.size() + 1) / 2);
+      parallel_for(0, level.size(), threads, [&values, &level](std::size_t first, std::size_t last) {
+         for (std::size_t i = first; i < last; ++i)
+         {
+            if (2 * i + 1 < values.size())
+               multiply(level[i], values[2 * i], values[2 * i + 1]);
+            else
+               level[i].swap(values[2 * i]);
+         }
+      });
+      values.swap(level);
+   }
+   return std::move(values[0]);
+}
+
+template <class Integer>
+std::vector<std::vector<Integer> > product_tree(std::vector<Integer> values, std::size_t threads)
+{
+   std::vector<std::vector<Integer> > tree;
+   if (values.empty())
+      values.push_back(Integer(1u));
+   tree.push_back(std::move(values));
+   while (tree.back().size() > 1)
+   {
+      const std::vector<Integer>& below = tree.back();
+      std::vector<Integer>        level((below.size() + 1) / 2);
+      parallel_for(0, level.size(), threads, [&below, &level](std::size_t first, std::size_t last) {
+         for (std::size_t i = first; i < last; ++i)
+         {
+            if (2 * i + 1 < below.size())
+               multiply(level[i], below[2 * i], below[2 * i + 1]);
+            else
+               level[i] = below[2 * i];
+         }
+      });
+      tree.push_back(std::move(level));
+   }
+   return tree;
+}
+//
+// Reduces x modulo every leaf of the product tree, by reducing it modulo the root and
+// then each child modulo its parent's remainder in turn, so every division is of a value
+// about twice the size of the divisor.  When Square is true, node values are squared
+// before being used as the modulus, which is what batch_gcd and crt need:
+//
+template <class Integer>
+std::vector<Integer> remainder_tree(const Integer& x, const std::vector<std::vector<Integer> >& tree, bool square, std::size_t threads)
+{
+   std::vector<Integer> remainders(1, x);
+   for (std::size_t k = tree.size(); k-- > 0;)
+   {
+      const std::vector<Integer>& moduli = tree[k];
+      std::vector<Integer>        level(moduli.size());
+      parallel_for(0, level.size(), threads, [&remainders, &moduli, &level, square](std::size_t first, std::size_t last) {
+         Integer m;
+         for (std::size_t i = first; i < last; ++i)
+         {
+            if (square)
+               multiply(m, moduli[i], moduli[i]);
+            else
+               m = moduli[i];
+            level[i] = remainders[i / 2] % m;
+            if (level[i] < 0)
+               level[i] += m;
+         }
+      });
+      remainders.swap(level);
+   }
+   return remainders;
+}
+
+} // namespace detail
+
+//
+// Product of the integers in [first, last), multiplied as a balanced tree, the product
+// of an empty range is 1.  When threads > 1 each level of the tree is shared out over
+// up to that many threads:
+//
+template <class Iterator>
+typename std::enable_if<is_number<typename std::iterator_traits<Iterator>::value_type>::value && (number_category<typename std::iterator_traits<Iterator>::value_type>::value == number_kind_integer), typename std::iterator_traits<Iterator>::value_type>::type
+prod(Iterator first, Iterator last, std::size_t threads = 1)
+{
+   using integer_type = typename std::iterator_traits<Iterator>::value_type;
+
+   return detail::balanced_product(std::vector<integer_type>(first, last), threads);
+}
+
+//
+// Returns the remainders of x modulo each of the moduli, in [0, moduli[i]), using a
+// remainder tree: much faster than dividing x by each modulus in turn when x is large.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, std::vector<number<Backend, ExpressionTemplates> > >::type
+remainder_tree(const number<Backend, ExpressionTemplates>& x, const std::vector<number<Backend, ExpressionTemplates> >& moduli, std::size_t threads = 1)
+{
+   if (moduli.empty())
+      return moduli;
+   return detail::remainder_tree(x, detail::product_tree(moduli, threads), false, threads);
+}
+
+//
+// Bernstein's batch gcd: returns g where g[i] = gcd(x[i], product of all the other x[j]),
+// so any value sharing a factor with another is found in quasi-linear time, rather than
+// by computing all n^2 pairwise gcd's.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, std::vector<number<Backend, ExpressionTemplates> > >::type
+batch_gcd(const std::vector<number<Backend, ExpressionTemplates> >& x, std::size_t threads = 1)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   if (x.empty())
+      return x;
+   std::vector<std::vector<number_type> > tree = detail::product_tree(x, threads);
+   std::vector<number_type>               g    = detail::remainder_tree(tree.back()[0], tree, true, threads);
+   detail::parallel_for(0, g.size(), threads, [&g, &x](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+         // g[i] is the product modulo x[i]^2, so g[i] / x[i] is the product of the others modulo x[i]:
+         if (x[i] == 0u)
+            g[i] = 0u;
+         else
+            g[i] = gcd(number_type(g[i] / x[i]), x[i]);
+      }
+   });
+   return g;
+}
+
+//
+// Chinese remaindering: returns the unique value r in [0, M), where M is the product of
+// the pairwise coprime moduli, with r = residues[i] modulo moduli[i] for every i.
+//
+// The factors (M / m[i]) mod m[i] come from a remainder tree of M modulo the squared
+// moduli, and the solution is then assembled up the product tree, so that every
+// multiplication is balanced.  Throws a std::domain_error if the moduli are not pairwise
+// coprime, or the number of residues and moduli differ.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+crt(const std::vector<number<Backend, ExpressionTemplates> >& residues, const std::vector<number<Backend, ExpressionTemplates> >& moduli, std::size_t threads = 1)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   if (residues.size() != moduli.size())
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("crt requires the same number of residues and moduli."));
+   if (moduli.empty())
+      return number_type(0u);
+   std::vector<std::vector<number_type> > tree = detail::product_tree(moduli, threads);
+   std::vector<number_type>               s    = detail::remainder_tree(tree.back()[0], tree, true, threads);
+   //
+   // s[i] = residues[i] * ((M / m[i]) mod m[i])^-1 mod m[i], so that s[i] * M / m[i] is
+   // the residue modulo m[i] and zero modulo every other modulus:
+   //
+   detail::parallel_for(0, s.size(), threads, [&s, &residues, &moduli](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+         const number_type& m = moduli[i];
+         number_type        r = residues[i] % m;
+         if (r < 0)
+            r += m;
+         s[i] /= m;
+         s[i] = inverse_mod(s[i], m);
+         if ((s[i] == 0u) && (m != 1u))
+            BOOST_MP_THROW_EXCEPTION(std::domain_error("The moduli passed to crt must be pairwise coprime."));
+         s[i] *= r;
+         s[i] %= m;
+      }
+   });
+   //
+   // Now sum the s[i] * M / m[i] up the tree: a node is left * right_modulus + right * left_modulus:
+   //
+   for (std::size_t k = 1; k < tree.size(); ++k)
+   {
+      const std::vector<number_type>& below = tree[k - 1];
+      std::vector<number_type>        level(tree[k].size());
+      detail::parallel_for(0, level.size(), threads, [&s, &below, &level](std::size_t first, std::size_t last) {
+         number_type t;
+         for (std::size_t i = first; i < last; ++i)
+         {
+            if (2 * i + 1 < below.size())
+            {
+               multiply(level[i], s[2 * i], below[2 * i + 1]);
+               multiply(t, s[2 * i + 1], below[2 * i]);
+               level[i] += t;
+            }
+            else
+               level[i].swap(s[2 * i]);
+         }
+      });
+      s.swap(level);
+   }
+   s[0] %= tree.back()[0];
+   return std::move(s[0]);
+}
+
+//
+// Chinese remaindering over n residues and moduli by Garner's algorithm, which adds one
+// modulus at a time:
+//
+// x = x + M * ((r[i] - x) * M^-1 mod m[i]), M = M * m[i]
+//
+// This uses no containers, so for fixed precision types (which must have room for the
+// product of the moduli) it never allocates memory, and for a few moduli it is faster
+// than the product tree version above.  Throws a std::domain_error if the moduli are not
+// positive and pairwise coprime.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+crt(const number<Backend, ExpressionTemplates>* residues, const number<Backend, ExpressionTemplates>* moduli, std::size_t n)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+   // r * M^-1 needs double the width of a fixed precision modulus:
+   using wide_type = number<typename default_ops::double_precision_type<Backend>::type, ExpressionTemplates>;
+
+   number_type x(0u), M(1u), r, t;
+   wide_type   w;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      const number_type& m = moduli[i];
+      if (m.sign() <= 0)
+         BOOST_MP_THROW_EXCEPTION(std::domain_error("The modulus must be positive."));
+      // r = (residues[i] - x) mod m, computed without negative values so unsigned types work:
+      r = residues[i] % m;
+      if (r.sign() < 0)
+         r += m;
+      t = x % m;
+      if (r < t)
+         r += m;
+      r -= t;
+      t = M % m;
+      t = inverse_mod(t, m);
+      if ((t == 0u) && (m != 1u))
+         BOOST_MP_THROW_EXCEPTION(std::domain_error("The moduli passed to crt must be pairwise coprime."));
+      w = wide_type(r);
+      w *= wide_type(t);
+      w %= wide_type(m);
+      r = static_cast<number_type>(w);
+      r *= M;
+      x += r;
+      M *= m;
+   }
+   return x;
+}
+
+namespace detail {
+
+//
+// Calls f(p) for each odd prime p <= n, found with a sieve of Eratosthenes over the odd numbers:
+//
+template <class F>
+void for_each_odd_prime(unsigned n, F f)
+{
+   if (n < 3)
+      return;
+   // sieve[i] represents 2i + 3:
+   std::vector<unsigned char> sieve((n - 1) / 2, 1);
+   for (std::size_t i = 0; i < sieve.size(); ++i)
+   {
+      if (!sieve[i])
+         continue;
+      const std::size_t p = 2 * i + 3;
+      f(static_cast<unsigned>(p));
+      if (p > n / p)
+         continue;
+      for (std::size_t j = (p * p - 3) / 2; j < sieve.size(); j += p)
+         sieve[j] = 0;
+   }
+}
+//
+// Accumulates a product of small values: as many as will fit are multiplied together in a
+// single word before being added to the list for balanced_product.
+//
+template <class Integer>
+class packed_product
+{
+ public:
+   void push(unsigned p)
+   {
+      if (m_word > (std::numeric_limits<std::uint64_t>::max)() / p)
+      {
+         m_values.push_back(Integer(m_word));
+         m_word = p;
+      }
+      else
+         m_word *= p;
+   }
+   Integer result()
+   {
+      if (m_word != 1u)
+         m_values.push_back(Integer(m_word));
+      m_word = 1u;
+      return balanced_product(std::move(m_values), 1u);
+   }
+
+ private:
+   std::vector<Integer> m_values;
+   std::uint64_t        m_word = 1u;
+};
+//
+// Returns the product of p^e(p) over the odd primes p <= n, multiplied by 2^e(2):
+//
+// The primes are grouped by the bits of their exponents, with P[k] the product of the primes
+// whose exponent has bit k set, then the result is P[0] * (P[1] * (P[2] * ...)^2)^2, so that
+// the bulk of the work is in balanced products and squarings.
+//
+template <class Integer, class Exponent>
+Integer prime_power_product(unsigned n, Exponent e)
+{
+   std::vector<packed_product<Integer> > groups;
+   for_each_odd_prime(n, [&groups, &e](unsigned p) {
+      unsigned x = e(p);
+      for (std::size_t k = 0; x; ++k, x >>= 1)
+      {
+         if (x & 1u)
+         {
+            if (groups.size() <= k)
+               groups.resize(k + 1);
+            groups[k].push(p);
+         }
+      }
+   });
+   Integer result(1u);
+   for (std::size_t k = groups.size(); k-- > 0;)
+   {
+      if (result != 1u)
+         multiply(result, result, result);
+      Integer g = groups[k].result();
+      if (g != 1u)
+         result *= g;
+   }
+   return result << e(2u);
+}
+//
+// The exponent of the prime p in n!, by Legendre's formula:
+//
+inline unsigned factorial_exponent(unsigned n, unsigned p)
+{
+   unsigned e = 0;
+   for (unsigned q = n / p; q; q /= p)
+      e += q;
+   return e;
+}
+
+} // namespace detail
+
+//
+// Factorials, binomial coefficients and primorials.  Rather than multiplying 1 * 2 * ... * n
+// together, which can only ever multiply a large value by a small one, these factor the
+// result into primes and build it from balanced products, see for example:
+//
+// "Fast Factorial Functions", Peter Luschny, http://www.luschny.de/math/factorial/FastFactorialFunctions.htm
+//
+template <class Integer>
+typename std::enable_if<is_number<Integer>::value && (number_category<Integer>::value == number_kind_integer), Integer>::type
+factorial(unsigned n)
+{
+   return detail::prime_power_product<Integer>(n, [n](unsigned p) { return detail::factorial_exponent(n, p); });
+}
+
+//
+// The binomial coefficient n! / (k!(n-k)!), or 0 when k > n:
+//
+template <class Integer>
+typename std::enable_if<is_number<Integer>::value && (number_category<Integer>::value == number_kind_integer), Integer>::type
+binomial(unsigned n, unsigned k)
+{
+   if (k > n)
+      return Integer(0u);
+   return detail::prime_power_product<Integer>(n, [n, k](unsigned p) { return detail::factorial_exponent(n, p) - detail::factorial_exponent(k, p) - detail::factorial_exponent(n - k, p); });
+}
+
+//
+// The product of all the primes <= n:
+//
+template <class Integer>
+typename std::enable_if<is_number<Integer>::value && (number_category<Integer>::value == number_kind_integer), Integer>::type
+primorial(unsigned n)
+{
+   detail::packed_product<Integer> p;
+   detail::for_each_odd_prime(n, [&p](unsigned q) { p.push(q); });
+   return n < 2 ? Integer(1u) : Integer(p.result() << 1u);
+}
+
+namespace detail {
+
+//
+// Quadratic residue filters for is_square: bit r of each mask is set when r is a square
+// modulo 64, 63, 65 and 11 respectively (64 is also a square modulo 65).  A non-square
+// passes all four with probability (12/64)(16/63)(21/65)(6/11), or less than 1%.
+//
+constexpr std::uint64_t square_mask_64 = 0x202021202030213uLL;
+constexpr std::uint64_t square_mask_63 = 0x402483012450293uLL;
+constexpr std::uint64_t square_mask_65 = 0x218a019866014613uLL;
+constexpr std::uint64_t square_mask_11 = 0x23buLL;
+
+inline bool is_square_residue(std::uint32_t r)
+{
+   // r is the value modulo 64 * 63 * 65 * 11:
+   if (!((square_mask_64 >> (r % 64)) & 1u) || !((square_mask_63 >> (r % 63)) & 1u))
+      return false;
+   const std::uint32_t r65 = r % 65;
+   if ((r65 != 64) && !((square_mask_65 >> r65) & 1u))
+      return false;
+   return (square_mask_11 >> (r % 11)) & 1u;
+}
+//
+// Returns true if x >= 0 is a perfect square, and sets s to its root if it is:
+//
+template <class Integer>
+bool is_square_imp(const Integer& x, Integer& s)
+{
+   if (!(x > 0))
+   {
+      s = 0u;
+      return x == 0;
+   }
+   if (!is_square_residue(integer_modulus(x, static_cast<std::uint32_t>(64uL * 63 * 65 * 11))))
+      return false;
+   Integer r;
+   s = sqrt(x, r);
+   return r == 0;
+}
+//
+// Floor of the k'th root of x >= 0, for k > 2.
+//
+// The top half of the root's bits are the root of x >> k*s, found recursively, and give a
+// starting value just above the root, from which Newton's iteration
+//
+// y = ((k - 1)y + x / y^(k-1)) / k
+//
+// converges down to the root in one or two steps.  Small roots are found from a floating
+// point estimate.
+//
+template <class Integer>
+double log2_estimate(const Integer& x)
+{
+   const std::size_t bits  = msb(x) + 1;
+   const std::size_t shift = bits > 64 ? bits - 64 : 0;
+   return std::log2(static_cast<double>(static_cast<std::uint64_t>(Integer(x >> shift)))) + static_cast<double>(shift);
+}
+
+//
+// Returns the sign of y^k - x for y > 0, by binary powering which stops as soon as a partial
+// product exceeds x, so that nothing larger than x is ever formed in a fixed width Integer:
+//
+template <class Integer>
+int compare_power(const Integer& y, unsigned k, const Integer& x)
+{
+   Integer result(1u), base(y);
+   for (;;)
+   {
+      if (k & 1u)
+      {
+         if (result > x / base)
+            return 1;
+         result *= base;
+      }
+      k >>= 1;
+      if (!k)
+         break;
+      if (base > x / base)
+         return 1;
+      base *= base;
+   }
+   return result < x ? -1 : result > x ? 1 : 0;
+}
+
+template <class Integer>
+Integer nth_root_imp(const Integer& x, unsigned k)
+{
+   if (x < 2u)
+      return x;
+   const std::size_t bits = msb(x) + 1;
+   if (k >= bits)
+      return Integer(1u); // x < 2^k
+   const std::size_t root_bits = (bits + k - 1) / k;
+   Integer           y;
+   if (root_bits <= 32)
+   {
+      y = static_cast<std::uint64_t>(std::exp2(log2_estimate(x) / k));
+      while ((y > 1u) && (compare_power(y, k, x) > 0))
+         --y;
+      while (compare_power(Integer(y + 1u), k, x) <= 0)
+         ++y;
+      return y;
+   }
+   const std::size_t s = root_bits / 2;
+   y = nth_root_imp(Integer(x >> (k * s)), k);
+   ++y;
+   y <<= s;
+   Integer t, q;
+   for (;;)
+   {
+      t = pow(y, k - 1);
+      q = x / t;
+      if (q >= y)
+         break;
+      y *= k - 1;
+      y += q;
+      y /= k;
+   }
+   return y;
+}
+//
+// Checks whether x > 1 is a p'th power for odd prime p: first against the p'th power residues
+// modulo a few small primes q = 1 mod p, each of which rejects a random x with probability
+// about 1 - 1/p.  Then a candidate root is found, from a floating point estimate when it is
+// small (an exact root is then well within the precision of a double), and checked modulo a
+// 32-bit prime before the full power is computed.
+//
+inline std::uint32_t small_powm(std::uint32_t a, std::uint32_t e, std::uint32_t q)
+{
+   std::uint64_t r = 1, b = a;
+   for (; e; e >>= 1)
+   {
+      if (e & 1u)
+         r = r * b % q;
+      b = b * b % q;
+   }
+   return static_cast<std::uint32_t>(r);
+}
+inline bool is_small_prime(std::uint32_t q)
+{
+   for (std::uint32_t d = 2; d * d <= q; ++d)
+      if (q % d == 0)
+         return false;
+   return q > 1;
+}
+template <class Integer>
+bool is_exact_power(const Integer& x, unsigned p, Integer& root)
+{
+   if (p == 2)
+      return is_square_imp(x, root);
+   unsigned tested = 0;
+   for (std::uint32_t q = 2 * p + 1; (q < 65536u) && (tested < 4); q += 2 * p)
+   {
+      if (!is_small_prime(q))
+         continue;
+      const std::uint32_t a = integer_modulus(x, q);
+      if (a && (small_powm(a, (q - 1) / p, q) != 1))
+         return false;
+      ++tested;
+   }
+   if ((msb(x) + p) / p <= 32)
+      root = static_cast<std::uint64_t>(std::llround(std::exp2(log2_estimate(x) / p)));
+   else
+      root = nth_root_imp(x, p);
+   const std::uint32_t q = 4294967291u;
+   if (small_powm(integer_modulus(root, q), p, q) != integer_modulus(x, q))
+      return false;
+   return (root > 0u) && (compare_power(root, p, x) == 0);
+}
+
+} // namespace detail
+
+//
+// Returns true if x is the square of an integer.  Quadratic residue filters reject over
+// 99% of non-squares before any root is computed.
+//
+template <class Integer>
+typename std::enable_if<boost::multiprecision::detail::is_integral<Integer>::value || (is_number<Integer>::value && (number_category<Integer>::value == number_kind_integer)), bool>::type
+is_square(const Integer& x)
+{
+   Integer s;
+   return detail::is_square_imp(x, s);
+}
+
+//
+// The k'th root of x rounded toward zero.  Throws a std::domain_error if k is zero, or
+// x is negative and k even.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+nth_root(const number<Backend, ExpressionTemplates>& x, unsigned k)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   if (k == 0)
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("nth_root requires k > 0."));
+   if (x.sign() < 0)
+   {
+      if (!(k & 1u))
+         BOOST_MP_THROW_EXCEPTION(std::domain_error("nth_root of a negative value requires an odd k."));
+      return number_type(0u) - nth_root(number_type(number_type(0u) - x), k);
+   }
+   if (k == 1)
+      return x;
+   if (k == 2)
+      return sqrt(x);
+   return detail::nth_root_imp(x, k);
+}
+
+//
+// Returns true if x = root^k for some integer root and k > 1, and sets root and k with k
+// as large as possible.  0 and 1 are squares, and -1 a cube.
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, bool>::type
+is_perfect_power(const number<Backend, ExpressionTemplates>& x, number<Backend, ExpressionTemplates>& root, unsigned& k)
+{
+   using number_type = number<Backend, ExpressionTemplates>;
+
+   const bool  negative = x.sign() < 0;
+   number_type y        = negative ? number_type(number_type(0u) - x) : x;
+   if (y < 2u)
+   {
+      root = x;
+      k    = negative ? 3 : 2;
+      return true;
+   }
+   //
+   // Candidate exponents are the primes up to log2(y), tested in increasing order so that
+   // on finding y = r^p, r can only be a p'th or higher power.  The root of an even y must
+   // have a power of 2 at least as large, so p divides the number of trailing zeros:
+   //
+   std::vector<unsigned> primes;
+   if (!negative)
+      primes.push_back(2);
+   detail::for_each_odd_prime(static_cast<unsigned>(msb(y)), [&primes](unsigned p) { primes.push_back(p); });
+   number_type r;
+   k = 1;
+   std::size_t i = 0;
+   while ((i < primes.size()) && (primes[i] <= msb(y)))
+   {
+      const std::size_t zeros = lsb(y);
+      if ((!zeros || (zeros % primes[i] == 0)) && detail::is_exact_power(y, primes[i], r))
+      {
+         // Try the same p again on the root:
+         y.swap(r);
+         k *= primes[i];
+      }
+      else
+         ++i;
+   }
+   root = negative ? number_type(number_type(0u) - y) : y;
+   return k > 1;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+typename std::enable_if<number_category<Backend>::value == number_kind_integer, bool>::type
+is_perfect_power(const number<Backend, ExpressionTemplates>& x)
+{
+   number<Backend, ExpressionTemplates> root;
+   unsigned                             k;
+   return is_perfect_power(x, root, k);
+}
+
 }} // namespace boost::multiprecision
 
 #endif
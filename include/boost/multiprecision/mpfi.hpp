@@ -1255,6 +1255,14 @@ inline void eval_cos(mpfi_float_backend<Digits10>& result, const mpfi_float_back
    mpfi_cos(result.data(), arg.data());
 }
 
+template <unsigned Digits10>
+inline void eval_sincos(mpfi_float_backend<Digits10>& result_sin, mpfi_float_backend<Digits10>& result_cos, const mpfi_float_backend<Digits10>& arg)
+{
+   mpfi_float_backend<Digits10> x(arg);
+   mpfi_sin(result_sin.data(), x.data());
+   mpfi_cos(result_cos.data(), x.data());
+}
+
 template <unsigned Digits10>
 inline void eval_tan(mpfi_float_backend<Digits10>& result, const mpfi_float_backend<Digits10>& arg)
 {
@@ -1297,6 +1305,14 @@ inline void eval_cosh(mpfi_float_backend<Digits10>& result, const mpfi_float_bac
    mpfi_cosh(result.data(), arg.data());
 }
 
+template <unsigned Digits10>
+inline void eval_sinhcosh(mpfi_float_backend<Digits10>& result_sinh, mpfi_float_backend<Digits10>& result_cosh, const mpfi_float_backend<Digits10>& arg)
+{
+   mpfi_float_backend<Digits10> x(arg);
+   mpfi_sinh(result_sinh.data(), x.data());
+   mpfi_cosh(result_cosh.data(), x.data());
+}
+
 template <unsigned Digits10>
 inline void eval_tanh(mpfi_float_backend<Digits10>& result, const mpfi_float_backend<Digits10>& arg)
 {
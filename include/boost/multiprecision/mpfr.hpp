@@ -1860,6 +1860,12 @@ inline void eval_cos(mpfr_float_backend<Digits10, AllocateType>& result, const m
    mpfr_cos(result.data(), arg.data(), GMP_RNDN);
 }
 
+template <unsigned Digits10, mpfr_allocation_type AllocateType>
+inline void eval_sincos(mpfr_float_backend<Digits10, AllocateType>& result_sin, mpfr_float_backend<Digits10, AllocateType>& result_cos, const mpfr_float_backend<Digits10, AllocateType>& arg)
+{
+   mpfr_sin_cos(result_sin.data(), result_cos.data(), arg.data(), GMP_RNDN);
+}
+
 template <unsigned Digits10, mpfr_allocation_type AllocateType>
 inline void eval_tan(mpfr_float_backend<Digits10, AllocateType>& result, const mpfr_float_backend<Digits10, AllocateType>& arg)
 {
@@ -1902,6 +1908,12 @@ inline void eval_cosh(mpfr_float_backend<Digits10, AllocateType>& result, const
    mpfr_cosh(result.data(), arg.data(), GMP_RNDN);
 }
 
+template <unsigned Digits10, mpfr_allocation_type AllocateType>
+inline void eval_sinhcosh(mpfr_float_backend<Digits10, AllocateType>& result_sinh, mpfr_float_backend<Digits10, AllocateType>& result_cosh, const mpfr_float_backend<Digits10, AllocateType>& arg)
+{
+   mpfr_sinh_cosh(result_sinh.data(), result_cosh.data(), arg.data(), GMP_RNDN);
+}
+
 template <unsigned Digits10, mpfr_allocation_type AllocateType>
 inline void eval_tanh(mpfr_float_backend<Digits10, AllocateType>& result, const mpfr_float_backend<Digits10, AllocateType>& arg)
 {
@@ -2469,7 +2469,7 @@ struct component_type<boost::rational<I> >
 namespace std {
 
 template <class Backend, boost::multiprecision::expression_template_option ExpressionTemplates>
-struct hash<boost::multiprecision::number<Backend, ExpressionTemplates> >
+struct hash<boost::multiprecision::number<Backend, ExpressionTemplates> > : public boost::multiprecision::detail::avalanching_hash_base<Backend>
 {
    BOOST_MP_CXX14_CONSTEXPR std::size_t operator()(const boost::multiprecision::number<Backend, ExpressionTemplates>& val) const { return hash_value(val); }
 };
@@ -7,6 +7,7 @@
 #define BOOST_MP_RATIONAL_ADAPTOR_HPP
 
 #include <boost/multiprecision/number.hpp>
+#include <boost/multiprecision/detail/integer_ops.hpp>
 #include <boost/multiprecision/detail/hash.hpp>
 #include <boost/multiprecision/detail/float128_functions.hpp>
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
@@ -61,6 +62,7 @@ struct rational_adaptor
       using default_ops::eval_gcd;
       using default_ops::eval_eq;
       using default_ops::eval_divide;
+      using default_ops::eval_divide_exact;
       using default_ops::eval_get_sign;
 
       int s = eval_get_sign(m_denom);
@@ -79,9 +81,9 @@ struct rational_adaptor
       eval_gcd(g, m_num, m_denom);
       if (!eval_eq(g, one()))
       {
-         eval_divide(t, m_num, g);
+         eval_divide_exact(t, m_num, g);
          m_num.swap(t);
-         eval_divide(t, m_denom, g);
+         eval_divide_exact(t, m_denom, g);
          m_denom = std::move(t);
       }
    }
@@ -370,16 +372,31 @@ inline void eval_subtract(rational_adaptor<Backend>& a, const rational_adaptor<B
 template <class Backend> 
 inline void eval_multiply(rational_adaptor<Backend>& a, const rational_adaptor<Backend>& b)
 {
+   if (&a == &b)
+      return eval_multiply(a, a, b);
    eval_multiply_imp(a, a, b.num(), b.denom());
 }
 
 template <class Backend> 
 void eval_divide(rational_adaptor<Backend>& a, const rational_adaptor<Backend>& b)
 {
-   using default_ops::eval_divide;
-   rational_adaptor<Backend> t;
-   eval_divide(t, a, b);
-   a = std::move(t);
+   using default_ops::eval_get_sign;
+
+   if (eval_get_sign(b.num()) == 0)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::overflow_error("Integer division by zero"));
+      return;
+   }
+   if (&a == &b)
+   {
+      a.num() = a.denom() = rational_adaptor<Backend>::one();
+      return;
+   }
+   //
+   // eval_multiply_imp reads each component of a before overwriting it,
+   // so there is no need for a temporary here:
+   //
+   eval_multiply_imp(a, a, b.denom(), b.num());
 }
 //
 // Conversions:
@@ -419,10 +436,9 @@ inline typename std::enable_if<number_category<R>::value == number_kind_integer>
 template <class Backend>
 inline std::size_t hash_value(const rational_adaptor<Backend>& arg)
 {
-   std::size_t result = hash_value(arg.num());
-   std::size_t result2 = hash_value(arg.denom());
-   boost::multiprecision::detail::hash_combine(result, result2);
-   return result;
+   // Rationals are held in lowest terms, so equal values have equal parts:
+   const std::size_t parts[2] = {hash_value(arg.num()), hash_value(arg.denom())};
+   return boost::multiprecision::detail::hash_words(parts, 2, boost::multiprecision::detail::hash_secret2);
 }
 //
 // assign_components:
@@ -432,6 +448,7 @@ void assign_components(rational_adaptor<Backend>& result, Backend const& a, Back
 {
    using default_ops::eval_gcd;
    using default_ops::eval_divide;
+   using default_ops::eval_divide_exact;
    using default_ops::eval_eq;
    using default_ops::eval_is_zero;
    using default_ops::eval_get_sign;
@@ -449,8 +466,8 @@ void assign_components(rational_adaptor<Backend>& result, Backend const& a, Back
    }
    else
    {
-      eval_divide(result.num(), a, g);
-      eval_divide(result.denom(), b, g);
+      eval_divide_exact(result.num(), a, g);
+      eval_divide_exact(result.denom(), b, g);
    }
    if (eval_get_sign(result.denom()) < 0)
    {
@@ -613,6 +630,7 @@ void eval_add_subtract_imp(rational_adaptor<Backend>& result, const rational_ada
    using default_ops::eval_eq;
    using default_ops::eval_multiply;
    using default_ops::eval_divide;
+   using default_ops::eval_divide_exact;
    using default_ops::eval_add;
    using default_ops::eval_subtract;
    //
@@ -629,6 +647,27 @@ void eval_add_subtract_imp(rational_adaptor<Backend>& result, const rational_ada
    // And the whole thing can then be rescaled by
    //      gcd(rn, g)
    //
+   // When either denominator is one, g is trivially one as well, and we can
+   // skip the gcd altogether: this is the common case when rationals are mixed
+   // with integer valued data, and for cpp_int a gcd against a single limb
+   // still costs a full pass of long division.
+   //
+   if (eval_eq(b.denom(), rational_adaptor<Backend>::one()) && (&result != &b))
+   {
+      eval_add_subtract_imp(result, a, b.num(), isaddition);
+      return;
+   }
+   if (eval_eq(a.denom(), rational_adaptor<Backend>::one()) && (&result != &b))
+   {
+      // rn = an * bd +- bn, rd = bd:
+      eval_multiply(result.num(), b.denom(), a.num());
+      if (isaddition)
+         eval_add(result.num(), b.num());
+      else
+         eval_subtract(result.num(), b.num());
+      result.denom() = b.denom();
+      return;
+   }
    Backend gcd, t1, t2, t3, t4;
    //
    // Begin by getting the gcd of the 2 denominators:
@@ -642,8 +681,8 @@ void eval_add_subtract_imp(rational_adaptor<Backend>& result, const rational_ada
       //
       // Scale the denominators by gcd, and put the results in t1 and t2:
       //
-      eval_divide(t1, b.denom(), gcd);
-      eval_divide(t2, a.denom(), gcd);
+      eval_divide_exact(t1, b.denom(), gcd);
+      eval_divide_exact(t2, a.denom(), gcd);
       //
       // multiply the numerators by the scale denominators and put the results in t3, t4:
       //
@@ -674,8 +713,8 @@ void eval_add_subtract_imp(rational_adaptor<Backend>& result, const rational_ada
          // terms we'll be multiplying together, so there's a good chance it's a
          // single limb value already:
          //
-         eval_divide(result.num(), t3, t4);
-         eval_divide(t3, gcd, t4);
+         eval_divide_exact(result.num(), t3, t4);
+         eval_divide_exact(t3, gcd, t4);
          eval_multiply(t4, t1, t2);
          eval_multiply(result.denom(), t4, t3);
       }
@@ -760,18 +799,32 @@ void eval_multiply_imp(rational_adaptor<Backend>& result, const rational_adaptor
 {
    using default_ops::eval_multiply;
    using default_ops::eval_divide;
+   using default_ops::eval_divide_exact;
    using default_ops::eval_gcd;
    using default_ops::eval_get_sign;
    using default_ops::eval_eq;
 
+   //
+   // Henrici's method: cross cancel a.num() against b_denom and b_num
+   // against a.denom() so that the products formed are already in lowest terms.
+   // A unit denominator makes the corresponding gcd trivially one, so skip it:
+   //
    Backend gcd_left, gcd_right, t1, t2;
-   eval_gcd(gcd_left, a.num(), b_denom);
-   eval_gcd(gcd_right, b_num, a.denom());
+   bool b_left = eval_eq(b_denom, rational_adaptor<Backend>::one());
+   bool b_right = eval_eq(a.denom(), rational_adaptor<Backend>::one());
+   if (!b_left)
+   {
+      eval_gcd(gcd_left, a.num(), b_denom);
+      b_left = eval_eq(gcd_left, rational_adaptor<Backend>::one());
+   }
+   if (!b_right)
+   {
+      eval_gcd(gcd_right, b_num, a.denom());
+      b_right = eval_eq(gcd_right, rational_adaptor<Backend>::one());
+   }
    //
    // Unit gcd's are the most likely case:
    //
-   bool b_left = eval_eq(gcd_left, rational_adaptor<Backend>::one());
-   bool b_right = eval_eq(gcd_right, rational_adaptor<Backend>::one());
 
    if (b_left && b_right)
    {
@@ -780,25 +833,25 @@ void eval_multiply_imp(rational_adaptor<Backend>& result, const rational_adaptor
    }
    else if (b_left)
    {
-      eval_divide(t2, b_num, gcd_right);
+      eval_divide_exact(t2, b_num, gcd_right);
       eval_multiply(result.num(), a.num(), t2);
-      eval_divide(t1, a.denom(), gcd_right);
+      eval_divide_exact(t1, a.denom(), gcd_right);
       eval_multiply(result.denom(), t1, b_denom);
    }
    else if (b_right)
    {
-      eval_divide(t1, a.num(), gcd_left);
+      eval_divide_exact(t1, a.num(), gcd_left);
       eval_multiply(result.num(), t1, b_num);
-      eval_divide(t2, b_denom, gcd_left);
+      eval_divide_exact(t2, b_denom, gcd_left);
       eval_multiply(result.denom(), a.denom(), t2);
    }
    else
    {
-      eval_divide(t1, a.num(), gcd_left);
-      eval_divide(t2, b_num, gcd_right);
+      eval_divide_exact(t1, a.num(), gcd_left);
+      eval_divide_exact(t2, b_num, gcd_right);
       eval_multiply(result.num(), t1, t2);
-      eval_divide(t1, a.denom(), gcd_right);
-      eval_divide(t2, b_denom, gcd_left);
+      eval_divide_exact(t1, a.denom(), gcd_right);
+      eval_divide_exact(t2, b_denom, gcd_left);
       eval_multiply(result.denom(), t1, t2);
    }
    //
@@ -866,6 +919,7 @@ void eval_multiply_imp(Backend& result_num, Backend& result_denom, Backend arg)
 {
    using default_ops::eval_multiply;
    using default_ops::eval_divide;
+   using default_ops::eval_divide_exact;
    using default_ops::eval_gcd;
    using default_ops::eval_convert_to;
    using default_ops::eval_is_zero;
@@ -885,7 +939,7 @@ void eval_multiply_imp(Backend& result_num, Backend& result_denom, Backend arg)
    eval_gcd(gcd, result_denom, arg);
    if (!eval_eq(gcd, rational_adaptor<Backend>::one()))
    {
-      eval_divide(t, arg, gcd);
+      eval_divide_exact(t, arg, gcd);
       arg = t;
    }
    else
@@ -902,7 +956,7 @@ void eval_multiply_imp(Backend& result_num, Backend& result_denom, Backend arg)
       result_num.negate();
    if (!eval_eq(gcd, rational_adaptor<Backend>::one()))
    {
-      eval_divide(t, result_denom, gcd);
+      eval_divide_exact(t, result_denom, gcd);
       result_denom = std::move(t);
    }
 }
@@ -1086,6 +1140,7 @@ void eval_divide(rational_adaptor<Backend>& result, const rational_adaptor<Backe
    using default_ops::eval_gcd;
    using default_ops::eval_convert_to;
    using default_ops::eval_divide;
+   using default_ops::eval_divide_exact;
    using default_ops::eval_is_zero;
    using default_ops::eval_eq;
    using default_ops::eval_get_sign;
@@ -1108,7 +1163,7 @@ void eval_divide(rational_adaptor<Backend>& result, const rational_adaptor<Backe
    bool has_unit_gcd = eval_eq(gcd, rational_adaptor<Backend>::one());
    if (!has_unit_gcd)
    {
-      eval_divide(u_arg, arg, gcd);
+      eval_divide_exact(u_arg, arg, gcd);
       arg = u_arg;
    }
    else
@@ -1121,7 +1176,7 @@ void eval_divide(rational_adaptor<Backend>& result, const rational_adaptor<Backe
    
    if (!has_unit_gcd)
    {
-      eval_divide(t, a.num(), gcd);
+      eval_divide_exact(t, a.num(), gcd);
       result.num() = std::move(t);
    }
    else if (&result != &a)
@@ -1254,6 +1309,13 @@ template <class Backend>
 struct is_unsigned_number<rational_adaptor<Backend> > : public is_unsigned_number<Backend>
 {};
 
+namespace detail {
+
+template <class Backend>
+struct is_avalanching_hash<rational_adaptor<Backend> > : public std::integral_constant<bool, true>
+{};
+
+} // namespace detail
 
 }} // namespace boost::multiprecision
 
@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_WRITE_DIGITS_HPP
+#define BOOST_MP_WRITE_DIGITS_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+#include <boost/multiprecision/charconv.hpp>
+#include <boost/multiprecision/detail/digit_writer.hpp>
+
+//
+// Writes the digits of very large values to an output iterator or stream as they are
+// generated, through a small fixed size buffer, rather than building the whole string
+// first as str() does.
+//
+// cpp_int digits are generated most significant first by divide and conquer: a value is
+// split by the power base^(L * 2^i) which is closest to its square root, and the quotient
+// then the remainder are written in turn, down to pieces of L digits which are converted
+// directly.  Only the pieces on the current path are held at any one time.  Power of 2
+// bases read the digits straight out of the bits.
+//
+// cpp_dec_float digits are read directly from its base 10^8 limbs.
+//
+#ifndef BOOST_MP_WRITE_DIGITS_LEAF_LIMBS
+#define BOOST_MP_WRITE_DIGITS_LEAF_LIMBS 16
+#endif
+#ifndef BOOST_MP_WRITE_DIGITS_BUFFER
+#define BOOST_MP_WRITE_DIGITS_BUFFER 4096
+#endif
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+template <class OutputIterator>
+struct digit_iterator_sink
+{
+   OutputIterator out;
+
+   void write(const char* p, std::size_t n) { out = std::copy(p, p + n, out); }
+};
+
+struct digit_ostream_sink
+{
+   std::ostream& os;
+
+   void write(const char* p, std::size_t n) { os.write(p, static_cast<std::streamsize>(n)); }
+};
+
+//
+// Collects characters and passes them on to the sink a buffer full at a time:
+//
+template <class Sink>
+class digit_buffer
+{
+   Sink&       m_sink;
+   std::size_t m_size;
+   char        m_buffer[BOOST_MP_WRITE_DIGITS_BUFFER];
+
+ public:
+   explicit digit_buffer(Sink& sink) noexcept : m_sink(sink), m_size(0) {}
+
+   void put(char c)
+   {
+      if (m_size == sizeof(m_buffer))
+         flush();
+      m_buffer[m_size++] = c;
+   }
+   void write(const char* p, std::size_t n)
+   {
+      while (n)
+      {
+         if (m_size == sizeof(m_buffer))
+            flush();
+         const std::size_t count = (std::min)(n, sizeof(m_buffer) - m_size);
+         std::memcpy(m_buffer + m_size, p, count);
+         m_size += count;
+         p += count;
+         n -= count;
+      }
+   }
+   void fill(char c, std::size_t n)
+   {
+      while (n)
+      {
+         if (m_size == sizeof(m_buffer))
+            flush();
+         const std::size_t count = (std::min)(n, sizeof(m_buffer) - m_size);
+         std::memset(m_buffer + m_size, c, count);
+         m_size += count;
+         n -= count;
+      }
+   }
+   void flush()
+   {
+      m_sink.write(m_buffer, m_size);
+      m_size = 0;
+   }
+};
+
+template <class Buffer>
+inline void write_pow2_digits(Buffer& out, const limb_type* p, std::size_t n, unsigned base)
+{
+   constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+   while (n && !p[n - 1])
+      --n;
+   if (!n)
+   {
+      out.put('0');
+      return;
+   }
+   const unsigned    shift = boost::multiprecision::detail::find_msb(base);
+   const std::size_t bits  = (n - 1) * limb_bits + boost::multiprecision::detail::find_msb(p[n - 1]) + 1;
+   for (std::size_t i = (bits + shift - 1) / shift; i-- > 0;)
+   {
+      const std::size_t bit = i * shift, limb = bit / limb_bits, offset = bit % limb_bits;
+      limb_type         d   = p[limb] >> offset;
+      if ((offset + shift > limb_bits) && (limb + 1 < n))
+         d |= p[limb + 1] << (limb_bits - offset);
+      out.put(chars_digit(static_cast<unsigned>(d & (base - 1))));
+   }
+}
+
+//
+// Divide and conquer conversion of a cpp_int: m_powers[i] = base^(m_leaf_digits * 2^i), is
+// extended as far as required by the values written:
+//
+template <class Buffer>
+class integer_digit_writer
+{
+   static constexpr unsigned leaf_blocks = BOOST_MP_WRITE_DIGITS_LEAF_LIMBS * sizeof(limb_type) * CHAR_BIT / 32;
+
+   Buffer&              m_out;
+   unsigned             m_base;
+   std::size_t          m_leaf_digits;
+   std::vector<cpp_int> m_powers;
+
+   //
+   // Writes the magnitude of x, which is less than m_powers[0], padded with zeros to
+   // m_leaf_digits when pad is set:
+   //
+   void write_leaf(const cpp_int& x, bool pad)
+   {
+      limb_type   p[BOOST_MP_WRITE_DIGITS_LEAF_LIMBS];
+      char        digits[BOOST_MP_WRITE_DIGITS_LEAF_LIMBS * sizeof(limb_type) * CHAR_BIT];
+      std::size_t n = x.backend().size();
+      BOOST_MP_ASSERT(n <= BOOST_MP_WRITE_DIGITS_LEAF_LIMBS);
+      std::copy(x.backend().limbs(), x.backend().limbs() + n, p);
+      while (n && !p[n - 1])
+         --n;
+      char* const last  = digits + sizeof(digits);
+      char*       pos   = m_base == 10 ? chars_write_limbs_backwards<10>(digits, last, p, n, m_base) : chars_write_limbs_backwards<0>(digits, last, p, n, m_base);
+      std::size_t count = static_cast<std::size_t>(last - pos);
+      if (pad)
+         m_out.fill('0', m_leaf_digits - count);
+      else if (!count)
+         m_out.put('0');
+      m_out.write(pos, count);
+   }
+   //
+   // Writes the magnitude of x, which is less than m_powers[level - 1]^2 when level > 0,
+   // by splitting it at m_powers[level - 1]:
+   //
+   void write_level(const cpp_int& x, std::size_t level, bool pad)
+   {
+      if (!level)
+         return write_leaf(x, pad);
+      const cpp_int& p = m_powers[level - 1];
+      if (!pad && (x.backend().compare_unsigned(p.backend()) < 0))
+         return write_level(x, level - 1, false);
+      cpp_int r;
+      {
+         // The quotient is released before the remainder is written:
+         cpp_int q;
+         divide_qr(x, p, q, r);
+         write_level(q, level - 1, pad);
+      }
+      write_level(r, level - 1, true);
+   }
+
+ public:
+   integer_digit_writer(Buffer& out, unsigned base) : m_out(out), m_base(base), m_leaf_digits(leaf_blocks * chars_block_digits(base))
+   {
+      m_powers.push_back(pow(cpp_int(chars_block(base)), leaf_blocks));
+   }
+
+   void write(const cpp_int& x)
+   {
+      std::size_t level = 0;
+      if (x.backend().compare_unsigned(m_powers[0].backend()) >= 0)
+      {
+         constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+         const std::size_t     n         = x.backend().size();
+         const std::size_t     bits      = (n - 1) * limb_bits + boost::multiprecision::detail::find_msb(x.backend().limbs()[n - 1]) + 1;
+         for (level = 1; bits > 2 * msb(m_powers[level - 1]); ++level)
+         {
+            if (m_powers.size() == level)
+               m_powers.push_back(m_powers[level - 1] * m_powers[level - 1]);
+         }
+      }
+      write_level(x, level, false);
+   }
+};
+
+inline const cpp_int& digit_cpp_int(const cpp_int& v) noexcept { return v; }
+template <class Number>
+inline cpp_int digit_cpp_int(const Number& v) { return cpp_int(v); }
+
+template <class Buffer, class Backend, expression_template_option ExpressionTemplates>
+inline void write_integer_digits(Buffer& out, const number<Backend, ExpressionTemplates>& v, unsigned base, const std::integral_constant<bool, true>&)
+{
+   // Trivial cpp_int's are small enough to convert in one go:
+   char                  buffer[2 * sizeof(limb_type) * CHAR_BIT + 2];
+   const to_chars_result r = to_chars(buffer, buffer + sizeof(buffer), v, static_cast<int>(base));
+   out.write(buffer, static_cast<std::size_t>(r.ptr - buffer));
+}
+template <class Buffer, class Backend, expression_template_option ExpressionTemplates>
+inline void write_integer_digits(Buffer& out, const number<Backend, ExpressionTemplates>& v, unsigned base, const std::integral_constant<bool, false>&)
+{
+   const Backend& b = v.backend();
+   if (b.sign() && ((b.size() > 1) || b.limbs()[0]))
+      out.put('-');
+   if ((base & (base - 1)) == 0)
+      write_pow2_digits(out, b.limbs(), b.size(), base);
+   else
+   {
+      integer_digit_writer<Buffer> w(out, base);
+      w.write(digit_cpp_int(v));
+   }
+}
+
+} // namespace detail
+
+//
+// Writes the digits of a cpp_int in base 2 to 36 to out, with a leading '-' for negative
+// values and no prefix, the same text as to_chars.  Returns the end of the output:
+//
+template <class OutputIterator, class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<detail::is_chars_cpp_int<Backend>::value && !std::is_base_of<std::ios_base, OutputIterator>::value, OutputIterator>::type
+write_digits(OutputIterator out, const number<Backend, ExpressionTemplates>& v, int base = 10)
+{
+   BOOST_MP_ASSERT((base >= 2) && (base <= 36));
+   using is_trivial = std::integral_constant<bool, backends::is_trivial_cpp_int<Backend>::value>;
+   detail::digit_iterator_sink<OutputIterator>                      sink{out};
+   detail::digit_buffer<detail::digit_iterator_sink<OutputIterator> > buffer(sink);
+   detail::write_integer_digits(buffer, v, static_cast<unsigned>(base), is_trivial());
+   buffer.flush();
+   return sink.out;
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<detail::is_chars_cpp_int<Backend>::value, std::ostream&>::type
+write_digits(std::ostream& os, const number<Backend, ExpressionTemplates>& v, int base = 10)
+{
+   BOOST_MP_ASSERT((base >= 2) && (base <= 36));
+   using is_trivial = std::integral_constant<bool, backends::is_trivial_cpp_int<Backend>::value>;
+   detail::digit_ostream_sink                      sink{os};
+   detail::digit_buffer<detail::digit_ostream_sink> buffer(sink);
+   detail::write_integer_digits(buffer, v, static_cast<unsigned>(base), is_trivial());
+   buffer.flush();
+   return os;
+}
+
+//
+// Writes a cpp_dec_float with the same text as v.str(digits, f), in fixed notation when
+// f has std::ios_base::fixed set and otherwise scientific.  In scientific notation, digits
+// of zero writes max_digits10 significant digits:
+//
+template <class OutputIterator, unsigned Digits10, class ExponentType, class Allocator, expression_template_option ExpressionTemplates>
+inline typename std::enable_if<!std::is_base_of<std::ios_base, OutputIterator>::value, OutputIterator>::type
+write_digits(OutputIterator out, const number<backends::cpp_dec_float<Digits10, ExponentType, Allocator>, ExpressionTemplates>& v, std::streamsize digits = 0, std::ios_base::fmtflags f = std::ios_base::scientific)
+{
+   detail::digit_iterator_sink<OutputIterator>                      sink{out};
+   detail::digit_buffer<detail::digit_iterator_sink<OutputIterator> > buffer(sink);
+   detail::digit_writer<backends::cpp_dec_float<Digits10, ExponentType, Allocator> >(v.backend()).write(buffer, digits, f);
+   buffer.flush();
+   return sink.out;
+}
+template <unsigned Digits10, class ExponentType, class Allocator, expression_template_option ExpressionTemplates>
+inline std::ostream& write_digits(std::ostream& os, const number<backends::cpp_dec_float<Digits10, ExponentType, Allocator>, ExpressionTemplates>& v, std::streamsize digits = 0, std::ios_base::fmtflags f = std::ios_base::scientific)
+{
+   detail::digit_ostream_sink                      sink{os};
+   detail::digit_buffer<detail::digit_ostream_sink> buffer(sink);
+   detail::digit_writer<backends::cpp_dec_float<Digits10, ExponentType, Allocator> >(v.backend()).write(buffer, digits, f);
+   buffer.flush();
+   return os;
+}
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_WRITE_DIGITS_HPP
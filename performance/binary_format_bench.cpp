@@ -0,0 +1,169 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Saving and loading values with write_to and read_from, compared with Boost.Serialization's
+// binary archives, as when storing values in a database or sending them over a network.
+//
+#include <random>
+#include <sstream>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/multiprecision/binary_format.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace boost::multiprecision;
+
+template <class Number>
+Number scale(const Number& x, unsigned, const std::integral_constant<bool, true>&)
+{
+   return x;
+}
+template <class Number>
+Number scale(const Number& x, unsigned bits, const std::integral_constant<bool, false>&)
+{
+   static std::mt19937 gen;
+   return ldexp(x, static_cast<int>(gen() % 200) - 100 - static_cast<int>(bits));
+}
+
+//
+// Values with the given number of random bits, floating point values are scaled to around 1:
+//
+template <class Number>
+std::vector<Number> get_values(unsigned bits)
+{
+   static std::mt19937 gen;
+   std::vector<Number> result;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      cpp_int v = 0;
+      for (unsigned j = 0; j < bits; j += 32)
+      {
+         v <<= 32;
+         v += gen();
+      }
+      if (gen() & 1u)
+         v = -v;
+      result.push_back(scale(Number(v), bits, std::integral_constant<bool, std::numeric_limits<Number>::is_integer>()));
+   }
+   return result;
+}
+
+template <class Number>
+void BM_write_to(benchmark::State& state)
+{
+   std::vector<Number>        values = get_values<Number>(static_cast<unsigned>(state.range(0)));
+   std::vector<unsigned char> buf(values.size() * (binary_size(values[0]) + 16));
+   for (auto _ : state)
+   {
+      write_to_result r{buf.data(), std::errc()};
+      for (const Number& v : values)
+         r = write_to(r.ptr, buf.data() + buf.size(), v);
+      benchmark::DoNotOptimize(r);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <class Number>
+void BM_read_from(benchmark::State& state)
+{
+   std::vector<Number>        values = get_values<Number>(static_cast<unsigned>(state.range(0)));
+   std::vector<unsigned char> buf(values.size() * (binary_size(values[0]) + 16));
+   write_to_result            w{buf.data(), std::errc()};
+   for (const Number& v : values)
+      w = write_to(w.ptr, buf.data() + buf.size(), v);
+   Number x;
+   for (auto _ : state)
+   {
+      read_from_result r{buf.data(), std::errc()};
+      while (r.ptr != w.ptr)
+      {
+         r = read_from(r.ptr, w.ptr, x);
+         benchmark::DoNotOptimize(x);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <class Number>
+void BM_serialize_save(benchmark::State& state)
+{
+   std::vector<Number> values = get_values<Number>(static_cast<unsigned>(state.range(0)));
+   for (auto _ : state)
+   {
+      std::stringstream               ss;
+      boost::archive::binary_oarchive oa(ss, boost::archive::no_header);
+      for (const Number& v : values)
+         oa << v;
+      benchmark::DoNotOptimize(ss);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <class Number>
+void BM_serialize_load(benchmark::State& state)
+{
+   std::vector<Number> values = get_values<Number>(static_cast<unsigned>(state.range(0)));
+   std::stringstream   ss;
+   {
+      boost::archive::binary_oarchive oa(ss, boost::archive::no_header);
+      for (const Number& v : values)
+         oa << v;
+   }
+   const std::string saved = ss.str();
+   Number            x;
+   for (auto _ : state)
+   {
+      std::stringstream               in(saved);
+      boost::archive::binary_iarchive ia(in, boost::archive::no_header);
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         ia >> x;
+         benchmark::DoNotOptimize(x);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK_TEMPLATE(BM_serialize_save, cpp_int)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_write_to, cpp_int)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_serialize_load, cpp_int)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_read_from, cpp_int)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_serialize_save, int256_t)->Arg(224);
+BENCHMARK_TEMPLATE(BM_write_to, int256_t)->Arg(224);
+BENCHMARK_TEMPLATE(BM_serialize_load, int256_t)->Arg(224);
+BENCHMARK_TEMPLATE(BM_read_from, int256_t)->Arg(224);
+BENCHMARK_TEMPLATE(BM_serialize_save, cpp_bin_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_write_to, cpp_bin_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_serialize_load, cpp_bin_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_read_from, cpp_bin_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_serialize_save, cpp_dec_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_write_to, cpp_dec_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_serialize_load, cpp_dec_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_read_from, cpp_dec_float_50)->Arg(160);
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times in ns per value, arguments are the number of random bits:
+
+                                   Boost.Serialization binary archive     write_to / read_from
+save cpp_int/256                                 144                            19
+save cpp_int/4096                                653                            33
+load cpp_int/256                                 126                            21
+load cpp_int/4096                                155                            25
+save int256_t/224                                148                            12
+load int256_t/224                                130                            20
+save cpp_bin_float_50/160                        209                            24
+load cpp_bin_float_50/160                        164                            47
+save cpp_dec_float_50/160                        285                            21
+load cpp_dec_float_50/160                        212                            62
+
+Part of the archive times is the stream, but both directions also go through the backend's
+own serialization code a limb at a time, where write_to and read_from use memcpy.
+*/
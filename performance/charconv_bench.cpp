@@ -0,0 +1,157 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// to_chars and from_chars compared with str() and construction from a string.
+//
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/charconv.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_double_fp.hpp>
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+Integer get_integer()
+{
+   static std::mt19937 gen;
+   Integer             x = 0;
+   for (unsigned j = 0; j < std::numeric_limits<uint256_t>::digits; j += 32)
+   {
+      x <<= 32;
+      x += gen();
+   }
+   return x;
+}
+
+template <class Float>
+Float get_float()
+{
+   static std::mt19937 gen;
+   return Float(gen()) / gen() * 1e10;
+}
+
+template <class Integer>
+void BM_integer_str(benchmark::State& state)
+{
+   Integer x = get_integer<Integer>();
+   for (auto _ : state)
+      benchmark::DoNotOptimize(x.str());
+}
+template <class Integer>
+void BM_integer_to_chars(benchmark::State& state)
+{
+   Integer x = get_integer<Integer>();
+   char    buf[100];
+   for (auto _ : state)
+      benchmark::DoNotOptimize(to_chars(buf, buf + sizeof(buf), x).ptr);
+}
+template <class Integer>
+void BM_integer_construct(benchmark::State& state)
+{
+   std::string s = get_integer<Integer>().str();
+   for (auto _ : state)
+      benchmark::DoNotOptimize(Integer(s));
+}
+template <class Integer>
+void BM_integer_from_chars(benchmark::State& state)
+{
+   std::string s = get_integer<Integer>().str();
+   Integer     x;
+   for (auto _ : state)
+   {
+      from_chars(s.data(), s.data() + s.size(), x);
+      benchmark::DoNotOptimize(x);
+   }
+}
+
+template <class Float>
+void BM_float_str(benchmark::State& state)
+{
+   Float x = get_float<Float>();
+   for (auto _ : state)
+      benchmark::DoNotOptimize(x.str(std::numeric_limits<Float>::max_digits10 - 1, std::ios_base::scientific));
+}
+template <class Float>
+void BM_float_to_chars(benchmark::State& state)
+{
+   Float x = get_float<Float>();
+   char  buf[100];
+   for (auto _ : state)
+      benchmark::DoNotOptimize(to_chars(buf, buf + sizeof(buf), x, chars_format::scientific, std::numeric_limits<Float>::max_digits10 - 1).ptr);
+}
+
+//
+// Shortest round trip output, compared with the usual approach of trying more and more digits:
+//
+template <class Float>
+void BM_float_shortest_str(benchmark::State& state)
+{
+   Float x = get_float<Float>();
+   for (auto _ : state)
+   {
+      std::string s;
+      for (std::streamsize digits = 1; digits <= std::numeric_limits<Float>::max_digits10; ++digits)
+      {
+         s = x.str(digits, std::ios_base::scientific);
+         if (Float(s) == x)
+            break;
+      }
+      benchmark::DoNotOptimize(s);
+   }
+}
+template <class Float>
+void BM_float_shortest(benchmark::State& state)
+{
+   Float x = get_float<Float>();
+   char  buf[100];
+   for (auto _ : state)
+      benchmark::DoNotOptimize(to_chars(buf, buf + sizeof(buf), x).ptr);
+}
+
+BENCHMARK_TEMPLATE(BM_integer_str, uint256_t);
+BENCHMARK_TEMPLATE(BM_integer_to_chars, uint256_t);
+BENCHMARK_TEMPLATE(BM_integer_str, cpp_int);
+BENCHMARK_TEMPLATE(BM_integer_to_chars, cpp_int);
+BENCHMARK_TEMPLATE(BM_integer_construct, uint256_t);
+BENCHMARK_TEMPLATE(BM_integer_from_chars, uint256_t);
+BENCHMARK_TEMPLATE(BM_integer_construct, cpp_int);
+BENCHMARK_TEMPLATE(BM_integer_from_chars, cpp_int);
+BENCHMARK_TEMPLATE(BM_float_str, cpp_bin_float_double);
+BENCHMARK_TEMPLATE(BM_float_to_chars, cpp_bin_float_double);
+BENCHMARK_TEMPLATE(BM_float_str, cpp_bin_float_50);
+BENCHMARK_TEMPLATE(BM_float_to_chars, cpp_bin_float_50);
+BENCHMARK_TEMPLATE(BM_float_str, cpp_double_double);
+BENCHMARK_TEMPLATE(BM_float_to_chars, cpp_double_double);
+BENCHMARK_TEMPLATE(BM_float_shortest_str, cpp_bin_float_double);
+BENCHMARK_TEMPLATE(BM_float_shortest, cpp_bin_float_double);
+BENCHMARK_TEMPLATE(BM_float_shortest_str, cpp_bin_float_50);
+BENCHMARK_TEMPLATE(BM_float_shortest, cpp_bin_float_50);
+BENCHMARK_TEMPLATE(BM_float_shortest_str, cpp_double_double);
+BENCHMARK_TEMPLATE(BM_float_shortest, cpp_double_double);
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times in ns, 256 bit integers and floating point values written with max_digits10 digits:
+
+                                     str() / string ctor    to_chars / from_chars
+BM_integer_str<uint256_t>                    404                    273
+BM_integer_str<cpp_int>                      785                    311
+BM_integer_construct<uint256_t>              208                    186
+BM_integer_construct<cpp_int>                273                    299
+BM_float_str<cpp_bin_float_double>           544                    345
+BM_float_str<cpp_bin_float_50>              1331                    524
+BM_float_str<cpp_double_double>             1243                    770
+
+Shortest round trip output:
+
+                                     str() at increasing precision    to_chars
+BM_float_shortest<cpp_bin_float_double>          15950                   1015
+BM_float_shortest<cpp_bin_float_50>             119975                   2784
+BM_float_shortest<cpp_double_double>             87214                   2828
+
+None of the to_chars calls, nor from_chars into uint256_t, allocate any memory.
+*/
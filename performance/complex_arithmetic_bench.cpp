@@ -0,0 +1,118 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compares complex_adaptor multiplication and division, build with
+// -DBOOST_MP_COMPLEX_FAST_ARITHMETIC_DIGITS10=100000 to disable the
+// Gauss multiplication and reciprocal division paths.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_complex.hpp>
+
+using namespace boost::multiprecision;
+
+template <class Complex>
+std::vector<Complex> get_data()
+{
+   using real_type = typename Complex::value_type;
+   static std::mt19937 gen;
+   std::vector<Complex> result;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      real_type x(static_cast<std::int64_t>(gen()) - 0x7FFFFFFF), y(static_cast<std::int64_t>(gen()) - 0x7FFFFFFF);
+      // Fill all the bits of the significand:
+      x /= gen() | 1u;
+      y /= gen() | 1u;
+      result.emplace_back(x, y);
+   }
+   return result;
+}
+
+template <class Complex>
+void BM_multiply(benchmark::State& state)
+{
+   std::vector<Complex> a = get_data<Complex>(), b = get_data<Complex>();
+   Complex              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i];
+         r *= b[i];
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+template <class Complex>
+void BM_square(benchmark::State& state)
+{
+   std::vector<Complex> a = get_data<Complex>();
+   Complex              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i];
+         r *= r;
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+template <class Complex>
+void BM_divide(benchmark::State& state)
+{
+   std::vector<Complex> a = get_data<Complex>(), b = get_data<Complex>();
+   Complex              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i];
+         r /= b[i];
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+using cpp_complex_200 = number<complex_adaptor<cpp_bin_float<200> >, et_off>;
+using cpp_complex_500 = number<complex_adaptor<cpp_bin_float<500> >, et_off>;
+
+BENCHMARK_TEMPLATE(BM_multiply, cpp_complex_50)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_multiply, cpp_complex_100)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_multiply, cpp_complex_200)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_multiply, cpp_complex_500)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_square, cpp_complex_50)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_square, cpp_complex_100)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_square, cpp_complex_500)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_divide, cpp_complex_50)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_divide, cpp_complex_100)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_divide, cpp_complex_200)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_divide, cpp_complex_500)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times in us for 1000 operations, medians of several noisy runs:
+
+                                  before    after
+BM_multiply<cpp_complex_100>         938      813   (4 multiplications both times)
+BM_multiply<cpp_complex_500>        6527     5555
+BM_square<cpp_complex_50>            471      349
+BM_square<cpp_complex_100>           929      578
+BM_square<cpp_complex_500>          5964     2966
+BM_divide<cpp_complex_50>           1900     1760
+BM_divide<cpp_complex_100>          3900     3300
+BM_divide<cpp_complex_200>          7500     5200
+BM_divide<cpp_complex_500>         17500    16000
+
+Gauss' multiplication is slower than the textbook formula until about 300 digits, as
+cpp_bin_float's additions are comparatively expensive, hence the separate thresholds.
+Division now also forms (a + bi)(c - di) with 4 multiplications below 400 digits: at 50, 100
+and 200 digits this measured 1.8, 3.0 and 5.2ms against 1.6, 3.4 and 5.8ms for the Gauss form,
+within the noise of these runs, and it avoids the cancellation in k1 - k3.
+*/
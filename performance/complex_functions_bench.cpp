@@ -0,0 +1,69 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_complex.hpp>
+
+using namespace boost::multiprecision;
+
+template <class Complex>
+std::vector<Complex> get_data()
+{
+   using real_type = typename Complex::value_type;
+   static std::mt19937 gen;
+   std::vector<Complex> result;
+   for (unsigned i = 0; i < 100; ++i)
+   {
+      real_type x(static_cast<std::int64_t>(gen()) - 0x7FFFFFFF), y(static_cast<std::int64_t>(gen()) - 0x7FFFFFFF);
+      x /= 0x1FFFFFFF;
+      y /= 0x1FFFFFFF;
+      result.emplace_back(x, y);
+   }
+   return result;
+}
+
+#define COMPLEX_FUNCTION_BENCH(name, expr)                   \
+   template <class Complex>                                 \
+   void BM_##name(benchmark::State& state)                  \
+   {                                                        \
+      std::vector<Complex> data = get_data<Complex>();      \
+      for (auto _ : state)                                  \
+      {                                                     \
+         for (const Complex& z : data)                      \
+            benchmark::DoNotOptimize(Complex(expr));        \
+      }                                                     \
+   }                                                        \
+   BENCHMARK_TEMPLATE(BM_##name, cpp_complex_50)->Unit(benchmark::kMicrosecond); \
+   BENCHMARK_TEMPLATE(BM_##name, cpp_complex_100)->Unit(benchmark::kMicrosecond);
+
+COMPLEX_FUNCTION_BENCH(exp, exp(z))
+COMPLEX_FUNCTION_BENCH(sin, sin(z))
+COMPLEX_FUNCTION_BENCH(cos, cos(z))
+COMPLEX_FUNCTION_BENCH(sinh, sinh(z))
+COMPLEX_FUNCTION_BENCH(tan, tan(z))
+COMPLEX_FUNCTION_BENCH(pow_int, pow(z, 5))
+COMPLEX_FUNCTION_BENCH(pow, pow(z, z))
+
+BENCHMARK_MAIN();
+
+/*
+Sharing the argument reduction and series between sin and cos, and a single
+exponential between sinh and cosh, GCC-12 -O2 x64, times in us for 100 calls:
+
+                              before    after
+BM_exp<cpp_complex_50>          4300     3200
+BM_exp<cpp_complex_100>        12500    10000
+BM_sin<cpp_complex_50>          5100     3200
+BM_sin<cpp_complex_100>        16800    10200
+BM_cos<cpp_complex_50>          4900     3100
+BM_cos<cpp_complex_100>        17300    10200
+BM_sinh<cpp_complex_50>         5800     3300
+BM_sinh<cpp_complex_100>       16600     9500
+BM_tan<cpp_complex_50>          4400     3400
+BM_tan<cpp_complex_100>        11600    10600
+
+pow(z, w) is dominated by the complex log, so is largely unchanged.
+*/
@@ -0,0 +1,72 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Construction of cpp_bin_float's from decimal strings, as when reading CSV files.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using namespace boost::multiprecision;
+
+//
+// Strings of the given number of significant digits with decimal exponents in [-max_exp, max_exp]:
+//
+std::vector<std::string> get_strings(unsigned digits, int max_exp)
+{
+   static std::mt19937      gen;
+   std::vector<std::string> result;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      std::string s(1, static_cast<char>('1' + gen() % 9));
+      s += '.';
+      for (unsigned j = 1; j < digits; ++j)
+         s += static_cast<char>('0' + gen() % 10);
+      s += 'e';
+      s += std::to_string(static_cast<int>(gen() % (2 * max_exp + 1)) - max_exp);
+      result.push_back(s);
+   }
+   return result;
+}
+
+template <class Float>
+void BM_parse(benchmark::State& state)
+{
+   std::vector<std::string> strings = get_strings(static_cast<unsigned>(state.range(0)), static_cast<int>(state.range(1)));
+   Float                    x;
+   for (auto _ : state)
+   {
+      for (const std::string& s : strings)
+      {
+         x.backend() = s.c_str();
+         benchmark::DoNotOptimize(x);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+BENCHMARK_TEMPLATE(BM_parse, cpp_bin_float_double)->Args({17, 20})->Args({17, 300});
+BENCHMARK_TEMPLATE(BM_parse, cpp_bin_float_50)->Args({20, 20})->Args({50, 20})->Args({50, 300})->Args({50, 5000})->Args({200, 20});
+BENCHMARK_TEMPLATE(BM_parse, cpp_bin_float_100)->Args({100, 50});
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times in ns per string, arguments are the number of significant digits and the
+largest decimal exponent:
+
+                                              restricted_pow with retries    cached powers / fast path
+BM_parse<cpp_bin_float_double>/17/20                    747                          247
+BM_parse<cpp_bin_float_double>/17/300                  1345                          554
+BM_parse<cpp_bin_float_50>/20/20                       1133                          775
+BM_parse<cpp_bin_float_50>/50/20                       2229                         1075
+BM_parse<cpp_bin_float_50>/50/300                      2398                          998
+BM_parse<cpp_bin_float_50>/50/5000                     3805                         2535
+BM_parse<cpp_bin_float_50>/200/20                      2568                         1272
+BM_parse<cpp_bin_float_100>/100/50                     4085                         2020
+
+Exponents of 5000 are outside the cache, and only gain from reading the digits a limb at a time.
+*/
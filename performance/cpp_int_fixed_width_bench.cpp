@@ -0,0 +1,129 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Arithmetic on the common fixed width cpp_int types, with full width operands.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+std::vector<Integer> get_data()
+{
+   static std::mt19937 gen;
+   std::vector<Integer> result;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Integer x = 0;
+      for (unsigned j = 0; j < std::numeric_limits<Integer>::digits; j += 32)
+      {
+         x <<= 32;
+         x += gen();
+      }
+      if (std::numeric_limits<Integer>::is_signed && (gen() & 1u))
+         x = Integer(0) - x;
+      result.push_back(x);
+   }
+   return result;
+}
+
+template <class Integer>
+void BM_add(benchmark::State& state)
+{
+   std::vector<Integer> a = get_data<Integer>(), b = get_data<Integer>();
+   Integer              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i] + b[i];
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+template <class Integer>
+void BM_subtract(benchmark::State& state)
+{
+   std::vector<Integer> a = get_data<Integer>(), b = get_data<Integer>();
+   Integer              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i] - b[i];
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+template <class Integer>
+void BM_multiply(benchmark::State& state)
+{
+   std::vector<Integer> a = get_data<Integer>(), b = get_data<Integer>();
+   Integer              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i] * b[i];
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+template <class Integer>
+void BM_compare(benchmark::State& state)
+{
+   std::vector<Integer> a = get_data<Integer>(), b = get_data<Integer>();
+   unsigned             count = 0;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+         count += a[i] < b[i];
+      benchmark::DoNotOptimize(count);
+   }
+}
+
+BENCHMARK_TEMPLATE(BM_add, uint256_t);
+BENCHMARK_TEMPLATE(BM_add, uint512_t);
+BENCHMARK_TEMPLATE(BM_add, int1024_t);
+BENCHMARK_TEMPLATE(BM_subtract, uint256_t);
+BENCHMARK_TEMPLATE(BM_subtract, uint512_t);
+BENCHMARK_TEMPLATE(BM_subtract, int1024_t);
+BENCHMARK_TEMPLATE(BM_multiply, uint128_t);
+BENCHMARK_TEMPLATE(BM_multiply, uint256_t);
+BENCHMARK_TEMPLATE(BM_multiply, uint512_t);
+BENCHMARK_TEMPLATE(BM_multiply, int1024_t);
+BENCHMARK_TEMPLATE(BM_compare, uint256_t);
+BENCHMARK_TEMPLATE(BM_compare, uint512_t);
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times in ns for 1000 operations on full width values:
+
+                                  Before       After
+BM_add<uint256_t>                  13629       13428
+BM_add<uint512_t>                  21342       17970
+BM_add<int1024_t>                  39798       34654
+BM_subtract<uint256_t>             20074       12294
+BM_subtract<uint512_t>             24606       14611
+BM_subtract<int1024_t>             40966       32430
+BM_multiply<uint128_t>              2566        2352
+BM_multiply<uint256_t>             42278       27894
+BM_multiply<uint512_t>             82873       55148
+BM_multiply<int1024_t>            209404      209404
+BM_compare<uint256_t>               2086        2337
+BM_compare<uint512_t>               2402        1895
+
+The loop overhead of the benchmark itself (copying the result) is a large part of the
+addition times, called directly on the backends addition of two uint256_t's drops from
+about 11ns to 3ns.  Multiplication of 1024 bit types still uses the schoolbook rows,
+and comparison is unchanged: the differences there are noise.
+*/
@@ -0,0 +1,89 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compares cpp_int schoolbook multiplication with and without the MULX/ADX
+// kernels, build with -DBOOST_MP_NO_MULX_ADX to get the portable code.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+std::vector<Integer> get_data(unsigned bits)
+{
+   static std::mt19937 gen;
+   std::vector<Integer> result;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Integer x = 0;
+      for (unsigned j = 0; j < bits; j += 32)
+      {
+         x <<= 32;
+         x += gen();
+      }
+      result.push_back(x);
+   }
+   return result;
+}
+
+template <class Integer>
+void BM_multiply(benchmark::State& state)
+{
+   unsigned             bits = static_cast<unsigned>(state.range(0));
+   std::vector<Integer> a = get_data<Integer>(bits), b = get_data<Integer>(bits);
+   Integer              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i] * b[i];
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+template <class Integer>
+void BM_multiply_limb(benchmark::State& state)
+{
+   unsigned             bits = static_cast<unsigned>(state.range(0));
+   std::vector<Integer> a = get_data<Integer>(bits), b = get_data<Integer>(64);
+   Integer              r;
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         r = a[i];
+         r *= static_cast<limb_type>(b[i]);
+         benchmark::DoNotOptimize(r);
+      }
+   }
+}
+
+BENCHMARK_TEMPLATE(BM_multiply, cpp_int)->Arg(256)->Arg(512)->Arg(1024)->Arg(2048)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_multiply, uint512_t)->Arg(256)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_multiply, uint1024_t)->Arg(512)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_multiply_limb, cpp_int)->Arg(256)->Arg(2048)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64 (Xeon with BMI2/ADX), times in us for 1000 operations, medians of several noisy runs:
+
+                                       portable    MULX/ADX
+BM_multiply<cpp_int>/256                     52          43
+BM_multiply<cpp_int>/512                    145          92
+BM_multiply<cpp_int>/1024                   560         270
+BM_multiply<cpp_int>/2048                  1950        1010
+BM_multiply<uint512_t>/256                   52          50
+BM_multiply<uint1024_t>/512                 188         124
+BM_multiply_limb<cpp_int>/256                18          17
+BM_multiply_limb<cpp_int>/2048               58          36
+
+At 4 limbs the cost is dominated by everything other than the inner loop, the kernels
+themselves are about twice as fast as the portable loop from 8 limbs up.
+*/
@@ -0,0 +1,56 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Multiplication of very large cpp_int's with the Karatsuba recursion shared out over
+// state.range(1) threads, see cpp_int_multiply_threads().
+//
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace boost::multiprecision;
+
+cpp_int get_value(unsigned bits)
+{
+   static std::mt19937 gen;
+   cpp_int             x = 0;
+   for (unsigned j = 0; j < bits; j += 32)
+   {
+      x <<= 32;
+      x += gen();
+   }
+   return x;
+}
+
+void BM_multiply(benchmark::State& state)
+{
+   unsigned bits = static_cast<unsigned>(state.range(0));
+   cpp_int  a = get_value(bits), b = get_value(bits), r;
+   cpp_int_multiply_threads(static_cast<std::size_t>(state.range(1)));
+   for (auto _ : state)
+   {
+      r = a * b;
+      benchmark::DoNotOptimize(r.backend().limbs());
+   }
+   cpp_int_multiply_threads(1);
+}
+
+BENCHMARK(BM_multiply)->Unit(benchmark::kMillisecond)->ArgsProduct({{1 << 17, 1 << 20, 1 << 23}, {1, 3, 9}});
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, wall clock times in ms, on a machine with a single core:
+
+                              1 thread   3 threads   9 threads
+BM_multiply/131072                0.84        1.19        1.13
+BM_multiply/1048576               24.4        30.2        30.4
+BM_multiply/8388608                848         804         633
+
+With only one core these measure the overhead of the threading, not any speedup: about
+0.3ms per product at the 2048 limb cutoff, mostly thread creation.  The CPU time of the
+calling thread drops to 1/3 and 1/9 respectively, which is the share of the work that
+would otherwise run concurrently.
+*/
@@ -0,0 +1,129 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Hashing multiprecision values, and using them as keys in an unordered_set, as when
+// de-duplicating uint256_t keys.
+//
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace boost::multiprecision;
+
+template <class Number>
+std::vector<Number> get_keys(unsigned bits)
+{
+   static std::mt19937 gen;
+   std::vector<Number> result;
+   for (unsigned i = 0; i < 10000; ++i)
+   {
+      cpp_int v = 0;
+      for (unsigned j = 0; j < bits; j += 32)
+      {
+         v <<= 32;
+         v += gen();
+      }
+      result.push_back(Number(v));
+   }
+   return result;
+}
+
+template <class Number>
+void BM_hash(benchmark::State& state)
+{
+   std::vector<Number> keys = get_keys<Number>(static_cast<unsigned>(state.range(0)));
+   std::hash<Number>   hasher;
+   for (auto _ : state)
+   {
+      std::size_t h = 0;
+      for (const Number& k : keys)
+         h += hasher(k);
+      benchmark::DoNotOptimize(h);
+   }
+   state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+//
+// Keys which are multiples of 2^202, such as counters in the top bits, and are looked up in
+// a table with a power of 2 number of buckets indexed by the low bits of the hash, as in
+// open addressing hash tables:
+//
+std::vector<uint256_t> get_structured_keys()
+{
+   std::vector<uint256_t> keys;
+   for (unsigned i = 0; i < 10000; ++i)
+      keys.push_back(uint256_t(i) << 202);
+   return keys;
+}
+
+void BM_unordered_set(benchmark::State& state)
+{
+   std::vector<uint256_t> keys = get_structured_keys();
+   for (auto _ : state)
+   {
+      std::unordered_set<uint256_t> set(keys.begin(), keys.end());
+      std::size_t                   found = 0;
+      for (const uint256_t& k : keys)
+         found += set.count(k);
+      benchmark::DoNotOptimize(found);
+   }
+   state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_linear_probing(benchmark::State& state)
+{
+   std::vector<uint256_t>  keys = get_structured_keys();
+   std::hash<uint256_t>    hasher;
+   const std::size_t       mask = (1u << 15) - 1;
+   std::vector<uint256_t>  table(mask + 1);
+   std::vector<char>       used(mask + 1);
+   for (auto _ : state)
+   {
+      std::fill(used.begin(), used.end(), 0);
+      for (const uint256_t& k : keys)
+      {
+         std::size_t i = hasher(k) & mask;
+         while (used[i] && (table[i] != k))
+            i = (i + 1) & mask;
+         table[i] = k;
+         used[i]  = 1;
+      }
+      benchmark::DoNotOptimize(table.data());
+   }
+   state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK_TEMPLATE(BM_hash, uint256_t)->Arg(256);
+BENCHMARK_TEMPLATE(BM_hash, cpp_int)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_hash, cpp_bin_float_50)->Arg(160);
+BENCHMARK_TEMPLATE(BM_hash, cpp_dec_float_50)->Arg(160);
+BENCHMARK(BM_unordered_set);
+BENCHMARK(BM_linear_probing);
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times for 10000 keys:
+
+                              before          after
+uint256_t                     64.2us          44.8us
+cpp_int 256 bits              95.8us          69.0us
+cpp_int 4096 bits             1.42ms          0.39ms
+cpp_bin_float_50              83.2us          43.6us
+cpp_dec_float_50               198us          65.6us
+unordered_set<uint256_t>      1.56ms          1.33ms
+linear probing, 2^15 slots    1.82ms          0.12ms
+
+The old hash combined the limbs with hash_combine, so keys differing only in their high
+bits differed only in the high bits of the hash: the keys i << 202 land in a few dozen
+slots of a power of 2 sized table, where std::unordered_set's prime bucket count hides
+most of the damage.  The new hash mixes every limb into every bit of the result with a
+64x64->128 bit multiply, two limbs at a time.
+*/
@@ -0,0 +1,131 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compares is_square and nth_root from integer.hpp with the obvious alternatives.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/integer.hpp>
+
+using namespace boost::multiprecision;
+
+std::vector<cpp_int> get_data(unsigned bits)
+{
+   static std::mt19937  gen;
+   std::vector<cpp_int> result;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      cpp_int x = 0;
+      for (unsigned j = 0; j < bits; j += 32)
+      {
+         x <<= 32;
+         x += gen();
+      }
+      result.push_back(x);
+   }
+   return result;
+}
+
+void BM_is_square_sqrt(benchmark::State& state)
+{
+   std::vector<cpp_int> v = get_data(static_cast<unsigned>(state.range(0)));
+   cpp_int              s;
+   for (auto _ : state)
+   {
+      unsigned count = 0;
+      for (const cpp_int& x : v)
+      {
+         s = sqrt(x);
+         count += s * s == x;
+      }
+      benchmark::DoNotOptimize(count);
+   }
+}
+
+void BM_is_square(benchmark::State& state)
+{
+   std::vector<cpp_int> v = get_data(static_cast<unsigned>(state.range(0)));
+   for (auto _ : state)
+   {
+      unsigned count = 0;
+      for (const cpp_int& x : v)
+         count += is_square(x);
+      benchmark::DoNotOptimize(count);
+   }
+}
+
+//
+// Newton's iteration at full precision, from a power of two above the root:
+//
+cpp_int naive_nth_root(const cpp_int& x, unsigned k)
+{
+   cpp_int y = cpp_int(1) << ((msb(x) + k) / k);
+   for (;;)
+   {
+      cpp_int q = x / pow(y, k - 1);
+      if (q >= y)
+         return y;
+      y = ((k - 1) * y + q) / k;
+   }
+}
+
+void BM_nth_root_naive(benchmark::State& state)
+{
+   std::vector<cpp_int> v = get_data(static_cast<unsigned>(state.range(0)));
+   v.resize(20);
+   for (auto _ : state)
+   {
+      for (const cpp_int& x : v)
+         benchmark::DoNotOptimize(naive_nth_root(x, 3).backend().limbs());
+   }
+}
+
+void BM_nth_root(benchmark::State& state)
+{
+   std::vector<cpp_int> v = get_data(static_cast<unsigned>(state.range(0)));
+   v.resize(20);
+   for (auto _ : state)
+   {
+      for (const cpp_int& x : v)
+         benchmark::DoNotOptimize(nth_root(x, 3).backend().limbs());
+   }
+}
+
+void BM_is_perfect_power(benchmark::State& state)
+{
+   std::vector<cpp_int> v = get_data(static_cast<unsigned>(state.range(0)));
+   v.resize(20);
+   for (auto _ : state)
+   {
+      unsigned count = 0;
+      for (const cpp_int& x : v)
+         count += is_perfect_power(x);
+      benchmark::DoNotOptimize(count);
+   }
+}
+
+BENCHMARK(BM_is_square_sqrt)->Unit(benchmark::kMicrosecond)->Arg(256)->Arg(2048)->Arg(16384);
+BENCHMARK(BM_is_square)->Unit(benchmark::kMicrosecond)->Arg(256)->Arg(2048)->Arg(16384);
+BENCHMARK(BM_nth_root_naive)->Unit(benchmark::kMicrosecond)->Arg(256)->Arg(2048)->Arg(16384);
+BENCHMARK(BM_nth_root)->Unit(benchmark::kMicrosecond)->Arg(256)->Arg(2048)->Arg(16384);
+BENCHMARK(BM_is_perfect_power)->Unit(benchmark::kMicrosecond)->Arg(256)->Arg(2048)->Arg(16384);
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times in us for 1000 values (is_square) or 20 values (the others):
+
+                                   256 bits   2048 bits   16384 bits
+BM_is_square_sqrt (s*s == x)            683        3756        67166
+BM_is_square                             32         511         4035
+BM_nth_root_naive (cube root)            75         464        19650
+BM_nth_root (cube root)                  34         265         5168
+BM_is_perfect_power                      88        1611        66827
+
+is_square is dominated by the single remainder modulo 64*63*65*11, only 1 in 120 or so
+random values needs a square root.  nth_root gains from doing all but the last Newton
+steps at reduced precision.
+*/
@@ -7,6 +7,7 @@
 #include <benchmark/benchmark.h>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/bareiss.hpp>
 
 #include <boost/math/special_functions/prime.hpp>
 #include <boost/math/special_functions/pow.hpp>
@@ -94,6 +95,33 @@ const std::vector<std::vector<T> >& get_matrix_data(unsigned bits)
    return data[bits];
 }
 
+//
+// As above, but the entries are integer valued, so that each 2x2 minor mixes
+// unit and non-unit denominators only at the final step:
+//
+template <class T>
+const std::vector<std::vector<T> >& get_integer_matrix_data(unsigned bits)
+{
+   static std::map<unsigned, std::vector<std::vector<T> > > data;
+   if (data[bits].empty())
+   {
+      for (unsigned i = 0; i < 100; ++i)
+      {
+         std::vector<T> matrix;
+         for (unsigned j = 0; j < 9; ++j)
+         {
+            boost::multiprecision::cpp_int a(generate_random<boost::multiprecision::cpp_int>(bits));
+            if (j == 4)
+               matrix.push_back(T(a.str() + "/3"));
+            else
+               matrix.push_back(T(a.str()));
+         }
+         data[bits].push_back(matrix);
+      }
+   }
+   return data[bits];
+}
+
 template <class T>
 T determinant(const std::vector<T>& data)
 {
@@ -115,6 +143,29 @@ static void BM_determinant(benchmark::State& state)
    }
 }
 
+template <class Rational>
+static void BM_integer_determinant(benchmark::State& state)
+{
+   int                         bits = state.range(0);
+   const std::vector<std::vector<Rational> >& data = get_integer_matrix_data<Rational>(bits);
+   for (auto _ : state)
+   {
+      for(unsigned i = 0; i < data.size(); ++i)
+         benchmark::DoNotOptimize(determinant(data[i]));
+   }
+}
+
+template <class Rational>
+static void BM_bareiss_determinant(benchmark::State& state)
+{
+   int                         bits = state.range(0);
+   const std::vector<std::vector<Rational> >& data = get_matrix_data<Rational>(bits);
+   for (auto _ : state)
+   {
+      for(unsigned i = 0; i < data.size(); ++i)
+         benchmark::DoNotOptimize(boost::multiprecision::bareiss_determinant(data[i], 3));
+   }
+}
 
 constexpr unsigned lower_range = 512;
 constexpr unsigned upper_range = 1 << 15;
@@ -122,5 +173,21 @@ constexpr unsigned upper_range = 1 << 15;
 BENCHMARK_TEMPLATE(BM_determinant, boost::multiprecision::cpp_rational)->RangeMultiplier(2)->Range(lower_range, upper_range)->Unit(benchmark::kMillisecond);
 BENCHMARK_TEMPLATE(BM_determinant, boost::multiprecision::mpq_rational)->RangeMultiplier(2)->Range(lower_range, upper_range)->Unit(benchmark::kMillisecond);
 BENCHMARK_TEMPLATE(BM_determinant, mpq_class)->RangeMultiplier(2)->Range(lower_range, upper_range)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_bareiss_determinant, boost::multiprecision::cpp_rational)->RangeMultiplier(2)->Range(lower_range, upper_range)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_integer_determinant, boost::multiprecision::cpp_rational)->RangeMultiplier(2)->Range(lower_range, upper_range)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_integer_determinant, boost::multiprecision::mpq_rational)->RangeMultiplier(2)->Range(lower_range, upper_range)->Unit(benchmark::kMillisecond);
 
 BENCHMARK_MAIN();
+
+/*
+Skipping the cross gcd's against unit denominators in rational_adaptor's
+add/subtract/multiply, GCC-12 -O2 x64, times in ms:
+
+                                          before     after
+BM_integer_determinant<cpp_rational>/512   0.448     0.401
+BM_integer_determinant<cpp_rational>/2048   3.38      2.65
+BM_integer_determinant<cpp_rational>/8192   28.5      23.7
+BM_determinant<cpp_rational>/512            45.8      43.9
+BM_determinant<cpp_rational>/2048            272       246
+BM_determinant<cpp_rational>/8192           2144      2306  (single iteration, noise)
+*/
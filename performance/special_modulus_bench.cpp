@@ -0,0 +1,125 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Modular arithmetic with special form moduli: powm and a Lucas-Lehmer test reducing
+// by shifts and additions, compared with the same computations using division.
+//
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using namespace boost::multiprecision;
+
+cpp_int get_value(unsigned bits)
+{
+   static std::mt19937 gen;
+   cpp_int             x = 0;
+   for (unsigned j = 0; j < bits; j += 32)
+   {
+      x <<= 32;
+      x += gen();
+   }
+   return x;
+}
+
+cpp_int mersenne(unsigned p)
+{
+   cpp_int m;
+   bit_set(m, p);
+   return m - 1;
+}
+
+//
+// 2^p - 1 with special form reduction, or a random modulus of the same size:
+//
+void BM_powm(benchmark::State& state)
+{
+   unsigned p = static_cast<unsigned>(state.range(0));
+   cpp_int  m = state.range(1) ? mersenne(p) : cpp_int(get_value(p) | 1), b = get_value(p) % m, e = get_value(p), r;
+   for (auto _ : state)
+   {
+      r = powm(b, e, m);
+      benchmark::DoNotOptimize(r.backend().limbs());
+   }
+}
+
+//
+// A small exponent with a random modulus, where checking the modulus for special form is
+// a noticeable part of the cost:
+//
+void BM_powm_small_exponent(benchmark::State& state)
+{
+   unsigned p = static_cast<unsigned>(state.range(0));
+   cpp_int  m = get_value(p) | 1, b = get_value(p) % m, r;
+   for (auto _ : state)
+   {
+      r = powm(b, 3u, m);
+      benchmark::DoNotOptimize(r.backend().limbs());
+   }
+}
+
+void BM_powm_25519(benchmark::State& state)
+{
+   uint256_t m = (uint256_t(1) << 255) - 19, b = static_cast<uint256_t>(get_value(256)) % m, e = m - 2, r;
+   for (auto _ : state)
+   {
+      r = powm(b, e, m);
+      benchmark::DoNotOptimize(r.backend().limbs());
+   }
+}
+
+void BM_lucas_lehmer(benchmark::State& state)
+{
+   unsigned p = static_cast<unsigned>(state.range(0));
+   cpp_int  m = mersenne(p);
+   for (auto _ : state)
+   {
+      cpp_int s = 4;
+      if (state.range(1))
+      {
+         modular_context<cpp_int> ctx(m);
+         for (unsigned i = 0; i < p - 2; ++i)
+            s = ctx.reduce(ctx.square(s) - 2);
+      }
+      else
+      {
+         for (unsigned i = 0; i < p - 2; ++i)
+         {
+            s = s * s - 2;
+            s %= m;
+         }
+      }
+      benchmark::DoNotOptimize(s.backend().limbs());
+   }
+}
+
+BENCHMARK(BM_powm)->Unit(benchmark::kMicrosecond)->ArgsProduct({{127, 521, 4423}, {0, 1}});
+BENCHMARK(BM_powm_small_exponent)->Unit(benchmark::kMicrosecond)->Arg(256)->Arg(4096);
+BENCHMARK(BM_powm_25519)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_lucas_lehmer)->Unit(benchmark::kMillisecond)->ArgsProduct({{4423, 9689, 21701}, {0, 1}});
+
+BENCHMARK_MAIN();
+
+/*
+GCC-12 -O2 x64, times in us for powm and ms for the Lucas-Lehmer tests:
+
+                              division   special form
+BM_powm/127                       33.4           24.0
+BM_powm/521                        997            212
+BM_powm/4423                    200647          31652
+BM_powm_25519 (uint256_t)          125           84.4
+BM_lucas_lehmer/4423               177           24.6
+BM_lucas_lehmer/9689              1811            154
+BM_lucas_lehmer/21701            15465           1196
+
+The "division" column for powm is a random modulus of the same size, which is unaffected
+by this change, for BM_powm_25519 it is the same computation before special form moduli were
+detected.  Reduction by 2^p - 1 is linear in the size of the values, so the gain grows with
+the size until the multiplications dominate.
+
+BM_powm_small_exponent measures about 1.1us at 256 bits and 25-30us at 4096 bits.  Random
+moduli are now rejected from their limbs before being copied and tested for special form,
+but that saving is within the noise of these runs.
+*/
@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Random operands shared by the integer tests.
+//
+
+#ifndef BOOST_MULTIPRECISION_TEST_RANDOM_INTEGER_HPP
+#define BOOST_MULTIPRECISION_TEST_RANDOM_INTEGER_HPP
+
+#include <limits>
+#include <boost/random/mersenne_twister.hpp>
+
+inline boost::random::mt19937& generator()
+{
+   static boost::random::mt19937 gen;
+   return gen;
+}
+
+//
+// Uniformly distributed in [0, 2^bits), built up a word at a time so that nothing
+// is ever shifted out of the top of a (possibly checked) fixed width type which has
+// at least bits bits:
+//
+template <class T>
+T generate_random(unsigned bits)
+{
+   T val(0u);
+   for (unsigned i = 0; i < bits / 32; ++i)
+   {
+      val <<= 32;
+      val += generator()();
+   }
+   if (bits % 32)
+   {
+      val <<= bits % 32;
+      val += generator()() >> (32 - bits % 32);
+   }
+   return val;
+}
+
+//
+// Negates val half the time when T is signed:
+//
+template <class T>
+T random_sign(const T& val)
+{
+   if (std::numeric_limits<T>::is_signed && (generator()() & 1u))
+      return T(0) - val;
+   return val;
+}
+
+//
+// A value of anything from 1 to bits bits long, so that small values turn up as
+// often as large ones, negated half the time when T is signed:
+//
+template <class T>
+T random_integer(unsigned bits)
+{
+   return random_sign(generate_random<T>(1 + generator()() % bits));
+}
+
+#endif
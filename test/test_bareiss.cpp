@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Share out even the small matrices tested here over several threads:
+//
+#define BOOST_MP_BAREISS_MIN_ENTRIES 4
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/bareiss.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::cpp_rational;
+
+//
+// Reference determinant by ordinary Gaussian elimination over the rationals:
+//
+cpp_rational reference_determinant(std::vector<cpp_rational> a, std::size_t n)
+{
+   cpp_rational result = 1;
+   for (std::size_t k = 0; k < n; ++k)
+   {
+      std::size_t p = k;
+      while ((p < n) && (a[p * n + k] == 0))
+         ++p;
+      if (p == n)
+         return 0;
+      if (p != k)
+      {
+         for (std::size_t j = 0; j < n; ++j)
+            a[p * n + j].swap(a[k * n + j]);
+         result = -result;
+      }
+      result *= a[k * n + k];
+      for (std::size_t i = k + 1; i < n; ++i)
+      {
+         cpp_rational f = a[i * n + k] / a[k * n + k];
+         for (std::size_t j = k; j < n; ++j)
+            a[i * n + j] -= f * a[k * n + j];
+      }
+   }
+   return result;
+}
+
+template <class T>
+std::vector<T> multiply(const std::vector<T>& a, const std::vector<T>& x)
+{
+   std::size_t    n = x.size();
+   std::vector<T> result(n);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      result[i] = 0;
+      for (std::size_t j = 0; j < n; ++j)
+         result[i] += a[i * n + j] * x[j];
+   }
+   return result;
+}
+
+void test_integer(std::size_t n, unsigned bits, bool zero_pivots)
+{
+   std::vector<cpp_int>      a(n * n), b(n), x;
+   std::vector<cpp_rational> r(n * n);
+   for (std::size_t i = 0; i < n * n; ++i)
+   {
+      a[i] = random_sign(generate_random<cpp_int>(bits));
+      if (zero_pivots && (i % (n + 1) == 0))
+         a[i] = 0;
+      r[i] = a[i];
+   }
+   for (std::size_t i = 0; i < n; ++i)
+      b[i] = random_sign(generate_random<cpp_int>(bits));
+
+   cpp_int det = boost::multiprecision::bareiss_determinant(a, n);
+   BOOST_CHECK_EQUAL(cpp_rational(det), reference_determinant(r, n));
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_determinant(a, n, 4), det);
+
+   for (std::size_t threads = 1; threads < 5; threads += 3)
+   {
+      BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_solve(a, b, x, threads), det);
+      if (det == 0)
+      {
+         BOOST_CHECK(x.empty());
+         continue;
+      }
+      BOOST_CHECK_EQUAL(x.size(), n);
+      std::vector<cpp_int> ax = multiply(a, x);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK_EQUAL(ax[i], b[i] * det);
+   }
+}
+
+void test_rational(std::size_t n, unsigned bits)
+{
+   std::vector<cpp_rational> a(n * n), b(n), x;
+   for (std::size_t i = 0; i < n * n; ++i)
+   {
+      cpp_int d = random_sign(generate_random<cpp_int>(bits / 2));
+      a[i]      = cpp_rational(random_sign(generate_random<cpp_int>(bits)), d == 0 ? cpp_int(1) : d);
+   }
+   for (std::size_t i = 0; i < n; ++i)
+      b[i] = cpp_rational(random_sign(generate_random<cpp_int>(bits)), 3);
+
+   cpp_rational det = boost::multiprecision::bareiss_determinant(a, n);
+   BOOST_CHECK_EQUAL(det, reference_determinant(a, n));
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_determinant(a, n, 3), det);
+
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_solve(a, b, x, 2), det);
+   BOOST_CHECK_EQUAL(x.size(), n);
+   std::vector<cpp_rational> ax = multiply(a, x);
+   for (std::size_t i = 0; i < n; ++i)
+      BOOST_CHECK_EQUAL(ax[i], b[i]);
+}
+
+void test_special_cases()
+{
+   std::vector<cpp_int> a, b, x;
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_determinant(a, 0), 1);
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_solve(a, b, x), 1);
+   BOOST_CHECK(x.empty());
+
+   // Singular, second row is twice the first:
+   a = {1, 2, 3, 2, 4, 6, 7, 8, 10};
+   b = {1, 2, 3};
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_determinant(a, 3), 0);
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_solve(a, b, x), 0);
+   BOOST_CHECK(x.empty());
+
+   // Needs a row swap:
+   a = {0, 1, 1, 0};
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_determinant(a, 2), -1);
+
+   std::vector<cpp_rational> q = {cpp_rational(1, 2), cpp_rational(1, 3), cpp_rational(1, 4), cpp_rational(1, 5)};
+   BOOST_CHECK_EQUAL(boost::multiprecision::bareiss_determinant(q, 2), cpp_rational(1, 60));
+
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(boost::multiprecision::bareiss_determinant(q, 3), std::domain_error);
+#endif
+}
+
+int main()
+{
+   test_special_cases();
+   for (std::size_t n = 1; n < 9; ++n)
+   {
+      test_integer(n, 10, false);
+      test_integer(n, 300, false);
+      test_integer(n, 300, true);
+      test_rational(n, 200);
+   }
+   test_integer(20, 1000, false);
+   return boost::report_errors();
+}
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the batch routines in batch.hpp against the element by element operations.
+//
+#include <vector>
+#include <boost/multiprecision/batch.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+void test(unsigned bits)
+{
+   const std::size_t    n = 500;
+   std::vector<Integer> a(n), b(n), r(n);
+   std::vector<int>     c(n);
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      a[i] = random_integer<Integer>(bits);
+      b[i] = i % 10 ? random_integer<Integer>(bits) : a[i];
+   }
+
+   for (std::size_t threads = 1; threads <= 3; threads += 2)
+   {
+      batch_add(r.data(), a.data(), b.data(), n, threads);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK_EQUAL(r[i], Integer(a[i] + b[i]));
+      batch_subtract(r.data(), a.data(), b.data(), n, threads);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK_EQUAL(r[i], Integer(a[i] - b[i]));
+      batch_multiply(r.data(), a.data(), b.data(), n, threads);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK_EQUAL(r[i], Integer(a[i] * b[i]));
+      batch_compare(c.data(), a.data(), b.data(), n, threads);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK_EQUAL(c[i], a[i] < b[i] ? -1 : a[i] == b[i] ? 0 : 1);
+   }
+   // Aliased arguments:
+   r = a;
+   batch_add(r.data(), r.data(), b.data(), n);
+   for (std::size_t i = 0; i < n; ++i)
+      BOOST_CHECK_EQUAL(r[i], Integer(a[i] + b[i]));
+   r = b;
+   batch_multiply(r.data(), a.data(), r.data(), n);
+   for (std::size_t i = 0; i < n; ++i)
+      BOOST_CHECK_EQUAL(r[i], Integer(a[i] * b[i]));
+
+   //
+   // Moduli of every size, including values which are larger than the modulus, and
+   // negative values for the signed types:
+   //
+   for (unsigned i = 0; i < 40; ++i)
+   {
+      Integer m = abs(random_integer<Integer>(bits));
+      if (i == 0)
+         m = 1;
+      else if (i == 1)
+         m = 2;
+      else if (i == 2)
+         m = (std::numeric_limits<Integer>::max)();
+      else if (i == 3)
+      {
+         // A power of two, where the Barrett reciprocal is exact:
+         m = 0;
+         bit_set(m, bits - 3);
+      }
+      else if ((i == 4) || ((i == 5) && (bits > 128)))
+      {
+         // Powers of the limb base, where the Barrett reciprocal needs an extra limb:
+         m = 0;
+         bit_set(m, 64 * (i - 3));
+      }
+      if (m == 0)
+         m = 7;
+      std::vector<Integer> ra(n), rb(n);
+      for (std::size_t j = 0; j < n; ++j)
+      {
+         // Products of the reduced values, computed without overflow:
+         cpp_int ta = cpp_int(a[j]) % cpp_int(m), tb = cpp_int(b[j]) % cpp_int(m);
+         if (ta < 0)
+            ta += cpp_int(m);
+         if (tb < 0)
+            tb += cpp_int(m);
+         ra[j] = static_cast<Integer>(ta * tb % cpp_int(m));
+      }
+      batch_mulmod(r.data(), a.data(), b.data(), m, n, 1 + i % 3);
+      for (std::size_t j = 0; j < n; ++j)
+         BOOST_CHECK_EQUAL(r[j], ra[j]);
+      rb = a;
+      batch_mulmod(rb.data(), rb.data(), b.data(), m, n);
+      for (std::size_t j = 0; j < n; ++j)
+         BOOST_CHECK_EQUAL(rb[j], ra[j]);
+   }
+   //
+   // Fixed width byte fields, with room to spare so that there are leading zeros:
+   //
+   const std::size_t          field = bits / CHAR_BIT + 3;
+   std::vector<unsigned char> bytes(n * field);
+   for (std::size_t threads = 1; threads <= 3; threads += 2)
+   {
+      for (int msv_first = 0; msv_first < 2; ++msv_first)
+      {
+         batch_export_bits(bytes.data(), a.data(), field, n, msv_first != 0, threads);
+         r = b;
+         batch_import_bits(r.data(), bytes.data(), field, n, msv_first != 0, threads);
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            BOOST_CHECK_EQUAL(r[i], Integer(abs(a[i])));
+            Integer x;
+            import_bits(x, bytes.begin() + i * field, bytes.begin() + (i + 1) * field, 8, msv_first != 0);
+            BOOST_CHECK_EQUAL(r[i], x);
+         }
+      }
+   }
+   // Fields narrower than the values keep their low bits:
+   batch_export_bits(bytes.data(), a.data(), 3, n);
+   batch_import_bits(r.data(), bytes.data(), 3, n);
+   for (std::size_t i = 0; i < n; ++i)
+      BOOST_CHECK_EQUAL(r[i], Integer(abs(a[i]) & 0xFFFFFF));
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(batch_mulmod(r.data(), a.data(), b.data(), Integer(0), n), std::domain_error);
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+   {
+      BOOST_CHECK_THROW(batch_mulmod(r.data(), a.data(), b.data(), Integer(-3), n), std::domain_error);
+   }
+#endif
+}
+
+int main()
+{
+   test<uint128_t>(128);
+   test<int128_t>(128);
+   test<uint256_t>(256);
+   test<uint512_t>(512);
+   test<int512_t>(512);
+   test<uint1024_t>(1024);
+   test<cpp_int>(1000);
+   return boost::report_errors();
+}
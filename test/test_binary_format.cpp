@@ -0,0 +1,271 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks write_to and read_from in binary_format.hpp, round trips, the exact bytes of the
+// format, reading into other types, and malformed or truncated input.
+//
+#include <vector>
+#include <boost/multiprecision/binary_format.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Float>
+Float random_float(int max_exp = 1000)
+{
+   Float result = generator()();
+   for (unsigned i = 0; i < 10; ++i)
+   {
+      result *= std::numeric_limits<std::uint32_t>::max();
+      result += generator()();
+   }
+   result = ldexp(result, static_cast<int>(generator()() % (2 * max_exp)) - max_exp - 352);
+   if (generator()() & 1u)
+      result = -result;
+   return result;
+}
+
+template <class Number>
+std::vector<unsigned char> to_bytes(const Number& v)
+{
+   std::vector<unsigned char> buf(binary_size(v));
+   write_to_result            r = write_to(buf.data(), buf.data() + buf.size(), v);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == buf.data() + buf.size());
+   return buf;
+}
+
+template <class Number>
+void check_round_trip(const Number& v)
+{
+   std::vector<unsigned char> buf = to_bytes(v);
+   Number                     w;
+   read_from_result           r = read_from(buf.data(), buf.data() + buf.size(), w);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == buf.data() + buf.size());
+   if (v != v)
+   {
+      BOOST_CHECK(w != w);
+   }
+   else
+   {
+      BOOST_CHECK_EQUAL(w, v);
+      BOOST_CHECK_EQUAL(w < 0, v < 0);
+   }
+   //
+   // Too little space for output, and truncated input, leave w unchanged:
+   //
+   if (buf.size())
+   {
+      std::vector<unsigned char> small(buf.size() - 1);
+      write_to_result            s = write_to(small.data(), small.data() + small.size(), v);
+      BOOST_CHECK(s.ec == std::errc::value_too_large);
+      Number u(2);
+      r = read_from(buf.data(), buf.data() + buf.size() - 1, u);
+      if (buf.size() > 2)
+      {
+         BOOST_CHECK(r.ec == std::errc::invalid_argument);
+         BOOST_CHECK_EQUAL(u, 2);
+      }
+   }
+}
+
+template <class Number>
+void check_bytes(const Number& v, const std::vector<unsigned char>& expected)
+{
+   std::vector<unsigned char> buf = to_bytes(v);
+   BOOST_CHECK(buf == expected);
+   Number           w;
+   read_from_result r = read_from(expected.data(), expected.data() + expected.size(), w);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(w, v);
+}
+
+template <class From, class To>
+void check_read_as(const From& v, std::errc expected)
+{
+   std::vector<unsigned char> buf = to_bytes(v);
+   To                         w(3);
+   read_from_result           r = read_from(buf.data(), buf.data() + buf.size(), w);
+   BOOST_CHECK(r.ec == expected);
+   if (expected == std::errc())
+   {
+      BOOST_CHECK_EQUAL(w, static_cast<To>(v));
+   }
+   else
+   {
+      BOOST_CHECK_EQUAL(w, 3);
+   }
+}
+
+template <class Integer>
+void test_integer(unsigned bits)
+{
+   check_round_trip(Integer(0));
+   check_round_trip(Integer(1));
+   check_round_trip((std::numeric_limits<Integer>::max)());
+   if (std::numeric_limits<Integer>::is_signed)
+      check_round_trip(Integer(-1));
+   for (unsigned i = 0; i < 1000; ++i)
+      check_round_trip(random_integer<Integer>(bits));
+   //
+   // Zero over a negative value:
+   //
+   Integer                    v(-1);
+   std::vector<unsigned char> buf = to_bytes(Integer(0));
+   read_from(buf.data(), buf.data() + buf.size(), v);
+   BOOST_CHECK_EQUAL(v, 0);
+}
+
+template <class Float>
+void test_float()
+{
+   check_round_trip(Float(0));
+   check_round_trip(-Float(0));
+   check_round_trip(Float(1));
+   check_round_trip(Float(-0.5));
+   check_round_trip((std::numeric_limits<Float>::max)());
+   check_round_trip((std::numeric_limits<Float>::min)());
+   check_round_trip(std::numeric_limits<Float>::epsilon());
+   check_round_trip(std::numeric_limits<Float>::infinity());
+   check_round_trip(-std::numeric_limits<Float>::infinity());
+   check_round_trip(std::numeric_limits<Float>::quiet_NaN());
+   for (unsigned i = 0; i < 1000; ++i)
+      check_round_trip(random_float<Float>());
+}
+
+int main()
+{
+   test_integer<cpp_int>(2000);
+   test_integer<int128_t>(128);
+   test_integer<uint512_t>(512);
+   test_integer<checked_int1024_t>(1024);
+   test_integer<number<cpp_int_backend<70, 70, unsigned_magnitude, unchecked, void> > >(70);
+   test_integer<number<cpp_int_backend<32, 32, signed_magnitude, unchecked, void> > >(32);
+
+   test_float<cpp_bin_float_double>();
+   test_float<cpp_bin_float_single>();
+   test_float<cpp_bin_float_quad>();
+   test_float<cpp_bin_float_50>();
+   test_float<number<cpp_bin_float<30, digit_base_10, std::allocator<char> > > >();
+   test_float<cpp_dec_float_50>();
+   test_float<cpp_dec_float_100>();
+
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      cpp_rational r(random_integer<cpp_int>(300), random_integer<cpp_int>(200) + 400);
+      check_round_trip(r);
+   }
+   check_round_trip(cpp_rational(0));
+   check_round_trip(cpp_rational(-1, 3));
+   //
+   // The exact bytes, which are the same on every platform:
+   //
+   check_bytes(cpp_int(0), {1, 1, 0});
+   check_bytes(cpp_int(-300), {1, 0x11, 2, 0x2C, 0x01});
+   check_bytes(int128_t(-300), {1, 0x11, 2, 0x2C, 0x01});
+   check_bytes(cpp_int(1) << 64, {1, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1});
+   check_bytes(cpp_bin_float_double(1.5), {1, 2, 0, 1, 3});
+   check_bytes(cpp_bin_float_double(-0.75), {1, 0x12, 1, 1, 3});
+   check_bytes(cpp_bin_float_50(1.5), {1, 2, 0, 1, 3});
+   check_bytes(cpp_bin_float_double(0), {1, 0x22});
+   check_bytes(cpp_bin_float_double(std::numeric_limits<double>::infinity()), {1, 0x42});
+   check_bytes(cpp_dec_float_50(123456789), {1, 3, 16, 2, 1, 0, 0, 0, 0x15, 0xEC, 0x65, 0x01});
+   check_bytes(cpp_dec_float_50(-2), {1, 0x13, 0, 1, 2, 0, 0, 0});
+   check_bytes(cpp_rational(-1, 3), {1, 0x14, 1, 1, 1, 3});
+   //
+   // Reading into other types, values which don't fit leave the result unchanged:
+   //
+   check_read_as<cpp_int, int128_t>(cpp_int(1) << 100, std::errc());
+   check_read_as<cpp_int, int128_t>(cpp_int(1) << 130, std::errc::result_out_of_range);
+   check_read_as<cpp_int, uint128_t>(cpp_int(-1), std::errc::result_out_of_range);
+   check_read_as<uint128_t, cpp_int>((std::numeric_limits<uint128_t>::max)(), std::errc());
+   check_read_as<cpp_bin_float_double, cpp_bin_float_50>(cpp_bin_float_double(0.1), std::errc());
+   check_read_as<cpp_bin_float_single, cpp_bin_float_double>(cpp_bin_float_single(-3.25f), std::errc());
+   check_read_as<cpp_bin_float_50, cpp_bin_float_double>(cpp_bin_float_50(1e300) * 1e300, std::errc::result_out_of_range);
+   check_read_as<cpp_dec_float_50, cpp_dec_float_100>(cpp_dec_float_50(1) / 3, std::errc());
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      cpp_bin_float_50 x = random_float<cpp_bin_float_50>(100);
+      check_read_as<cpp_bin_float_50, cpp_bin_float_double>(x, std::errc());
+      check_read_as<cpp_bin_float_50, cpp_bin_float_single>(x, std::errc());
+      check_read_as<cpp_bin_float_quad, cpp_bin_float_double>(cpp_bin_float_quad(x), std::errc());
+      check_read_as<cpp_dec_float_100, cpp_dec_float_50>(cpp_dec_float_100(x), std::errc());
+   }
+   //
+   // Halfway cases round to even:
+   //
+   check_read_as<cpp_bin_float_50, cpp_bin_float_double>(cpp_bin_float_50(1) + ldexp(cpp_bin_float_50(1), -53), std::errc());
+   check_read_as<cpp_bin_float_50, cpp_bin_float_double>(cpp_bin_float_50(1) + 3 * ldexp(cpp_bin_float_50(1), -53), std::errc());
+   check_read_as<cpp_bin_float_50, cpp_bin_float_double>(2 - ldexp(cpp_bin_float_50(1), -54), std::errc());
+   //
+   // Malformed input:
+   //
+   {
+      cpp_int             v(5);
+      const unsigned char version[] = {2, 1, 0};
+      const unsigned char kind[]    = {1, 2, 0};
+      const unsigned char length[]  = {1, 1, 0x80, 0x80};
+      BOOST_CHECK(read_from(version, version + 3, v).ec == std::errc::invalid_argument);
+      BOOST_CHECK(read_from(kind, kind + 3, v).ec == std::errc::invalid_argument);
+      BOOST_CHECK(read_from(length, length + 4, v).ec == std::errc::invalid_argument);
+      BOOST_CHECK(read_from(version, version + 1, v).ec == std::errc::invalid_argument);
+      BOOST_CHECK_EQUAL(v, 5);
+
+      cpp_rational        r(1, 2);
+      const unsigned char zero_denom[] = {1, 4, 1, 1, 0};
+      const unsigned char not_reduced[] = {1, 4, 1, 2, 1, 4};
+      BOOST_CHECK(read_from(zero_denom, zero_denom + 5, r).ec == std::errc::invalid_argument);
+      BOOST_CHECK(read_from(not_reduced, not_reduced + 6, r).ec == std::errc::invalid_argument);
+      BOOST_CHECK_EQUAL(r, cpp_rational(1, 2));
+
+      cpp_dec_float_50    d(7);
+      const unsigned char big_digit[] = {1, 3, 0, 1, 0, 0xE1, 0xF5, 0x05};
+      const unsigned char bad_exp[]   = {1, 3, 2, 1, 1, 0, 0, 0};
+      BOOST_CHECK(read_from(big_digit, big_digit + 8, d).ec == std::errc::invalid_argument);
+      // A bad digit after some good ones:
+      const unsigned char late_digit[] = {1, 3, 0, 4, 0x01, 0x00, 0x00, 0x00, 0x15, 0xEC, 0x65, 0x01, 0x87, 0xD6, 0x12, 0x00, 0xFF, 0xFF, 0xFF, 0xFF};
+      BOOST_CHECK(read_from(big_digit, big_digit + 8, d).ec == std::errc::invalid_argument);
+      BOOST_CHECK(read_from(bad_exp, bad_exp + 8, d).ec == std::errc::invalid_argument);
+      BOOST_CHECK(read_from(late_digit, late_digit + sizeof(late_digit), d).ec == std::errc::invalid_argument);
+      BOOST_CHECK_EQUAL(d, 7);
+   }
+   //
+   // Several values one after another:
+   //
+   {
+      unsigned char        buf[200];
+      const cpp_int        a = -(cpp_int(1) << 200);
+      const cpp_bin_float_quad b("1.25e-1000");
+      write_to_result      w = write_to(buf, buf + sizeof(buf), a);
+      w                      = write_to(w.ptr, buf + sizeof(buf), b);
+      BOOST_CHECK(w.ec == std::errc());
+      cpp_int            x;
+      cpp_bin_float_quad y;
+      read_from_result   r = read_from(buf, w.ptr, x);
+      r                    = read_from(r.ptr, w.ptr, y);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK(r.ptr == w.ptr);
+      BOOST_CHECK_EQUAL(x, a);
+      BOOST_CHECK_EQUAL(y, b);
+   }
+#ifdef __cpp_lib_span
+   {
+      std::byte       buf[50];
+      write_to_result w = write_to(std::span<std::byte>(buf), cpp_int(12345));
+      BOOST_CHECK(w.ec == std::errc());
+      cpp_int          x;
+      read_from_result r = read_from(std::span<const std::byte>(buf, reinterpret_cast<std::byte*>(w.ptr)), x);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK_EQUAL(x, 12345);
+   }
+#endif
+   return boost::report_errors();
+}
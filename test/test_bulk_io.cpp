@@ -0,0 +1,241 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks parse_many and format_many in bulk_io.hpp against str() and the string constructors.
+//
+#include <string>
+#include <vector>
+#include <boost/multiprecision/bulk_io.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Number>
+std::vector<Number> random_values(std::size_t n, unsigned bits)
+{
+   std::vector<Number> result;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      cpp_int v = random_integer<cpp_int>(bits);
+      BOOST_IF_CONSTEXPR(!std::numeric_limits<Number>::is_signed)
+      {
+         v = abs(v);
+      }
+      BOOST_IF_CONSTEXPR(std::numeric_limits<Number>::is_bounded && std::numeric_limits<Number>::is_integer)
+      {
+         v &= cpp_int((std::numeric_limits<Number>::max)());
+      }
+      result.push_back(Number(v));
+      BOOST_IF_CONSTEXPR(!std::numeric_limits<Number>::is_integer)
+      {
+         result.back() /= 7;
+      }
+   }
+   return result;
+}
+
+//
+// Formats the values, checks the text against str(), parses it back, and checks the values:
+//
+template <class Number>
+void check_round_trip(const std::vector<Number>& values, std::size_t threads)
+{
+   std::string       expected;
+   std::vector<char> buffer(100000);
+   for (const Number& v : values)
+   {
+      const to_chars_result r = to_chars(buffer.data(), buffer.data() + buffer.size(), v);
+      BOOST_CHECK(r.ec == std::errc());
+      expected.append(buffer.data(), r.ptr);
+      expected += '\n';
+   }
+   std::vector<char>     text(expected.size() + 10, 'x');
+   const to_chars_result r = format_many(text.data(), text.data() + text.size(), values.data(), values.size(), threads);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(std::string(text.data(), r.ptr), expected);
+   //
+   // Too small a buffer:
+   //
+   if (!expected.empty())
+   {
+      const to_chars_result r2 = format_many(text.data(), text.data() + expected.size() - 1, values.data(), values.size(), threads);
+      BOOST_CHECK(r2.ec == std::errc::value_too_large);
+   }
+
+   std::vector<Number>     parsed(values.size() + 3, Number(12345));
+   const parse_many_result p = parse_many(expected.data(), expected.data() + expected.size(), parsed.data(), parsed.size(), threads);
+   BOOST_CHECK(p.ec == std::errc());
+   BOOST_CHECK_EQUAL(p.count, values.size());
+   BOOST_CHECK(p.ptr == expected.data() + (expected.empty() ? 0 : expected.size() - 1));
+   for (std::size_t i = 0; i < values.size(); ++i)
+      BOOST_CHECK_EQUAL(parsed[i], values[i]);
+   BOOST_CHECK_EQUAL(parsed[values.size()], Number(12345));
+}
+
+template <class Number>
+void test_parse_errors(std::size_t threads)
+{
+   //
+   // Any whitespace separates values, the output array limits how many are read, and the
+   // first bad value stops the parse:
+   //
+   std::string text = "  12\t-34\r\n\n56 78   ";
+   Number      out[4];
+   parse_many_result r = parse_many(text.data(), text.data() + text.size(), out, 4, threads);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(r.count, 4u);
+   BOOST_CHECK(r.ptr == text.data() + 16);
+   BOOST_CHECK_EQUAL(out[1], -34);
+   BOOST_CHECK_EQUAL(out[3], 78);
+
+   r = parse_many(text.data(), text.data() + text.size(), out, 2, threads);
+   BOOST_CHECK_EQUAL(r.count, 2u);
+   BOOST_CHECK(r.ptr == text.data() + 8);
+
+   text = "1 2 3x 4";
+   r    = parse_many(text.data(), text.data() + text.size(), out, 4, threads);
+   BOOST_CHECK(r.ec == std::errc::invalid_argument);
+   BOOST_CHECK_EQUAL(r.count, 2u);
+   BOOST_CHECK(r.ptr == text.data() + 4);
+
+   text = "   ";
+   r    = parse_many(text.data(), text.data() + text.size(), out, 4, threads);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(r.count, 0u);
+   BOOST_CHECK(r.ptr == text.data());
+}
+
+template <class Number>
+void test(unsigned bits)
+{
+   static const std::size_t counts[] = {0, 1, 2, 7, 100, 5000};
+   static const std::size_t threads[] = {1, 2, 3, 8};
+   for (std::size_t n : counts)
+   {
+      const std::vector<Number> values = random_values<Number>(n, bits);
+      for (std::size_t t : threads)
+         check_round_trip(values, t);
+   }
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Number>::is_signed)
+   {
+      for (std::size_t t : threads)
+         test_parse_errors<Number>(t);
+   }
+}
+
+//
+// A large file's worth, so that the text is split between threads, and long values which
+// cpp_int parses by divide and conquer:
+//
+void test_large()
+{
+   std::vector<cpp_int> values = random_values<cpp_int>(100000, 300);
+   for (unsigned bits : {4000u, 10000u, 50000u, 200000u})
+   {
+      values.push_back(random_sign(generate_random<cpp_int>(bits)));
+      values.push_back(-pow(cpp_int(10), bits / 3));
+      values.push_back(pow(cpp_int(10), bits / 3) - 1);
+   }
+   std::swap(values[10], values.back());
+   for (std::size_t t : {1u, 4u, 16u})
+      check_round_trip(values, t);
+
+   std::string text;
+   for (unsigned i = 0; i < 200000; ++i)
+      text += std::to_string(i) + (i % 7 ? " " : "\n");
+   text += "-1 - 2";
+   for (std::size_t t : {1u, 4u, 16u})
+   {
+      std::vector<int128_t>   out(300000);
+      const parse_many_result r = parse_many(text.data(), text.data() + text.size(), out.data(), out.size(), t);
+      BOOST_CHECK(r.ec == std::errc::invalid_argument);
+      BOOST_CHECK_EQUAL(r.count, 200001u);
+      BOOST_CHECK(r.ptr == text.data() + text.size() - 3);
+      BOOST_CHECK_EQUAL(out[123456], 123456);
+      BOOST_CHECK_EQUAL(out[200000], -1);
+   }
+}
+
+void test_float_options()
+{
+   const std::vector<cpp_bin_float_50> values = random_values<cpp_bin_float_50>(1000, 200);
+   for (std::size_t t : {1u, 4u})
+   {
+      std::string expected;
+      for (const cpp_bin_float_50& v : values)
+      {
+         char buffer[200];
+         expected.append(buffer, to_chars(buffer, buffer + sizeof(buffer), v, chars_format::scientific, 20).ptr);
+         expected += '\n';
+      }
+      std::vector<char>     text(expected.size());
+      to_chars_result r = format_many(text.data(), text.data() + text.size(), values.data(), values.size(), chars_format::scientific, 20, t);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK_EQUAL(std::string(text.data(), r.ptr), expected);
+
+      expected.clear();
+      for (const cpp_bin_float_50& v : values)
+      {
+         char buffer[200];
+         expected.append(buffer, to_chars(buffer, buffer + sizeof(buffer), v, chars_format::fixed).ptr);
+         expected += '\n';
+      }
+      text.resize(expected.size());
+      r = format_many(text.data(), text.data() + text.size(), values.data(), values.size(), chars_format::fixed, -1, t);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK_EQUAL(std::string(text.data(), r.ptr), expected);
+   }
+}
+
+//
+// Types without to_chars and from_chars go via str() and their string constructors:
+//
+void test_rational()
+{
+   std::vector<cpp_rational> values;
+   for (unsigned i = 0; i < 1000; ++i)
+      values.push_back(cpp_rational(random_sign(generate_random<cpp_int>(100)), random_sign(generate_random<cpp_int>(60)) + 1));
+   for (std::size_t t : {1u, 3u})
+   {
+      std::string expected;
+      for (const cpp_rational& v : values)
+         expected += v.str() + '\n';
+      std::vector<char>     text(expected.size());
+      const to_chars_result r = format_many(text.data(), text.data() + text.size(), values.data(), values.size(), t);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK_EQUAL(std::string(text.data(), r.ptr), expected);
+
+      std::vector<cpp_rational> parsed(values.size());
+      const parse_many_result   p = parse_many(expected.data(), expected.data() + expected.size(), parsed.data(), parsed.size(), t);
+      BOOST_CHECK(p.ec == std::errc());
+      BOOST_CHECK_EQUAL(p.count, values.size());
+      BOOST_CHECK(parsed == values);
+   }
+   std::string  bad = "1/2 x/3";
+   cpp_rational out[2];
+   const parse_many_result p = parse_many(bad.data(), bad.data() + bad.size(), out, 2);
+   BOOST_CHECK(p.ec == std::errc::invalid_argument);
+   BOOST_CHECK_EQUAL(p.count, 1u);
+}
+
+int main()
+{
+   test<cpp_int>(2000);
+   test<int128_t>(128);
+   test<uint512_t>(512);
+   test<checked_int256_t>(256);
+   test<number<cpp_int_backend<64, 64, signed_magnitude, unchecked, void> > >(64);
+   test<cpp_bin_float_50>(200);
+   test<cpp_dec_float_50>(200);
+   test_large();
+   test_float_options();
+   test_rational();
+   return boost::report_errors();
+}
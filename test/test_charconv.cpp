@@ -0,0 +1,481 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks to_chars and from_chars in charconv.hpp against str() and the string constructors.
+//
+#include <string>
+#include <boost/multiprecision/charconv.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+#include <boost/multiprecision/cpp_double_fp.hpp>
+#endif
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+std::string str_in_base(Integer v, int base)
+{
+   // Reference conversion, one digit at a time:
+   bool        neg = v < 0;
+   std::string s;
+   if (neg)
+      v = Integer(0) - v;
+   do
+   {
+      s.insert(s.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[static_cast<unsigned>(v % base)]);
+      v /= base;
+   } while (v != 0);
+   if (neg)
+      s.insert(s.begin(), '-');
+   return s;
+}
+
+template <class Integer>
+void test_integer(unsigned bits)
+{
+   char buf[2000];
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Integer v    = i ? random_integer<Integer>(bits) : Integer(0);
+      int     base = i % 4 == 0 ? 10 : i % 4 == 1 ? 16 : 2 + static_cast<int>(generator()() % 35);
+      if (i & 1)
+      {
+         if (base == 10)
+         {
+            BOOST_CHECK_EQUAL(std::string(buf, to_chars(buf, buf + sizeof(buf), v).ptr), v.str());
+         }
+      }
+      std::string     expected = str_in_base(v, base);
+      to_chars_result r        = to_chars(buf, buf + sizeof(buf), v, base);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK_EQUAL(std::string(buf, r.ptr), expected);
+      // Exactly enough room, and one character too few:
+      r = to_chars(buf, buf + expected.size(), v, base);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK(r.ptr == buf + expected.size());
+      r = to_chars(buf, buf + expected.size() - 1, v, base);
+      BOOST_CHECK(r.ec == std::errc::value_too_large);
+      BOOST_CHECK(r.ptr == buf + expected.size() - 1);
+
+      // Round trip, upper case digits are accepted too:
+      Integer           w;
+      from_chars_result fr = from_chars(expected.data(), expected.data() + expected.size(), w, base);
+      BOOST_CHECK(fr.ec == std::errc());
+      BOOST_CHECK(fr.ptr == expected.data() + expected.size());
+      BOOST_CHECK_EQUAL(w, v);
+      for (char& c : expected)
+         c = static_cast<char>(std::toupper(c));
+      expected += "!";
+      w  = 1;
+      fr = from_chars(expected.data(), expected.data() + expected.size(), w, base);
+      BOOST_CHECK(fr.ec == std::errc());
+      BOOST_CHECK(fr.ptr == expected.data() + expected.size() - 1);
+      BOOST_CHECK_EQUAL(w, v);
+   }
+   //
+   // Errors leave the value alone:
+   //
+   Integer           w   = 3;
+   const char        bad[] = "-z";
+   from_chars_result fr    = from_chars(bad, bad + 2, w);
+   BOOST_CHECK(fr.ec == std::errc::invalid_argument);
+   BOOST_CHECK(fr.ptr == bad);
+   BOOST_CHECK_EQUAL(w, 3);
+   fr = from_chars(bad, bad, w);
+   BOOST_CHECK(fr.ec == std::errc::invalid_argument);
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_bounded)
+   {
+      Integer     m = (std::numeric_limits<Integer>::max)();
+      std::string s = m.str();
+      fr            = from_chars(s.data(), s.data() + s.size(), w);
+      BOOST_CHECK(fr.ec == std::errc());
+      BOOST_CHECK_EQUAL(w, m);
+      w = 3;
+      s = (cpp_int(m) + 1).str() + "x";
+      fr = from_chars(s.data(), s.data() + s.size(), w);
+      BOOST_CHECK(fr.ec == std::errc::result_out_of_range);
+      BOOST_CHECK(fr.ptr == s.data() + s.size() - 1);
+      BOOST_CHECK_EQUAL(w, 3);
+      s  = (cpp_int(m) * 1000).str();
+      fr = from_chars(s.data(), s.data() + s.size(), w);
+      BOOST_CHECK(fr.ec == std::errc::result_out_of_range);
+      BOOST_CHECK_EQUAL(w, 3);
+      s  = (cpp_int(m) + 1).str(0, std::ios_base::hex);
+      fr = from_chars(s.data(), s.data() + s.size(), w, 16);
+      BOOST_CHECK(fr.ec == std::errc::result_out_of_range);
+      BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+      {
+         s  = "-" + m.str();
+         fr = from_chars(s.data(), s.data() + s.size(), w);
+         BOOST_CHECK(fr.ec == std::errc());
+         BOOST_CHECK_EQUAL(w, Integer(Integer(0) - m));
+      }
+   }
+   BOOST_IF_CONSTEXPR(!std::numeric_limits<Integer>::is_signed)
+   {
+      // No sign for unsigned types, as for the built in types:
+      const char minus_one[] = "-1";
+      w                      = 3;
+      fr                     = from_chars(minus_one, minus_one + 2, w);
+      BOOST_CHECK(fr.ec == std::errc::invalid_argument);
+      BOOST_CHECK_EQUAL(w, 3);
+   }
+}
+
+template <class Float>
+Float random_float()
+{
+   Float v = Float(random_integer<cpp_int>(256)) / Float(abs(random_integer<cpp_int>(256)) + 1);
+   int   e = static_cast<int>(generator()() % 200) - 100;
+   return ldexp(v, e);
+}
+
+template <class Float>
+void check_float(const Float& v, chars_format fmt, int precision, const std::string& expected)
+{
+   char            buf[2000];
+   to_chars_result r = to_chars(buf, buf + sizeof(buf), v, fmt, precision);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), expected);
+   r = to_chars(buf, buf + expected.size() - 1, v, fmt, precision);
+   BOOST_CHECK(r.ec == std::errc::value_too_large);
+}
+
+template <class Float>
+void check_round_trip(const Float& v)
+{
+   char            buf[2000];
+   to_chars_result r = to_chars(buf, buf + sizeof(buf), v, chars_format::scientific, std::numeric_limits<Float>::max_digits10 - 1);
+   BOOST_CHECK(r.ec == std::errc());
+   Float             w;
+   from_chars_result fr = from_chars(buf, r.ptr, w);
+   BOOST_CHECK(fr.ec == std::errc());
+   BOOST_CHECK(fr.ptr == r.ptr);
+   BOOST_CHECK_EQUAL(w, v);
+}
+
+template <class Float>
+void test_float()
+{
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Float v         = random_float<Float>();
+      int   precision = 1 + static_cast<int>(generator()() % (std::numeric_limits<Float>::max_digits10 + 5));
+      if (i & 1)
+         v = -v;
+      // str() agrees with us, except that it has no way to ask for 1 significant digit:
+      check_float(v, chars_format::scientific, precision, v.str(precision, std::ios_base::scientific));
+      check_float(v, chars_format::fixed, precision % 30, v.str(precision % 30, std::ios_base::fixed));
+      check_float(v, chars_format::general, precision, v.str(precision, std::ios_base::fmtflags(0)));
+      check_round_trip(v);
+   }
+   //
+   // Values very close to the limits of the type:
+   //
+   for (int i = 0; i < 50; ++i)
+   {
+      Float v = (std::numeric_limits<Float>::max)() / (i + 1);
+      check_float(v, chars_format::scientific, 20, v.str(20, std::ios_base::scientific));
+      check_round_trip(v);
+      v = (std::numeric_limits<Float>::min)() * (i + 1);
+      check_float(v, chars_format::scientific, 20, v.str(20, std::ios_base::scientific));
+      check_float(v, chars_format::general, 20, v.str(20, std::ios_base::fmtflags(0)));
+      check_round_trip(v);
+   }
+   //
+   // Edge cases of the layout:
+   //
+   check_float(Float(0), chars_format::general, 6, "0");
+   check_float(Float(0), chars_format::fixed, 3, "0.000");
+   check_float(Float(0), chars_format::scientific, 2, "0.00e+00");
+   if ((boost::multiprecision::signbit)(Float(-0.0)))
+      check_float(Float(-0.0), chars_format::general, 6, "-0");
+   check_float(Float(1.5), chars_format::scientific, 0, "2e+00");
+   check_float(Float(2.5), chars_format::scientific, 0, "2e+00");
+   check_float(Float(2.5), chars_format::fixed, 0, "2");
+   check_float(Float(123456), chars_format::general, 0, "1e+05");
+   check_float(Float(123456), chars_format::general, 6, "123456");
+   check_float(Float(1234567), chars_format::general, 6, "1.23457e+06");
+   check_float(Float(0.0001), chars_format::general, 6, "0.0001");
+   check_float(Float(0.00001), chars_format::general, 6, "1e-05");
+   check_float(Float(9.9999), chars_format::general, 4, "10");
+   check_float(Float(9.9999), chars_format::scientific, 3, "1.000e+01");
+   check_float(Float(0.0004), chars_format::fixed, 3, "0.000");
+   check_float(Float(-0.0006), chars_format::fixed, 3, "-0.001");
+   check_float(Float(1e100), chars_format::scientific, 5, "1.00000e+100");
+   check_float(Float(1) / 3, chars_format::fixed, 5, "0.33333");
+   check_float(Float(-1) / 3, chars_format::fixed, -1, "-0.333333");
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Float>::has_infinity)
+   {
+      check_float(std::numeric_limits<Float>::infinity(), chars_format::general, 6, "inf");
+      check_float(Float(-std::numeric_limits<Float>::infinity()), chars_format::fixed, 6, "-inf");
+      check_float(std::numeric_limits<Float>::quiet_NaN(), chars_format::scientific, 6, "nan");
+   }
+
+   //
+   // Parsing:
+   //
+   const char*       s = "-1.25e+2xyz";
+   Float             w = 3;
+   from_chars_result fr = from_chars(s, s + 11, w);
+   BOOST_CHECK(fr.ec == std::errc());
+   BOOST_CHECK(fr.ptr == s + 8);
+   BOOST_CHECK_EQUAL(w, -125);
+   fr = from_chars(s, s + 11, w, chars_format::fixed);
+   BOOST_CHECK(fr.ptr == s + 5);
+   BOOST_CHECK_EQUAL(w, Float(-1.25));
+   fr = from_chars(s, s + 5, w, chars_format::scientific);
+   BOOST_CHECK(fr.ec == std::errc::invalid_argument);
+   BOOST_CHECK(fr.ptr == s);
+   BOOST_CHECK_EQUAL(w, Float(-1.25));
+   s  = "12e";
+   fr = from_chars(s, s + 3, w);
+   BOOST_CHECK(fr.ec == std::errc());
+   BOOST_CHECK(fr.ptr == s + 2);
+   BOOST_CHECK_EQUAL(w, 12);
+   s  = ".5";
+   fr = from_chars(s, s + 2, w);
+   BOOST_CHECK(fr.ptr == s + 2);
+   BOOST_CHECK_EQUAL(w, Float(0.5));
+   s  = "+1";
+   fr = from_chars(s, s + 2, w);
+   BOOST_CHECK(fr.ec == std::errc::invalid_argument);
+   s  = "-.e1";
+   fr = from_chars(s, s + 4, w);
+   BOOST_CHECK(fr.ec == std::errc::invalid_argument);
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Float>::has_infinity)
+   {
+      s  = "-INFinity";
+      fr = from_chars(s, s + 9, w);
+      BOOST_CHECK(fr.ptr == s + 9);
+      BOOST_CHECK((boost::multiprecision::isinf)(w) && (w < 0));
+      s  = "nan(snan)";
+      fr = from_chars(s, s + 9, w);
+      BOOST_CHECK(fr.ptr == s + 9);
+      BOOST_CHECK((boost::multiprecision::isnan)(w));
+      s  = "1e999999999";
+      w  = 2;
+      fr = from_chars(s, s + 11, w);
+      BOOST_CHECK(fr.ec == std::errc::result_out_of_range);
+      BOOST_CHECK(fr.ptr == s + 11);
+      BOOST_CHECK_EQUAL(w, 2);
+   }
+}
+
+template <class Float>
+void check_shortest(const Float& v)
+{
+   char            buf[2000];
+   to_chars_result r = to_chars(buf, buf + sizeof(buf), v);
+   BOOST_CHECK(r.ec == std::errc());
+   Float             w;
+   from_chars_result fr = from_chars(buf, r.ptr, w);
+   BOOST_CHECK(fr.ptr == r.ptr);
+   BOOST_CHECK_EQUAL(w, v);
+   // One fewer significant digit no longer reads back as v, fixed notation may
+   // print all the digits of an integer so count them in scientific notation:
+   r          = to_chars(buf, buf + sizeof(buf), v, chars_format::scientific);
+   int digits = 0;
+   for (const char* p = buf; *p != 'e'; ++p)
+      digits += (*p >= '0') && (*p <= '9');
+   if (digits > 1)
+   {
+      r = to_chars(buf, buf + sizeof(buf), v, chars_format::scientific, digits - 2);
+      w = Float(std::string(buf, r.ptr));
+      BOOST_CHECK(w != v);
+   }
+   const chars_format formats[] = {chars_format::scientific, chars_format::fixed, chars_format::general};
+   for (chars_format fmt : formats)
+   {
+      r = to_chars(buf, buf + sizeof(buf), v, fmt);
+      if (r.ec != std::errc())
+      {
+         // Fixed notation of a very large or small exponent doesn't fit the buffer:
+         BOOST_CHECK(fmt == chars_format::fixed);
+         continue;
+      }
+      fr = from_chars(buf, r.ptr, w, fmt);
+      BOOST_CHECK(fr.ptr == r.ptr);
+      BOOST_CHECK_EQUAL(w, v);
+   }
+}
+
+template <class Float>
+void test_shortest()
+{
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Float v = i % 3 ? random_float<Float>() : Float(static_cast<int>(generator()() % 100000) - 50000) / pow(Float(10), generator()() % 10);
+      // cpp_double_fp values aren't always exactly representable with its number of digits:
+      if (!(boost::multiprecision::isfinite)(v) || (Float(v.str(std::numeric_limits<Float>::max_digits10, std::ios_base::scientific)) != v))
+         continue;
+      check_shortest(v);
+   }
+   check_shortest((std::numeric_limits<Float>::max)());
+   check_shortest((std::numeric_limits<Float>::min)());
+   check_shortest(Float(ldexp(Float(1), 60)));
+   check_shortest(Float(ldexp(Float(1), -60)));
+
+   char            buf[100];
+   to_chars_result r = to_chars(buf, buf + sizeof(buf), Float(0));
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "0");
+   r = to_chars(buf, buf + sizeof(buf), Float(0), chars_format::scientific);
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "0e+00");
+   r = to_chars(buf, buf + sizeof(buf), Float(-1) / 4);
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "-0.25");
+   r = to_chars(buf, buf + sizeof(buf), Float(100));
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "100");
+   r = to_chars(buf, buf + sizeof(buf), Float(100), chars_format::scientific);
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "1e+02");
+   r = to_chars(buf, buf + sizeof(buf), Float(1234567), chars_format::general);
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "1.234567e+06");
+   r = to_chars(buf, buf + sizeof(buf), Float(1e10));
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "1e+10");
+   r = to_chars(buf, buf + sizeof(buf), Float(1e10), chars_format::fixed);
+   BOOST_CHECK_EQUAL(std::string(buf, r.ptr), "10000000000");
+   r = to_chars(buf, buf + 4, Float(-1) / 4);
+   BOOST_CHECK(r.ec == std::errc::value_too_large);
+}
+
+//
+// cpp_dec_float is formatted from its limbs, with the same result as going via str():
+//
+template <class Float>
+void test_dec_float_digits()
+{
+   const chars_format formats[] = {chars_format::scientific, chars_format::fixed, chars_format::general};
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Float v = random_float<Float>();
+      if (i % 3 == 1)
+         v = Float(static_cast<int>(generator()() % 2000) - 1000) / 1000;
+      else if (i % 3 == 2)
+         v = 1 - pow(Float(10), -static_cast<int>(generator()() % (std::numeric_limits<Float>::max_digits10 + 5)));
+      if (i & 1)
+         v = -v;
+      for (chars_format fmt : formats)
+      {
+         const int       precision = static_cast<int>(generator()() % (std::numeric_limits<Float>::max_digits10 + 20));
+         char            buf[2000], expected[2000];
+         to_chars_result r = to_chars(buf, buf + sizeof(buf), v, fmt, precision);
+         to_chars_result e = boost::multiprecision::detail::to_chars_float_generic(expected, expected + sizeof(expected), v, fmt, precision);
+         BOOST_CHECK(r.ec == std::errc());
+         BOOST_CHECK_EQUAL(std::string(buf, r.ptr), std::string(expected, e.ptr));
+         r = to_chars(buf, buf + sizeof(buf), v, fmt);
+         e = boost::multiprecision::detail::to_chars_shortest_generic(expected, expected + sizeof(expected), v, fmt, false);
+         BOOST_CHECK_EQUAL(std::string(buf, r.ptr), std::string(expected, e.ptr));
+      }
+      char            buf[2000], expected[2000];
+      to_chars_result r = to_chars(buf, buf + sizeof(buf), v);
+      to_chars_result e = boost::multiprecision::detail::to_chars_shortest_generic(expected, expected + sizeof(expected), v, chars_format::general, true);
+      BOOST_CHECK_EQUAL(std::string(buf, r.ptr), std::string(expected, e.ptr));
+   }
+}
+
+//
+// cpp_bin_float is parsed correctly rounded from every digit given, test values just above
+// and exactly half way between two neighbours:
+//
+template <class Float>
+void test_parse_rounding()
+{
+   using wide_type = number<cpp_bin_float<std::numeric_limits<Float>::digits + 1, digit_base_2>, et_off>;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Float v = abs(random_float<Float>());
+      if (v == 0)
+         continue;
+      int e;
+      frexp(v, &e);
+      // The exact decimal expansion of the half way point fits in 400 digits:
+      Float       next = v + ldexp(Float(1), e - std::numeric_limits<Float>::digits);
+      wide_type   half = (wide_type(v) + wide_type(next)) / 2;
+      std::string s    = half.str(400, std::ios_base::scientific);
+      Float       w;
+      from_chars(s.data(), s.data() + s.size(), w);
+      BOOST_CHECK_EQUAL(w, static_cast<Float>(half));
+      // Ties go to the even neighbour:
+      BOOST_CHECK_EQUAL(w, fmod(ldexp(v, std::numeric_limits<Float>::digits - e), 2) != 0 ? next : v);
+      s.insert(s.find('e'), "1");
+      from_chars(s.data(), s.data() + s.size(), w);
+      BOOST_CHECK_EQUAL(w, next);
+   }
+   //
+   // These are left to the backend:
+   //
+   const char*       s = "-0.000e10";
+   Float             w = 2;
+   from_chars_result fr = from_chars(s, s + 9, w);
+   BOOST_CHECK(fr.ptr == s + 9);
+   BOOST_CHECK_EQUAL(w, 0);
+   std::string long_string = "0." + std::string(3000, '3');
+   fr                      = from_chars(long_string.data(), long_string.data() + long_string.size(), w);
+   BOOST_CHECK(fr.ptr == long_string.data() + long_string.size());
+   BOOST_CHECK_EQUAL(w, Float(1) / 3);
+   s  = "1e-999999999";
+   fr = from_chars(s, s + 12, w);
+   BOOST_CHECK(fr.ec == std::errc::result_out_of_range);
+}
+
+int main()
+{
+   test_integer<cpp_int>(1000);
+   test_integer<uint128_t>(128);
+   test_integer<int128_t>(128);
+   test_integer<uint512_t>(512);
+   test_integer<int1024_t>(1024);
+   test_integer<checked_uint256_t>(256);
+   test_integer<number<cpp_int_backend<70, 70, unsigned_magnitude, unchecked, void> > >(70);
+   test_integer<number<cpp_int_backend<1000, 1000, signed_magnitude, unchecked, void> > >(1000);
+   // Trivial types narrower than, and as wide as, a limb:
+   test_integer<number<cpp_int_backend<8, 8, unsigned_magnitude, unchecked, void> > >(8);
+   test_integer<number<cpp_int_backend<8, 8, signed_magnitude, unchecked, void> > >(8);
+   test_integer<number<cpp_int_backend<16, 16, unsigned_magnitude, unchecked, void> > >(16);
+   test_integer<number<cpp_int_backend<16, 16, signed_magnitude, unchecked, void> > >(16);
+   test_integer<number<cpp_int_backend<32, 32, unsigned_magnitude, unchecked, void> > >(32);
+   test_integer<number<cpp_int_backend<32, 32, signed_magnitude, unchecked, void> > >(32);
+   test_integer<number<cpp_int_backend<64, 64, unsigned_magnitude, unchecked, void> > >(64);
+   test_integer<number<cpp_int_backend<64, 64, signed_magnitude, unchecked, void> > >(64);
+   test_integer<number<cpp_int_backend<32, 32, unsigned_magnitude, checked, void> > >(32);
+
+   test_float<cpp_bin_float_double>();
+   test_float<cpp_bin_float_quad>();
+   test_float<cpp_bin_float_50>();
+   test_float<number<cpp_bin_float<30, digit_base_10, std::allocator<char> > > >();
+   test_float<cpp_dec_float_50>();
+
+   test_shortest<cpp_bin_float_double>();
+   test_shortest<cpp_bin_float_single>();
+   test_shortest<cpp_bin_float_quad>();
+   test_shortest<cpp_bin_float_50>();
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+   test_shortest<cpp_double_double>();
+#endif
+   test_shortest<cpp_dec_float_50>();
+
+   test_dec_float_digits<cpp_dec_float_50>();
+   test_dec_float_digits<number<cpp_dec_float<19> > >();
+   test_dec_float_digits<number<cpp_dec_float<30, std::int64_t, std::allocator<void> > > >();
+
+   test_parse_rounding<cpp_bin_float_double>();
+   test_parse_rounding<cpp_bin_float_quad>();
+   test_parse_rounding<cpp_bin_float_50>();
+   //
+   // The same output as std::to_chars gives for double:
+   //
+   const double values[]   = {0.1, 0.3, 1e23, 5e-300, 1.7976931348623157e308, 2.2250738585072014e-308, 123456.0, 1e-5, 0.0001, 9007199254740993.0};
+   const char*  expected[] = {"0.1", "0.3", "1e+23", "5e-300", "1.7976931348623157e+308", "2.2250738585072014e-308", "123456", "1e-05", "1e-04", "9007199254740992"};
+   for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+   {
+      char            buf[100];
+      to_chars_result r = to_chars(buf, buf + sizeof(buf), cpp_bin_float_double(values[i]));
+      BOOST_CHECK_EQUAL(std::string(buf, r.ptr), expected[i]);
+   }
+   return boost::report_errors();
+}
@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks write_column and column_view in column_view.hpp, round trips, the exact layout,
+// and loading from unaligned storage.
+//
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <boost/multiprecision/column_view.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+#include <boost/multiprecision/cpp_double_fp.hpp>
+#endif
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Number>
+Number random_value(const std::integral_constant<bool, true>&)
+{
+   return random_integer<Number>(std::numeric_limits<Number>::digits);
+}
+template <class Number>
+Number random_value(const std::integral_constant<bool, false>&)
+{
+   Number result = generator()();
+   for (unsigned i = 0; i < 4; ++i)
+   {
+      result *= std::numeric_limits<std::uint32_t>::max();
+      result += generator()();
+   }
+   result = ldexp(result, static_cast<int>(generator()() % 200) - 100 - 160);
+   if (generator()() & 1u)
+      result = -result;
+   return result;
+}
+
+template <class Number>
+void test()
+{
+   std::vector<Number> values;
+   values.push_back(Number(0));
+   values.push_back(Number(1));
+   values.push_back((std::numeric_limits<Number>::max)());
+   values.push_back((std::numeric_limits<Number>::lowest)());
+   if (std::numeric_limits<Number>::has_infinity)
+   {
+      values.push_back(std::numeric_limits<Number>::infinity());
+      values.push_back(Number(0) - std::numeric_limits<Number>::infinity());
+   }
+   for (unsigned i = 0; i < 1000; ++i)
+      values.push_back(random_value<Number>(std::integral_constant<bool, std::numeric_limits<Number>::is_integer>()));
+
+   const std::size_t stride = column_stride<Number>::value;
+   BOOST_CHECK_EQUAL(column_view<Number>::stride, stride);
+   //
+   // Store at an odd offset so that loads are unaligned:
+   //
+   std::vector<unsigned char> buf(1 + values.size() * stride + stride / 2);
+   unsigned char*             end = write_column(buf.data() + 1, values.begin(), values.end());
+   BOOST_CHECK(end == buf.data() + 1 + values.size() * stride);
+
+   column_view<Number> view(buf.data() + 1, buf.size() - 1);
+   BOOST_CHECK_EQUAL(view.size(), values.size());
+   BOOST_CHECK(!view.empty());
+   for (std::size_t i = 0; i < values.size(); ++i)
+   {
+      BOOST_CHECK_EQUAL(view[i], values[i]);
+      Number x(2);
+      view.load(i, x);
+      BOOST_CHECK_EQUAL(x, values[i]);
+   }
+   std::size_t i = 0;
+   for (typename column_view<Number>::const_iterator it = view.begin(); it != view.end(); ++it, ++i)
+      BOOST_CHECK_EQUAL(*it, values[i]);
+   BOOST_CHECK_EQUAL(i, values.size());
+   BOOST_CHECK_EQUAL(view.end() - view.begin(), static_cast<std::ptrdiff_t>(values.size()));
+   //
+   // Random access, including through the standard algorithms:
+   //
+   using const_iterator = typename column_view<Number>::const_iterator;
+   static_assert(std::is_same<typename std::iterator_traits<const_iterator>::iterator_category, std::random_access_iterator_tag>::value, "column_view is random access");
+   const_iterator it = view.begin();
+   std::advance(it, 5);
+   BOOST_CHECK_EQUAL(*it, values[5]);
+   BOOST_CHECK_EQUAL(it[2], values[7]);
+   BOOST_CHECK(2 + it == it + 2);
+   BOOST_CHECK(it - 2 == view.begin() + 3);
+   BOOST_CHECK_EQUAL(*--it, values[4]);
+   BOOST_CHECK((it < it + 1) && (it + 1 > it) && (it <= it) && (it >= it));
+   BOOST_CHECK_EQUAL(std::distance(view.begin(), view.end()), static_cast<std::ptrdiff_t>(values.size()));
+   BOOST_CHECK_EQUAL(view.at(3), values[3]);
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(view.at(values.size()), std::out_of_range);
+#endif
+   BOOST_CHECK(column_view<Number>().empty());
+   //
+   // Binary search over sorted values:
+   //
+   std::vector<Number> sorted(values);
+   std::sort(sorted.begin(), sorted.end());
+   write_column(buf.data() + 1, sorted.begin(), sorted.end());
+   for (std::size_t j = 0; j < sorted.size(); j += 97)
+      BOOST_CHECK(std::lower_bound(view.begin(), view.end(), sorted[j]) == view.begin() + (std::lower_bound(sorted.begin(), sorted.end(), sorted[j]) - sorted.begin()));
+}
+
+int main()
+{
+   test<uint256_t>();
+   test<int256_t>();
+   test<uint128_t>();
+   test<int128_t>();
+   test<checked_uint512_t>();
+   test<number<cpp_int_backend<70, 70, unsigned_magnitude, unchecked, void> > >();
+   test<number<cpp_int_backend<12, 12, signed_magnitude, unchecked, void> > >();
+   test<cpp_bin_float_double>();
+   test<cpp_bin_float_quad>();
+   test<cpp_bin_float_50>();
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+   test<cpp_double_float>();
+   test<cpp_double_double>();
+#endif
+   //
+   // The exact layout, which is the same on every platform:
+   //
+   {
+      const int256_t  v[] = {-0x0102, 0x7F};
+      unsigned char   buf[2 * 33];
+      write_column(buf, v, v + 2);
+      BOOST_CHECK_EQUAL(column_stride<int256_t>::value, 33u);
+      BOOST_CHECK_EQUAL(buf[0], 2);
+      BOOST_CHECK_EQUAL(buf[1], 1);
+      for (unsigned i = 2; i < 32; ++i)
+         BOOST_CHECK_EQUAL(buf[i], 0);
+      BOOST_CHECK_EQUAL(buf[32], 1);
+      BOOST_CHECK_EQUAL(buf[33], 0x7F);
+      BOOST_CHECK_EQUAL(buf[65], 0);
+
+      const cpp_bin_float_quad q[] = {-1.5};
+      unsigned char            qbuf[15 + 2 + 1];
+      BOOST_CHECK_EQUAL(column_stride<cpp_bin_float_quad>::value, sizeof(qbuf));
+      write_column(qbuf, q, q + 1);
+      BOOST_CHECK_EQUAL(qbuf[12], 0);
+      BOOST_CHECK_EQUAL(qbuf[13], 0x80);
+      BOOST_CHECK_EQUAL(qbuf[14], 0x01);
+      BOOST_CHECK_EQUAL(qbuf[15], 0);
+      BOOST_CHECK_EQUAL(qbuf[16], 0);
+      BOOST_CHECK_EQUAL(qbuf[17], 1);
+   }
+   //
+   // Bits above the precision of the type are ignored when loading corrupt data:
+   //
+   {
+      using checked_uint70_t = number<cpp_int_backend<70, 70, unsigned_magnitude, checked, void> >;
+      unsigned char buf[9];
+      std::fill(buf, buf + 9, static_cast<unsigned char>(0xFF));
+      BOOST_CHECK_EQUAL(column_view<checked_uint70_t>(buf, sizeof(buf))[0], (std::numeric_limits<checked_uint70_t>::max)());
+      using uint12_t = number<cpp_int_backend<12, 12, unsigned_magnitude, checked, void> >;
+      BOOST_CHECK_EQUAL(column_view<uint12_t>(buf, 2)[0], 0xFFF);
+   }
+   return boost::report_errors();
+}
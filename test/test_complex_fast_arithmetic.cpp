@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the accuracy of complex_adaptor multiplication and division at precisions
+// where the Gauss multiplication, squaring and reciprocal division code is used.
+//
+#include <boost/multiprecision/cpp_complex.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Real>
+Real random_value()
+{
+   Real result = static_cast<std::int64_t>(generator()()) - 0x7FFFFFFF;
+   result /= generator()() | 1u;
+   // Vary the exponent a little too:
+   result = ldexp(result, static_cast<int>(generator()() % 64) - 32);
+   return result;
+}
+
+template <class To, class From>
+To convert(const From& z)
+{
+   using real_type = typename To::value_type;
+   return To(static_cast<real_type>(z.real()), static_cast<real_type>(z.imag()));
+}
+
+template <class Complex, class Reference>
+void check_close(const Complex& result, const Reference& expected, unsigned ulps)
+{
+   using real_type = typename Complex::value_type;
+   Reference diff(expected);
+   diff -= convert<Reference>(result);
+   real_type err  = static_cast<real_type>(abs(diff));
+   real_type norm = static_cast<real_type>(abs(expected));
+   BOOST_CHECK_LE(err, norm * std::numeric_limits<real_type>::epsilon() * ulps);
+}
+
+template <class Complex, class Reference>
+void test()
+{
+   using real_type = typename Complex::value_type;
+   for (unsigned i = 0; i < 500; ++i)
+   {
+      Complex   a(random_value<real_type>(), random_value<real_type>());
+      Complex   b(random_value<real_type>(), random_value<real_type>());
+      Reference ra = convert<Reference>(a), rb = convert<Reference>(b);
+
+      Complex r(a);
+      r *= b;
+      check_close(r, Reference(ra * rb), 4);
+      check_close(Complex(a * b), Reference(ra * rb), 4);
+      r = a;
+      r *= r;
+      check_close(r, Reference(ra * ra), 4);
+      check_close(Complex(a * a), Reference(ra * ra), 4);
+      r = a;
+      r /= b;
+      check_close(r, Reference(ra / rb), 8);
+      check_close(Complex(a / b), Reference(ra / rb), 8);
+      r = a;
+      r /= r;
+      check_close(r, Reference(1), 8);
+   }
+   //
+   // Values which must not take the fast paths:
+   //
+   Complex inf(std::numeric_limits<real_type>::infinity(), real_type(1));
+   Complex one_one(real_type(1), real_type(1));
+   Complex z = inf * one_one;
+   BOOST_CHECK((boost::multiprecision::isinf)(z.real()));
+   z = one_one / Complex(real_type(0), real_type(0));
+   BOOST_CHECK(!(boost::multiprecision::isfinite)(z.real()));
+   // Results which underflow or overflow when squaring the divisor:
+   Complex huge(ldexp(real_type(1), std::numeric_limits<real_type>::max_exponent - 2), ldexp(real_type(1), std::numeric_limits<real_type>::max_exponent - 2));
+   z = huge / huge;
+   check_close(z, Reference(1), 8);
+   z = one_one / huge;
+   BOOST_CHECK(z.real() > 0);
+   BOOST_CHECK_EQUAL(z.imag(), 0);
+}
+
+int main()
+{
+   test<cpp_complex_50, number<complex_adaptor<cpp_bin_float<100> >, et_off> >();
+   test<cpp_complex_100, number<complex_adaptor<cpp_bin_float<150> >, et_off> >();
+   test<number<complex_adaptor<cpp_bin_float<500> >, et_on>, number<complex_adaptor<cpp_bin_float<550> >, et_off> >();
+   return boost::report_errors();
+}
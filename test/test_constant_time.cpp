@@ -0,0 +1,88 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the constant time routines against the regular arithmetic.
+//
+#include <boost/multiprecision/constant_time.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+Integer random_integer()
+{
+   // A mixture of full width values, small values and values with runs of 1's and 0's:
+   switch (generator()() % 6)
+   {
+   case 0:
+      return generate_random<Integer>(32);
+   case 1:
+      return ~Integer(0);
+   case 2:
+   {
+      Integer result = 0;
+      for (unsigned i = 0; i < std::numeric_limits<Integer>::digits / 32 + 1; ++i)
+      {
+         result <<= 32;
+         result += i & 1 ? 0u : 0xFFFFFFFFu;
+      }
+      return result;
+   }
+   default:
+      return generate_random<Integer>(std::numeric_limits<Integer>::digits);
+   }
+}
+
+template <class Integer>
+void test()
+{
+   for (unsigned i = 0; i < 3000; ++i)
+   {
+      Integer a = random_integer<Integer>();
+      Integer b = i % 7 ? random_integer<Integer>() : a;
+      BOOST_CHECK_EQUAL(ct_equal(a, b), a == b);
+      BOOST_CHECK_EQUAL(ct_less(a, b), a < b);
+      BOOST_CHECK_EQUAL(ct_less(b, a), b < a);
+      BOOST_CHECK_EQUAL(ct_select(true, a, b), a);
+      BOOST_CHECK_EQUAL(ct_select(false, a, b), b);
+      BOOST_CHECK_EQUAL(ct_add(a, b), Integer(a + b));
+      BOOST_CHECK_EQUAL(ct_subtract(a, b), Integer(a - b));
+      BOOST_CHECK_EQUAL(ct_multiply(a, b), Integer(a * b));
+   }
+   for (unsigned i = 0; i < 300; ++i)
+   {
+      Integer m = random_integer<Integer>() | 1u;
+      if (i == 0)
+         m = (std::numeric_limits<Integer>::max)();
+      else if (i == 1)
+         m = 3;
+      Integer b = random_integer<Integer>(), e = random_integer<Integer>();
+      if (i % 5 == 0)
+         b %= m;
+      if (i % 11 == 0)
+         e = i % 2;
+      BOOST_CHECK_EQUAL(ct_powm(b, e, m), Integer(powm(b, e, m)));
+   }
+   BOOST_CHECK_EQUAL(ct_powm(Integer(5), Integer(3), Integer(1)), 0);
+   BOOST_CHECK_EQUAL(ct_powm(Integer(0), Integer(0), Integer(7)), 1);
+   BOOST_CHECK_EQUAL(ct_powm(Integer(14), Integer(5), Integer(7)), 0);
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(ct_powm(Integer(5), Integer(3), Integer(8)), std::domain_error);
+   BOOST_CHECK_THROW(ct_powm(Integer(5), Integer(3), Integer(0)), std::domain_error);
+#endif
+}
+
+int main()
+{
+   test<number<cpp_int_backend<192, 192, unsigned_magnitude, unchecked, void> > >();
+   test<uint256_t>();
+   test<number<cpp_int_backend<384, 384, unsigned_magnitude, unchecked, void> > >();
+   test<number<cpp_int_backend<255, 255, unsigned_magnitude, unchecked, void> > >();
+   test<number<cpp_int_backend<521, 521, unsigned_magnitude, unchecked, void>, et_off> >();
+   test<uint1024_t>();
+   return boost::report_errors();
+}
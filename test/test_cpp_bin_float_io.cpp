@@ -247,6 +247,45 @@ void test_round_trip()
    std::cout << "Execution time = " << boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count() << "s" << std::endl;
 }
 
+//
+// Decimal strings of the exact midpoint between two adjacent values round to the even one,
+// and the values either side of the midpoint round to the nearer, this covers both the
+// limb sized fast path and the exact path with cached powers of 5:
+//
+template <class T>
+void test_halfway()
+{
+   using boost::multiprecision::cpp_int;
+   static boost::random::mt19937 gen;
+   const int                     bits = std::numeric_limits<T>::digits;
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      cpp_int m = 0;
+      while ((m == 0) || (msb(m) < static_cast<unsigned>(bits + 32)))
+         m = (m << 32) | gen();
+      m >>= msb(m) - bits + 1;
+      // Small exponents most of the time so that short inputs are well covered:
+      const int e2 = i % 4 ? static_cast<int>(gen() % 100) - 70 : static_cast<int>(gen() % 1000) - 500;
+      const cpp_int half = 2 * m + 1;
+      for (int offset = -1; offset <= 1; ++offset)
+      {
+         // half * 2^(e2 - 1) as a decimal integer, scaled by 10 so that we can add an offset:
+         cpp_int     digits = 10 * half;
+         std::string s;
+         if (e2 >= 1)
+            s = cpp_int((digits << (e2 - 1)) + offset).str() + "e-1";
+         else
+            s = cpp_int(digits * pow(cpp_int(5), static_cast<unsigned>(1 - e2)) + offset).str() + "e" + std::to_string(e2 - 2);
+         T val(s);
+         T expected(offset < 0 ? m : offset > 0 ? cpp_int(m + 1) : cpp_int(m + (m & 1)));
+         expected = ldexp(expected, e2);
+         BOOST_CHECK_EQUAL(val, expected);
+         val = T("-" + s);
+         BOOST_CHECK_EQUAL(val, T(-expected));
+      }
+   }
+}
+
 #if !defined(TEST1) && !defined(TEST2)
 #define TEST1
 #define TEST2
@@ -257,10 +296,15 @@ int main()
    using namespace boost::multiprecision;
 #ifdef TEST1
    test<number<cpp_bin_float<113, digit_base_2> > >();
+   test_halfway<number<cpp_bin_float<113, digit_base_2> > >();
+   test_halfway<number<cpp_bin_float<24, digit_base_2> > >();
+   test_halfway<number<cpp_bin_float<50> > >();
    test_round_trip<number<cpp_bin_float<113, digit_base_2> > >();
 #endif
 #ifdef TEST2
    test<number<cpp_bin_float<53, digit_base_2> > >();
+   test_halfway<number<cpp_bin_float<53, digit_base_2> > >();
+   test_halfway<number<cpp_bin_float<63, digit_base_2> > >();
    test_round_trip<number<cpp_bin_float<53, digit_base_2> > >();
 #endif
    return boost::report_errors();
@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the unrolled full width addition, subtraction and multiplication of the
+// small fixed precision types against cpp_int arithmetic reduced to the same width.
+//
+#include <boost/multiprecision/cpp_int.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+//
+// Random value of up to bits bits, most of them full width, some all ones:
+//
+cpp_int random_integer(unsigned bits)
+{
+   switch (generator()() % 8)
+   {
+   case 0:
+      return (cpp_int(1) << bits) - 1;
+   case 1:
+      return generate_random<cpp_int>(32 * (1 + generator()() % (bits / 32)));
+   case 2:
+      return 0;
+   default:
+      return generate_random<cpp_int>(bits);
+   }
+}
+
+//
+// Reduces x to the value an unsigned fixed type of bits bits holds:
+//
+cpp_int wrap(const cpp_int& x, unsigned bits)
+{
+   cpp_int modulus = cpp_int(1) << bits;
+   cpp_int r       = x % modulus;
+   return r < 0 ? cpp_int(r + modulus) : r;
+}
+
+template <class Integer>
+void test_unsigned()
+{
+   constexpr unsigned bits = std::numeric_limits<Integer>::digits;
+   for (unsigned i = 0; i < 5000; ++i)
+   {
+      cpp_int a = random_integer(bits), b = random_integer(bits);
+      Integer fa(a), fb(b);
+      BOOST_CHECK_EQUAL(cpp_int(fa + fb), wrap(a + b, bits));
+      BOOST_CHECK_EQUAL(cpp_int(fa - fb), wrap(a - b, bits));
+      BOOST_CHECK_EQUAL(cpp_int(fa * fb), wrap(a * b, bits));
+      // Aliased arguments:
+      Integer r(fa);
+      r += r;
+      BOOST_CHECK_EQUAL(cpp_int(r), wrap(a + a, bits));
+      r = fa;
+      r -= fb;
+      BOOST_CHECK_EQUAL(cpp_int(r), wrap(a - b, bits));
+      r = fb;
+      r *= r;
+      BOOST_CHECK_EQUAL(cpp_int(r), wrap(b * b, bits));
+   }
+   Integer m = (std::numeric_limits<Integer>::max)();
+   BOOST_CHECK_EQUAL(Integer(m + m), Integer(m - 1));
+   BOOST_CHECK_EQUAL(Integer(m * m), Integer(1));
+   BOOST_CHECK_EQUAL(Integer(m - m), Integer(0));
+   BOOST_CHECK_EQUAL(Integer(Integer(0) - m), Integer(1));
+}
+
+template <class Integer>
+void test_signed()
+{
+   constexpr unsigned bits = std::numeric_limits<Integer>::digits;
+   for (unsigned i = 0; i < 5000; ++i)
+   {
+      cpp_int a = random_integer(bits), b = random_integer(bits);
+      if (generator()() & 1u)
+         a = -a;
+      if (generator()() & 1u)
+         b = -b;
+      Integer fa(a), fb(b);
+      // Signed magnitude types wrap the magnitude and keep the sign of the exact result:
+      cpp_int sum = a + b, difference = a - b, product = a * b;
+      BOOST_CHECK_EQUAL(cpp_int(fa + fb), sum.sign() * wrap(abs(sum), bits));
+      BOOST_CHECK_EQUAL(cpp_int(fa - fb), difference.sign() * wrap(abs(difference), bits));
+      BOOST_CHECK_EQUAL(cpp_int(fa * fb), product.sign() * wrap(abs(product), bits));
+      BOOST_CHECK_EQUAL(cpp_int(fa - fa), 0);
+      BOOST_CHECK(!(fa - fa).backend().sign());
+      Integer r(fa);
+      r *= r;
+      BOOST_CHECK_EQUAL(cpp_int(r), wrap(a * a, bits));
+   }
+}
+
+int main()
+{
+   test_unsigned<uint128_t>();
+   test_unsigned<uint256_t>();
+   test_unsigned<uint512_t>();
+   test_unsigned<uint1024_t>();
+   test_unsigned<number<cpp_int_backend<320, 320, unsigned_magnitude, unchecked, void> > >();
+   test_signed<int256_t>();
+   test_signed<int512_t>();
+   test_signed<int1024_t>();
+   return boost::report_errors();
+}
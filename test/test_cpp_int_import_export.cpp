@@ -62,6 +62,14 @@ void test_round_trip_neg(T val, const std::integral_constant<bool, true>&)
    export_bits(val, std::back_inserter(cv), 8, false);
    import_bits(newval, cv.begin(), cv.end(), 8, false);
    BOOST_CHECK_EQUAL(-val, newval);
+   // Importing via pointers over a negative value:
+   newval = val;
+   import_bits(newval, &cv[0], &cv[0] + cv.size(), 8, false);
+   BOOST_CHECK_EQUAL(-val, newval);
+   std::reverse(cv.begin(), cv.end());
+   newval = val;
+   import_bits(newval, &cv[0], &cv[0] + cv.size());
+   BOOST_CHECK_EQUAL(-val, newval);
 }
 
 template <class T>
@@ -137,6 +145,57 @@ void test_round_trip(T val)
    import_bits(newval, cv.begin(), cv.end(), 6, false);
    BOOST_CHECK_EQUAL(val, newval);
 
+   //
+   // Big endian bytes, and whole chunks of other sizes, via pointers, which are imported
+   // a limb at a time:
+   //
+   cv.clear();
+   export_bits(val, std::back_inserter(cv), 8);
+   newval = 0;
+   import_bits(newval, &cv[0], &cv[0] + cv.size());
+   BOOST_CHECK_EQUAL(val, newval);
+   cv.insert(cv.begin(), 5, static_cast<unsigned char>(0));
+   newval = 0;
+   import_bits(newval, &cv[0], &cv[0] + cv.size(), 8, true);
+   BOOST_CHECK_EQUAL(val, newval);
+   std::reverse(cv.begin(), cv.end());
+   newval = 0;
+   import_bits(newval, &cv[0], &cv[0] + cv.size(), 8, false);
+   BOOST_CHECK_EQUAL(val, newval);
+
+   // Exporting bytes through a pointer, which copies a limb at a time:
+   for (int msv_first = 0; msv_first < 2; ++msv_first)
+   {
+      cv.clear();
+      export_bits(val, std::back_inserter(cv), 8, msv_first != 0);
+      std::vector<unsigned char> pv(cv.size() + 1, static_cast<unsigned char>(0xAA));
+      unsigned char*             pend = export_bits(val, &pv[0], 8, msv_first != 0);
+      BOOST_CHECK_EQUAL(pend - &pv[0], static_cast<std::ptrdiff_t>(cv.size()));
+      BOOST_CHECK(std::equal(cv.begin(), cv.end(), pv.begin()));
+      BOOST_CHECK_EQUAL(pv.back(), 0xAA);
+   }
+
+   std::vector<std::uint16_t> sv;
+   export_bits(val, std::back_inserter(sv), 16);
+   newval = 0;
+   import_bits(newval, &sv[0], &sv[0] + sv.size());
+   BOOST_CHECK_EQUAL(val, newval);
+   std::reverse(sv.begin(), sv.end());
+   newval = 0;
+   import_bits(newval, &sv[0], &sv[0] + sv.size(), 16, false);
+   BOOST_CHECK_EQUAL(val, newval);
+
+   std::vector<std::uint32_t> wv;
+   export_bits(val, std::back_inserter(wv), 32);
+   newval = 0;
+   import_bits(newval, &wv[0], &wv[0] + wv.size(), 32);
+   BOOST_CHECK_EQUAL(val, newval);
+   wv.clear();
+   export_bits(val, std::back_inserter(wv), 32, false);
+   newval = 0;
+   import_bits(newval, &wv[0], &wv[0] + wv.size(), 0, false);
+   BOOST_CHECK_EQUAL(val, newval);
+
    test_round_trip_neg(val, std::integral_constant<bool, std::numeric_limits<T>::is_signed>());
 }
 
@@ -166,5 +225,21 @@ int main()
    test_round_trip<boost::multiprecision::checked_uint512_t>();
    test_round_trip<boost::multiprecision::number<boost::multiprecision::cpp_int_backend<64, 64, boost::multiprecision::unsigned_magnitude, boost::multiprecision::checked, void> > >();
    test_round_trip<boost::multiprecision::number<boost::multiprecision::cpp_int_backend<23, 23, boost::multiprecision::unsigned_magnitude, boost::multiprecision::checked, void> > >();
+   test_round_trip<boost::multiprecision::int128_t>();
+   test_round_trip<boost::multiprecision::uint256_t>();
+   test_round_trip<boost::multiprecision::number<boost::multiprecision::cpp_int_backend<70, 70, boost::multiprecision::unsigned_magnitude, boost::multiprecision::unchecked, void> > >();
+#ifndef BOOST_NO_EXCEPTIONS
+   //
+   // Values which are too large for checked types throw, however they are imported:
+   //
+   {
+      const unsigned char                          bytes[] = {1, 0, 0, 0, 0, 0, 0, 0, 0};
+      boost::multiprecision::checked_uint128_t     small;
+      boost::multiprecision::number<boost::multiprecision::cpp_int_backend<64, 64, boost::multiprecision::unsigned_magnitude, boost::multiprecision::checked, void> > tiny;
+      BOOST_CHECK_THROW(import_bits(tiny, bytes, bytes + sizeof(bytes)), std::overflow_error);
+      import_bits(small, bytes, bytes + sizeof(bytes));
+      BOOST_CHECK_EQUAL(small, boost::multiprecision::checked_uint128_t(1) << 64);
+   }
+#endif
    return boost::report_errors();
 }
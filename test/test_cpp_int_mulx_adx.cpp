@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the schoolbook and single limb multiplication of cpp_int against an
+// independent 32-bit reference, for every limb count up to the Karatsuba cutoff.
+// On x86-64 CPUs with BMI2/ADX this exercises the MULX/ADCX/ADOX kernels.
+//
+#include <vector>
+#include <iterator>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+cpp_int random_limbs(unsigned limbs)
+{
+   const unsigned bits = limbs * sizeof(limb_type) * CHAR_BIT;
+   // Mix in some all-ones values to stress the carry chains:
+   return generator()() % 4 == 0 ? cpp_int((cpp_int(1) << bits) - 1) : generate_random<cpp_int>(bits);
+}
+
+cpp_int reference_multiply(const cpp_int& a, const cpp_int& b)
+{
+   std::vector<std::uint32_t> va, vb;
+   export_bits(a, std::back_inserter(va), 32, false);
+   export_bits(b, std::back_inserter(vb), 32, false);
+   std::vector<std::uint32_t> r(va.size() + vb.size(), 0);
+   for (std::size_t i = 0; i < va.size(); ++i)
+   {
+      std::uint64_t carry = 0;
+      for (std::size_t j = 0; j < vb.size(); ++j)
+      {
+         carry += static_cast<std::uint64_t>(va[i]) * vb[j] + r[i + j];
+         r[i + j] = static_cast<std::uint32_t>(carry);
+         carry >>= 32;
+      }
+      r[i + vb.size()] = static_cast<std::uint32_t>(carry);
+   }
+   cpp_int result;
+   import_bits(result, r.begin(), r.end(), 32, false);
+   if (a.sign() * b.sign() < 0)
+      result = -result;
+   return result;
+}
+
+template <class Integer>
+void check_fixed(const cpp_int& a, const cpp_int& b)
+{
+   constexpr unsigned bits = std::numeric_limits<Integer>::digits;
+   cpp_int            mask = (cpp_int(1) << bits) - 1;
+   Integer            fa(a & mask), fb(b & mask);
+   BOOST_CHECK_EQUAL(cpp_int(fa * fb), cpp_int(reference_multiply(a & mask, b & mask) & mask));
+}
+
+int main()
+{
+   for (unsigned as = 1; as < 48; ++as)
+   {
+      for (unsigned bs = 1; bs < 48; bs += 1 + generator()() % 3)
+      {
+         cpp_int a = random_limbs(as), b = random_limbs(bs);
+         if (generator()() & 1u)
+            a = -a;
+         cpp_int expected = reference_multiply(a, b);
+         BOOST_CHECK_EQUAL(cpp_int(a * b), expected);
+         // Aliased arguments:
+         cpp_int r(a);
+         r *= b;
+         BOOST_CHECK_EQUAL(r, expected);
+         r = b;
+         r *= r;
+         BOOST_CHECK_EQUAL(r, reference_multiply(b, b));
+         // Multiplication by a single limb:
+         limb_type l = static_cast<limb_type>(b);
+         if (l == 0)
+            l = 1;
+         BOOST_CHECK_EQUAL(cpp_int(a * l), reference_multiply(a, cpp_int(l)));
+         r = a;
+         r *= l;
+         BOOST_CHECK_EQUAL(r, reference_multiply(a, cpp_int(l)));
+         // Fixed precision types truncate the result:
+         check_fixed<uint256_t>(abs(a), b);
+         check_fixed<uint512_t>(abs(a), b);
+         check_fixed<uint1024_t>(abs(a), b);
+      }
+   }
+#ifndef BOOST_NO_EXCEPTIONS
+   checked_uint512_t big = (std::numeric_limits<checked_uint512_t>::max)() / 3;
+   BOOST_CHECK_THROW(big * big, std::overflow_error);
+   BOOST_CHECK_THROW(big * static_cast<limb_type>(4), std::overflow_error);
+#endif
+   return boost::report_errors();
+}
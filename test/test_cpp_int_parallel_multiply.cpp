@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks that threaded Karatsuba multiplication gives the same results as the serial code,
+// the cutoff is lowered so that several levels of recursion are threaded:
+//
+#define BOOST_MP_KARATSUBA_PARALLEL_CUTOFF 60
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+Integer random_limbs(unsigned limbs)
+{
+   const unsigned bits = limbs * sizeof(limb_type) * CHAR_BIT;
+   return generator()() % 4 == 0 ? Integer((Integer(1) << bits) - 1) : generate_random<Integer>(bits);
+}
+
+template <class Integer>
+void test(unsigned max_limbs)
+{
+   for (unsigned i = 0; i < 60; ++i)
+   {
+      Integer a = random_limbs<Integer>(40 + generator()() % max_limbs);
+      Integer b = i % 3 ? random_limbs<Integer>(40 + generator()() % max_limbs) : a;
+      if (std::numeric_limits<Integer>::is_signed && (i & 1))
+         a = Integer(0) - a;
+
+      cpp_int_multiply_threads(1);
+      Integer expected = a * b;
+      // Thread counts which do and don't divide evenly between the three Karatsuba products:
+      const std::size_t thread_counts[] = {2, 3, 4, 9};
+      for (std::size_t threads : thread_counts)
+      {
+         cpp_int_multiply_threads(threads);
+#ifdef BOOST_HAS_THREADS
+         BOOST_CHECK_EQUAL(cpp_int_multiply_threads(), threads);
+#endif
+         BOOST_CHECK_EQUAL(Integer(a * b), expected);
+         Integer r(a);
+         r *= b;
+         BOOST_CHECK_EQUAL(r, expected);
+         r = b;
+         r *= r;
+         BOOST_CHECK_EQUAL(r, Integer(b * b));
+      }
+   }
+   cpp_int_multiply_threads(1);
+}
+
+int main()
+{
+   test<cpp_int>(1000);
+   test<number<cpp_int_backend<16384, 16384, unsigned_magnitude, unchecked, void> > >(200);
+   test<number<cpp_int_backend<8192, 8192, signed_magnitude, unchecked, void> > >(200);
+   cpp_int_multiply_threads(0);
+   BOOST_CHECK_EQUAL(cpp_int_multiply_threads(), 1u);
+   return boost::report_errors();
+}
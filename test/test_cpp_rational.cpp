@@ -24,13 +24,14 @@
 #pragma warning(disable : 4127) //  Conditional expression is constant
 #endif
 
-#if !defined(TEST1) && !defined(TEST2) && !defined(TEST3) && !defined(TEST4) && !defined(TEST5) && !defined(TEST6)
+#if !defined(TEST1) && !defined(TEST2) && !defined(TEST3) && !defined(TEST4) && !defined(TEST5) && !defined(TEST6) && !defined(TEST7)
 #define TEST1
 #define TEST2
 #define TEST3
 #define TEST4
 #define TEST5
 #define TEST6
+#define TEST7
 #endif
 
 namespace local_random
@@ -1178,6 +1179,84 @@ struct tester
       BOOST_CHECK_EQUAL((x > bi), (x1 > bi1));
    }
 
+   void t7()
+   {
+      //
+      // Rationals with unit denominators, and aliased arguments:
+      //
+      boost::multiprecision::mpq_rational x(a, b), y(c), z;
+      boost::multiprecision::cpp_rational x1(a1, b1), y1(c1), z1;
+
+      BOOST_CHECK_EQUAL(x.str(), x1.str());
+      BOOST_CHECK_EQUAL(y.str(), y1.str());
+
+      for (unsigned i = 0; i < 2; ++i)
+      {
+         z  = x + y;
+         z1 = x1 + y1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = y + x;
+         z1 = y1 + x1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = x - y;
+         z1 = x1 - y1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = y - x;
+         z1 = y1 - x1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = x * y;
+         z1 = x1 * y1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = y * x;
+         z1 = y1 * x1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = x / y;
+         z1 = x1 / y1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = y / x;
+         z1 = y1 / x1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+
+         // Inplace:
+         z  = y;
+         z1 = y1;
+         z -= x;
+         z1 -= x1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = y;
+         z1 = y1;
+         z /= x;
+         z1 /= x1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z  = x;
+         z1 = x1;
+         z /= y;
+         z1 /= y1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+
+         // Aliased:
+         z  = x;
+         z1 = x1;
+         z *= z;
+         z1 *= z1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z1 /= z1;
+         BOOST_CHECK_EQUAL(z1, 1);
+         z  = x;
+         z1 = x1;
+         z += z;
+         z1 += z1;
+         BOOST_CHECK_EQUAL(z.str(), z1.str());
+         z1 -= z1;
+         BOOST_CHECK_EQUAL(z1, 0);
+
+         x  = -x;
+         x1 = -x1;
+         y  = -y;
+         y1 = -y1;
+      }
+   }
+
    void test()
    {
       using namespace boost::multiprecision;
@@ -1251,6 +1330,10 @@ struct tester
          t6();
          #endif
 
+         #if defined(TEST7)
+         t7();
+         #endif
+
          if (last_error_count != static_cast<unsigned>(boost::detail::test_errors()))
          {
             last_error_count = boost::detail::test_errors();
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/integer.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+Integer random_integer(unsigned bits, bool allow_negative)
+{
+   const Integer result = generate_random<Integer>(bits);
+   return allow_negative ? random_sign(result) : result;
+}
+
+template <class Integer>
+void test(unsigned max_bits, bool allow_negative)
+{
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      unsigned qbits = 1 + generator()() % (max_bits / 2);
+      unsigned bbits = 1 + generator()() % (max_bits / 2);
+      Integer  q     = random_integer<Integer>(qbits, allow_negative);
+      Integer  b     = random_integer<Integer>(bbits, allow_negative);
+      if (b == 0)
+         b = 1;
+      // Make some divisors even:
+      if (i % 3 == 0)
+         b *= Integer(1) << (generator()() % (max_bits / 2 - bbits + 1));
+      Integer a = q * b;
+      BOOST_CHECK_EQUAL(divide_exact(a, b), q);
+      BOOST_CHECK_EQUAL(divide_exact(a, q == 0 ? Integer(1) : q), q == 0 ? Integer(0) : b);
+      BOOST_CHECK_EQUAL(divide_exact(a, Integer(1)), a);
+      BOOST_CHECK_EQUAL(divide_exact(a, a == 0 ? Integer(1) : a), a == 0 ? Integer(0) : Integer(1));
+      // Expression template arguments:
+      BOOST_CHECK_EQUAL(divide_exact(q * b, b), q);
+      BOOST_CHECK_EQUAL(divide_exact(a, b * 1), q);
+      BOOST_CHECK_EQUAL(divide_exact(q * b, b * 1), q);
+      // Aliasing at the backend level:
+      using default_ops::eval_divide_exact;
+      Integer r(a);
+      eval_divide_exact(r.backend(), r.backend(), b.backend());
+      BOOST_CHECK_EQUAL(r, q);
+      r = b;
+      eval_divide_exact(r.backend(), a.backend(), r.backend());
+      BOOST_CHECK_EQUAL(r, q);
+   }
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(divide_exact(Integer(2), Integer(0)), std::overflow_error);
+#endif
+}
+
+int main()
+{
+   test<cpp_int>(2000, true);
+   test<cpp_int>(200, true);
+   test<int256_t>(250, true);
+   test<uint512_t>(500, false);
+   test<checked_int1024_t>(1000, true);
+   test<number<cpp_int_backend<64, 64, unsigned_magnitude, unchecked, void> > >(64, false);
+
+   BOOST_CHECK_EQUAL(divide_exact(600, 25), 24);
+   BOOST_CHECK_EQUAL(divide_exact(-600L, 25L), -24);
+   return boost::report_errors();
+}
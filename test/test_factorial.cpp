@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks factorial, binomial and primorial against the naive loops.
+//
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/integer.hpp>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+bool is_prime(unsigned n)
+{
+   if (n < 2)
+      return false;
+   for (unsigned d = 2; d * d <= n; ++d)
+      if (n % d == 0)
+         return false;
+   return true;
+}
+
+template <class Integer>
+void test()
+{
+   Integer f = 1;
+   for (unsigned n = 0; n < 1200; ++n)
+   {
+      if (n)
+         f *= n;
+      BOOST_CHECK_EQUAL(factorial<Integer>(n), f);
+   }
+   // Pascal's triangle:
+   std::vector<Integer> row(1, Integer(1));
+   for (unsigned n = 0; n < 300; ++n)
+   {
+      for (unsigned k = 0; k <= n; ++k)
+         BOOST_CHECK_EQUAL(binomial<Integer>(n, k), row[k]);
+      BOOST_CHECK_EQUAL(binomial<Integer>(n, n + 1), 0);
+      std::vector<Integer> next(row.size() + 1, Integer(1));
+      for (std::size_t k = 1; k < row.size(); ++k)
+         next[k] = row[k - 1] + row[k];
+      row.swap(next);
+   }
+   Integer p = 1;
+   for (unsigned n = 0; n < 3000; ++n)
+   {
+      if (is_prime(n))
+         p *= n;
+      BOOST_CHECK_EQUAL(primorial<Integer>(n), p);
+   }
+}
+
+int main()
+{
+   test<cpp_int>();
+   test<uint1024_t>();
+   test<int512_t>();
+   //
+   // Larger values against the identities n! = n * (n-1)! and C(n, k) = n! / (k!(n-k)!):
+   //
+   for (unsigned n = 10000; n < 200000; n = n * 3 + 1)
+   {
+      cpp_int f = factorial<cpp_int>(n - 1);
+      BOOST_CHECK_EQUAL(factorial<cpp_int>(n), f * n);
+      for (unsigned k = 1; k < n; k = k * 5 + 3)
+         BOOST_CHECK_EQUAL(binomial<cpp_int>(n, k), f * n / (factorial<cpp_int>(k) * factorial<cpp_int>(n - k)));
+   }
+   cpp_int p = 1;
+   for (unsigned n = 0; n <= 100000; ++n)
+      if (is_prime(n))
+         p *= n;
+   BOOST_CHECK_EQUAL(primorial<cpp_int>(100000), p);
+   BOOST_CHECK_EQUAL(primorial<cpp_int>(100002), p);
+   BOOST_CHECK_EQUAL(primorial<cpp_int>(100003), p * 100003);
+   return boost::report_errors();
+}
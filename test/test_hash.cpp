@@ -34,9 +34,11 @@
 #include <boost/functional/hash.hpp>
 
 #include "test.hpp"
+#include <algorithm>
 #include <functional> // std::hash
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 template <class T>
 void test()
@@ -54,8 +56,92 @@ void test()
    BOOST_CHECK_EQUAL(t3, t2);
 }
 
+//
+// Equal values must hash the same however they were arrived at, and whatever their type:
+//
+void test_consistency()
+{
+   using namespace boost::multiprecision;
+   cpp_int a = (cpp_int(1) << 300) + 12345;
+   cpp_int b = a * a * 7;
+   b /= a * 7;
+   BOOST_CHECK_EQUAL(a, b);
+   BOOST_CHECK_EQUAL(std::hash<cpp_int>()(a), std::hash<cpp_int>()(b));
+   cpp_int z = a;
+   z -= b;
+   BOOST_CHECK_EQUAL(std::hash<cpp_int>()(z), std::hash<cpp_int>()(cpp_int(0)));
+   z = -z;
+   BOOST_CHECK_EQUAL(std::hash<cpp_int>()(z), std::hash<cpp_int>()(cpp_int(0)));
+   BOOST_CHECK_NE(std::hash<cpp_int>()(a), std::hash<cpp_int>()(cpp_int(-a)));
+
+   const cpp_int small = (cpp_int(0x12345678u) << 64) + 0x9abcdef0u;
+   BOOST_CHECK_EQUAL(std::hash<uint128_t>()(uint128_t(small)), std::hash<cpp_int>()(small));
+   BOOST_CHECK_EQUAL(std::hash<int128_t>()(-int128_t(small)), std::hash<cpp_int>()(cpp_int(-small)));
+   BOOST_CHECK_EQUAL(std::hash<uint256_t>()(uint256_t(small)), std::hash<cpp_int>()(small));
+   BOOST_CHECK_EQUAL(std::hash<uint128_t>()(uint128_t(7)), std::hash<cpp_int>()(cpp_int(7)));
+   using uint32_type = number<cpp_int_backend<32, 32, unsigned_magnitude, unchecked, void> >;
+   BOOST_CHECK_EQUAL(std::hash<uint32_type>()(7u), std::hash<cpp_int>()(cpp_int(7)));
+
+   cpp_bin_float_50 x = cpp_bin_float_50(1) / 3;
+   cpp_bin_float_50 y = cpp_bin_float_50(2) / 6;
+   BOOST_CHECK_EQUAL(x, y);
+   BOOST_CHECK_EQUAL(std::hash<cpp_bin_float_50>()(x), std::hash<cpp_bin_float_50>()(y));
+   BOOST_CHECK_EQUAL(std::hash<cpp_bin_float_50>()(cpp_bin_float_50(0)), std::hash<cpp_bin_float_50>()(-cpp_bin_float_50(0)));
+   BOOST_CHECK_NE(std::hash<cpp_bin_float_50>()(x), std::hash<cpp_bin_float_50>()(-x));
+   BOOST_CHECK_NE(std::hash<cpp_bin_float_50>()(x), std::hash<cpp_bin_float_50>()(x * 2));
+   BOOST_CHECK_NE(std::hash<cpp_bin_float_50>()(std::numeric_limits<cpp_bin_float_50>::infinity()), std::hash<cpp_bin_float_50>()(-std::numeric_limits<cpp_bin_float_50>::infinity()));
+
+   cpp_dec_float_50 u = cpp_dec_float_50(1) / 3;
+   cpp_dec_float_50 v = cpp_dec_float_50(2) / 6;
+   BOOST_CHECK_EQUAL(u, v);
+   BOOST_CHECK_EQUAL(std::hash<cpp_dec_float_50>()(u), std::hash<cpp_dec_float_50>()(v));
+   BOOST_CHECK_EQUAL(std::hash<cpp_dec_float_50>()(cpp_dec_float_50(0)), std::hash<cpp_dec_float_50>()(-cpp_dec_float_50(0)));
+   BOOST_CHECK_NE(std::hash<cpp_dec_float_50>()(u), std::hash<cpp_dec_float_50>()(-u));
+   BOOST_CHECK_NE(std::hash<cpp_dec_float_50>()(u), std::hash<cpp_dec_float_50>()(u * 10));
+
+   cpp_rational r(cpp_int(6), cpp_int(-4));
+   BOOST_CHECK_EQUAL(std::hash<cpp_rational>()(r), std::hash<cpp_rational>()(cpp_rational(-3, 2)));
+   BOOST_CHECK_NE(std::hash<cpp_rational>()(r), std::hash<cpp_rational>()(cpp_rational(3, 2)));
+   BOOST_CHECK_NE(std::hash<cpp_rational>()(r), std::hash<cpp_rational>()(cpp_rational(-2, 3)));
+
+   static_assert(std::is_same<std::hash<cpp_int>::is_avalanching, std::true_type>::value, "cpp_int hashes are avalanching");
+   static_assert(std::is_same<std::hash<cpp_bin_float_50>::is_avalanching, std::true_type>::value, "cpp_bin_float hashes are avalanching");
+   static_assert(std::is_same<std::hash<cpp_dec_float_50>::is_avalanching, std::true_type>::value, "cpp_dec_float hashes are avalanching");
+   static_assert(std::is_same<std::hash<cpp_rational>::is_avalanching, std::true_type>::value, "rational hashes are avalanching");
+}
+
+//
+// Keys which differ only in a few bits of one limb should spread evenly over both the low
+// and the high bits of the hash:
+//
+template <class T>
+void test_distribution(const T& scale)
+{
+   std::vector<unsigned> low(1024), high(1024);
+   for (unsigned i = 0; i < 65536; ++i)
+   {
+      T                 key = T(i) * scale;
+      const std::size_t h   = std::hash<T>()(key);
+      ++low[h & 1023];
+      ++high[h >> (sizeof(std::size_t) * CHAR_BIT - 10)];
+   }
+   // 64 per bucket on average:
+   BOOST_CHECK_LT(*std::max_element(low.begin(), low.end()), 120u);
+   BOOST_CHECK_LT(*std::max_element(high.begin(), high.end()), 120u);
+   BOOST_CHECK_GT(*std::min_element(low.begin(), low.end()), 20u);
+   BOOST_CHECK_GT(*std::min_element(high.begin(), high.end()), 20u);
+}
+
 int main()
 {
+   test_consistency();
+   test_distribution(boost::multiprecision::uint256_t(1));
+   test_distribution(boost::multiprecision::uint256_t(1) << 128);
+   test_distribution(boost::multiprecision::uint256_t(1) << 200);
+   test_distribution(boost::multiprecision::cpp_int(1) << 1000);
+   test_distribution(boost::multiprecision::cpp_bin_float_50(1));
+   test_distribution(boost::multiprecision::cpp_dec_float_50(1) / 7);
+
    test<boost::multiprecision::cpp_int>();
    test<boost::multiprecision::checked_int1024_t>();
    //test<boost::multiprecision::checked_uint512_t >();
@@ -0,0 +1,256 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks inverse_mod, jacobi, kronecker and Garner's crt.
+//
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/integer.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+//
+// Reference Jacobi symbol from Euler's criterion for prime p, and multiplicativity
+// in the denominator:
+//
+int euler_symbol(long long a, long long p)
+{
+   a %= p;
+   if (a < 0)
+      a += p;
+   if (a == 0)
+      return 0;
+   long long r = 1, b = a, e = (p - 1) / 2;
+   for (; e; e >>= 1)
+   {
+      if (e & 1)
+         r = r * b % p;
+      b = b * b % p;
+   }
+   return r == 1 ? 1 : -1;
+}
+
+int reference_kronecker(long long a, long long n)
+{
+   if (n == 0)
+      return (a == 1) || (a == -1) ? 1 : 0;
+   int result = 1;
+   if (n < 0)
+   {
+      n = -n;
+      if (a < 0)
+         result = -result;
+   }
+   for (long long p = 2; n > 1; ++p)
+   {
+      while (n % p == 0)
+      {
+         n /= p;
+         if (p == 2)
+         {
+            long long a8 = ((a % 8) + 8) % 8;
+            result *= (a8 % 2 == 0) ? 0 : (a8 == 1 || a8 == 7) ? 1 : -1;
+         }
+         else
+            result *= euler_symbol(a, p);
+      }
+   }
+   return result;
+}
+
+template <class Integer>
+void test_inverse(unsigned max_bits)
+{
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      Integer m = generate_random<Integer>(32 + generator()() % max_bits);
+      if (i % 3 == 0)
+         m |= 1u;
+      if (m < 2)
+         m = 2;
+      Integer a = generate_random<Integer>(32 + generator()() % max_bits);
+      Integer r = inverse_mod(a, m);
+      BOOST_CHECK(r < m);
+      if (gcd(a, m) == 1)
+      {
+         // Avoid overflow of fixed precision types:
+         BOOST_CHECK_EQUAL(cpp_int(cpp_int(a) % cpp_int(m) * cpp_int(r) % cpp_int(m)), 1);
+      }
+      else
+         BOOST_CHECK_EQUAL(r, 0);
+      BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+      {
+         Integer rn = inverse_mod(Integer(Integer(0) - a), m);
+         if (gcd(a, m) == 1)
+            BOOST_CHECK_EQUAL(Integer((rn + r) % m), 0);
+      }
+   }
+   BOOST_CHECK_EQUAL(inverse_mod(Integer(3), Integer(7)), 5);
+   BOOST_CHECK_EQUAL(inverse_mod(Integer(0), Integer(1)), 0);
+   BOOST_CHECK_EQUAL(inverse_mod(Integer(5), Integer(1)), 0);
+   BOOST_CHECK_EQUAL(inverse_mod(Integer(6), Integer(9)), 0);
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(inverse_mod(Integer(3), Integer(0)), std::domain_error);
+#endif
+}
+
+//
+// Moduli which use every bit of fixed precision types, where the cofactor updates are
+// wider than the type itself:
+//
+template <class Integer>
+void test_inverse_full_width()
+{
+   const cpp_int max_value = cpp_int((std::numeric_limits<Integer>::max)());
+   const unsigned bits     = msb(max_value) + 1;
+   for (unsigned i = 0; i < 300; ++i)
+   {
+      cpp_int m = max_value - (i < 10 ? cpp_int(i) : cpp_int(generate_random<cpp_int>(bits) % (max_value >> (i % bits))));
+      if (i % 2)
+         m |= 1u;
+      cpp_int a = generate_random<cpp_int>(bits) % m;
+      if (i == 0)
+         a = m - 1;
+      const Integer r = inverse_mod(Integer(a), Integer(m));
+      BOOST_CHECK(r < Integer(m));
+      if (gcd(a, m) == 1)
+      {
+         BOOST_CHECK_EQUAL(cpp_int(a * cpp_int(r) % m), 1);
+      }
+      else
+         BOOST_CHECK_EQUAL(r, 0);
+   }
+}
+
+template <class Integer>
+void test_symbols()
+{
+   for (long long n = -60; n < 200; ++n)
+   {
+      for (long long a = -70; a < 300; ++a)
+      {
+         BOOST_IF_CONSTEXPR(!std::numeric_limits<Integer>::is_signed)
+         {
+            if ((a < 0) || (n < 0))
+               continue;
+         }
+         const int expected = reference_kronecker(a, n);
+         BOOST_CHECK_EQUAL(kronecker(Integer(a), Integer(n)), expected);
+         if ((n > 0) && (n & 1))
+            BOOST_CHECK_EQUAL(jacobi(Integer(a), Integer(n)), expected);
+      }
+   }
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(jacobi(Integer(3), Integer(8)), std::domain_error);
+   BOOST_CHECK_THROW(jacobi(Integer(3), Integer(0)), std::domain_error);
+#endif
+}
+
+template <class Integer>
+void test_large_symbols(unsigned max_bits)
+{
+   // Multiplicativity in both arguments, checked against small values:
+   for (unsigned i = 0; i < 300; ++i)
+   {
+      Integer  a = generate_random<Integer>(32 + generator()() % max_bits);
+      Integer  n = generate_random<Integer>(32 + generator()() % max_bits) | 1u;
+      unsigned p = generator()() % 1000 * 2 + 3;
+      int      j = jacobi(a, n);
+      BOOST_CHECK_EQUAL(j, gcd(a, n) == 1 ? j : 0);
+      BOOST_CHECK((j == 0) == (gcd(a, n) != 1));
+      BOOST_CHECK_EQUAL(jacobi(Integer(a * p), n), j * jacobi(Integer(p), n));
+      BOOST_CHECK_EQUAL(jacobi(Integer(a + n), n), j);
+      BOOST_CHECK_EQUAL(kronecker(a, n), j);
+      BOOST_CHECK_EQUAL(kronecker(a, Integer(n * 2)), j * kronecker(a, Integer(2)));
+      // Reciprocity for odd coprime a and n:
+      Integer b = a | 1u;
+      if (gcd(b, n) == 1)
+      {
+         int sign = (bit_test(b, 1) && bit_test(n, 1)) ? -1 : 1;
+         BOOST_CHECK_EQUAL(jacobi(b, n), sign * jacobi(n, b));
+      }
+   }
+}
+
+template <class Integer>
+void test_crt()
+{
+   for (unsigned n = 1; n < 12; ++n)
+   {
+      std::vector<Integer> m, r;
+      cpp_int              M = 1;
+      for (unsigned i = 0; i < n; ++i)
+      {
+         Integer c = generate_random<Integer>(32) | 1u;
+         while (gcd(cpp_int(c), M) != 1)
+            c += 2;
+         m.push_back(c);
+         M *= cpp_int(c);
+      }
+      Integer x = static_cast<Integer>(generate_random<cpp_int>(32 * n + 32) % M);
+      for (unsigned i = 0; i < n; ++i)
+         r.push_back(x % m[i]);
+      BOOST_CHECK_EQUAL(crt(r.data(), m.data(), n), x);
+      BOOST_CHECK_EQUAL(crt(r, m), x);
+   }
+   // One modulus much larger than the others, the intermediate products must not overflow:
+   Integer big = std::numeric_limits<Integer>::is_bounded ? Integer((std::numeric_limits<Integer>::max)() / 8 - 1) : Integer(Integer(1) << 2000) - 1;
+   Integer m[2] = {big, Integer(3)}, r[2] = {Integer(big - 5), Integer(2)};
+   if (gcd(big, Integer(3)) == 1)
+   {
+      Integer x = crt(r, m, 2);
+      BOOST_CHECK_EQUAL(x % big, big - 5);
+      BOOST_CHECK_EQUAL(x % 3, 2);
+   }
+   BOOST_CHECK_EQUAL(crt(r, m, 0), 0);
+#ifndef BOOST_NO_EXCEPTIONS
+   Integer m2[2] = {Integer(6), Integer(9)};
+   BOOST_CHECK_THROW(crt(r, m2, 2), std::domain_error);
+#endif
+}
+
+int main()
+{
+   test_inverse<cpp_int>(2000);
+   test_inverse<uint256_t>(200);
+   test_inverse<int512_t>(400);
+   test_inverse<uint1024_t>(900);
+   test_inverse_full_width<checked_uint256_t>();
+   test_inverse_full_width<checked_int256_t>();
+   test_inverse_full_width<uint256_t>();
+   test_inverse_full_width<int512_t>();
+   test_inverse_full_width<checked_uint1024_t>();
+   test_inverse_full_width<number<cpp_int_backend<64, 64, unsigned_magnitude, checked, void> > >();
+   test_inverse_full_width<number<cpp_int_backend<100, 100, signed_magnitude, checked, void> > >();
+   test_symbols<cpp_int>();
+   test_symbols<uint256_t>();
+   test_symbols<long long>();
+   test_symbols<unsigned>();
+   test_large_symbols<cpp_int>(2000);
+   test_large_symbols<uint512_t>(200);
+   test_crt<uint512_t>();
+   test_crt<int1024_t>();
+   test_crt<cpp_int>();
+   // Fundamental types:
+   for (long long m = 1; m < 300; ++m)
+   {
+      for (long long a = -300; a < 300; ++a)
+      {
+         long long r = inverse_mod(a, m);
+         long long g = m, t = a < 0 ? -a : a;
+         while (t)
+         {
+            long long u = g % t;
+            g           = t;
+            t           = u;
+         }
+         BOOST_CHECK_EQUAL(g == 1 ? ((a % m + m) * r) % m : r, g == 1 && m != 1 ? 1 : 0);
+      }
+   }
+   BOOST_CHECK_EQUAL(inverse_mod(3u, 7u), 5u);
+   return boost::report_errors();
+}
@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks nth_root, is_square and is_perfect_power.
+//
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/integer.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+void test_nth_root(unsigned max_bits)
+{
+   for (unsigned i = 0; i < 400; ++i)
+   {
+      Integer  x = generate_random<Integer>(32 + generator()() % max_bits);
+      unsigned k = 1 + generator()() % (i % 2 ? 7 : 70);
+      Integer  r = nth_root(x, k);
+      BOOST_CHECK(Integer(pow(r, k)) <= x);
+      BOOST_CHECK(cpp_int(pow(cpp_int(r) + 1, k)) > cpp_int(x));
+      // Exact powers and their neighbours:
+      Integer y = generate_random<Integer>(32 + generator()() % (max_bits / k + 1));
+      if (!y)
+         y = 3;
+      Integer p = pow(y, k);
+      if (cpp_int(pow(cpp_int(y), k)) != cpp_int(p))
+         continue; // overflowed a fixed width type
+      BOOST_CHECK_EQUAL(nth_root(p, k), y);
+      BOOST_CHECK_EQUAL(nth_root(Integer(p - 1), k), k == 1 ? Integer(p - 1) : Integer(y - 1));
+      BOOST_CHECK_EQUAL(nth_root(Integer(p + 1), k), k == 1 ? Integer(p + 1) : y);
+      BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+      {
+         if (k & 1)
+            BOOST_CHECK_EQUAL(nth_root(Integer(Integer(0) - p), k), Integer(Integer(0) - y));
+      }
+   }
+   for (unsigned k = 1; k < 100; ++k)
+   {
+      BOOST_CHECK_EQUAL(nth_root(Integer(0), k), 0);
+      BOOST_CHECK_EQUAL(nth_root(Integer(1), k), 1);
+      BOOST_CHECK_EQUAL(nth_root(Integer(2), k), k == 1 ? 2 : 1);
+   }
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(nth_root(Integer(2), 0), std::domain_error);
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+   {
+      BOOST_CHECK_THROW(nth_root(Integer(-2), 2), std::domain_error);
+   }
+#endif
+}
+
+template <class Integer>
+void test_is_square(unsigned max_bits)
+{
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      Integer x = generate_random<Integer>(32 + generator()() % max_bits);
+      BOOST_CHECK_EQUAL(is_square(x), boost::multiprecision::sqrt(x) * boost::multiprecision::sqrt(x) == x);
+      // s has at most max_bits / 2 bits, so s * s does not overflow:
+      Integer s = generate_random<Integer>(max_bits / 2) >> ((32 - (max_bits / 2) % 32) % 32);
+      s >>= generator()() % (max_bits / 2);
+      BOOST_CHECK(is_square(Integer(s * s)));
+      BOOST_CHECK(!is_square(Integer(s * s + 1)) || (s == 0));
+      BOOST_CHECK(!is_square(Integer(s * s - 1)) || (s <= 1));
+   }
+   for (unsigned i = 0; i < 10000; ++i)
+      BOOST_CHECK_EQUAL(is_square(Integer(i)), boost::multiprecision::sqrt(Integer(i)) * boost::multiprecision::sqrt(Integer(i)) == i);
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+   {
+      BOOST_CHECK(!is_square(Integer(-4)));
+   }
+}
+
+template <class Integer>
+void test_is_perfect_power()
+{
+   Integer  root;
+   unsigned k;
+   // Compare with a brute force search over small values:
+   for (unsigned i = 0; i < 5000; ++i)
+   {
+      unsigned best = 1;
+      for (unsigned b = 2; b * b <= i; ++b)
+      {
+         unsigned e = 0, p = 1;
+         while (p < i)
+         {
+            p *= b;
+            ++e;
+         }
+         if (p == i)
+         {
+            best = e;
+            break;
+         }
+      }
+      bool result = is_perfect_power(Integer(i), root, k);
+      if (i < 2)
+      {
+         BOOST_CHECK(result);
+         BOOST_CHECK_EQUAL(root, i);
+         continue;
+      }
+      BOOST_CHECK_EQUAL(result, best > 1);
+      if (result)
+      {
+         BOOST_CHECK_EQUAL(k, best);
+         BOOST_CHECK_EQUAL(Integer(pow(root, k)), i);
+      }
+      BOOST_CHECK_EQUAL(is_perfect_power(Integer(i)), best > 1);
+   }
+   // Large powers, including composite exponents:
+   for (unsigned i = 0; i < 100; ++i)
+   {
+      Integer  b = generate_random<Integer>(32 + generator()() % 64) | 1u;
+      unsigned e = 2 + generator()() % 30;
+      Integer  x = pow(b, e);
+      BOOST_CHECK(is_perfect_power(x, root, k));
+      BOOST_CHECK_EQUAL(k % e, 0);
+      BOOST_CHECK_EQUAL(Integer(pow(root, k)), x);
+      BOOST_CHECK(!is_perfect_power(Integer(x + 2)) || (x + 2 == pow(nth_root(Integer(x + 2), 2), 2)));
+      BOOST_CHECK(is_perfect_power(Integer(x << (2 * e)), root, k));
+      BOOST_CHECK_EQUAL(k % e, 0);
+   }
+   BOOST_CHECK(is_perfect_power(Integer(Integer(1) << 1024), root, k));
+   BOOST_CHECK_EQUAL(k, 1024);
+   BOOST_CHECK_EQUAL(root, 2);
+   BOOST_CHECK(!is_perfect_power(Integer(Integer(1) << 1021) * 3));
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+   {
+      BOOST_CHECK(is_perfect_power(Integer(-64), root, k));
+      BOOST_CHECK_EQUAL(root, -4);
+      BOOST_CHECK_EQUAL(k, 3);
+      BOOST_CHECK(!is_perfect_power(Integer(-4)));
+      BOOST_CHECK(is_perfect_power(Integer(-1), root, k));
+      BOOST_CHECK_EQUAL(root, -1);
+   }
+}
+
+//
+// Roots of values at the top of a fixed width type, where a power of the root (or of the root
+// plus one) does not fit in the type:
+//
+template <class Integer>
+void test_near_maximum()
+{
+   const unsigned exponents[] = {2, 3, 5, 7, 8, 64, 255};
+   for (unsigned j = 0; j < 3; ++j)
+   {
+      const Integer x = ~Integer(0) - j;
+      for (unsigned k : exponents)
+      {
+         const Integer r = nth_root(x, k);
+         BOOST_CHECK(cpp_int(pow(cpp_int(r), k)) <= cpp_int(x));
+         BOOST_CHECK(cpp_int(pow(cpp_int(r) + 1, k)) > cpp_int(x));
+      }
+      BOOST_CHECK(!is_perfect_power(x));
+      BOOST_CHECK_EQUAL(is_square(x), false);
+   }
+   // The largest k'th powers which fit:
+   for (unsigned k : exponents)
+   {
+      const Integer r = nth_root(~Integer(0), k);
+      const Integer x = static_cast<Integer>(pow(cpp_int(r), k));
+      BOOST_CHECK_EQUAL(nth_root(x, k), r);
+      BOOST_CHECK(is_perfect_power(x));
+   }
+}
+
+int main()
+{
+   test_nth_root<cpp_int>(3000);
+   test_nth_root<uint1024_t>(1000);
+   test_nth_root<int512_t>(500);
+   test_is_square<cpp_int>(3000);
+   test_is_square<uint512_t>(500);
+   test_is_square<unsigned long long>(60);
+   for (int i = -100; i < 100000; ++i)
+      BOOST_CHECK_EQUAL(is_square(i), (i >= 0) && (boost::multiprecision::sqrt(i) * boost::multiprecision::sqrt(i) == i));
+   test_is_perfect_power<cpp_int>();
+   test_near_maximum<uint256_t>();
+   test_near_maximum<uint512_t>();
+   test_near_maximum<checked_uint256_t>();
+   return boost::report_errors();
+}
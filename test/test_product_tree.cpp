@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks prod, remainder_tree, batch_gcd and crt against the naive loops.
+//
+#include <list>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Integer>
+void test_prod()
+{
+   for (std::size_t n = 0; n < 70; n += 1 + n / 8)
+   {
+      std::vector<Integer> v;
+      Integer              expected = 1;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         v.push_back(generate_random<Integer>(32 + 32 * (generator()() % 20)));
+         expected *= v.back();
+      }
+      BOOST_CHECK_EQUAL(prod(v.begin(), v.end()), expected);
+      BOOST_CHECK_EQUAL(prod(v.begin(), v.end(), 4), expected);
+      std::list<Integer> l(v.begin(), v.end());
+      BOOST_CHECK_EQUAL(prod(l.begin(), l.end()), expected);
+   }
+   // 1000!:
+   std::vector<Integer> v;
+   Integer              f = 1;
+   for (unsigned i = 1; i <= 1000; ++i)
+   {
+      v.push_back(Integer(i));
+      f *= i;
+   }
+   BOOST_CHECK_EQUAL(prod(v.begin(), v.end(), 3), f);
+   v.push_back(Integer(0));
+   BOOST_CHECK_EQUAL(prod(v.begin(), v.end()), 0);
+}
+
+template <class Integer>
+void test_remainders()
+{
+   for (std::size_t n = 0; n < 100; n += 1 + n / 4)
+   {
+      Integer              x = generate_random<Integer>(32 * (1 + generator()() % 200));
+      std::vector<Integer> m;
+      for (std::size_t i = 0; i < n; ++i)
+         m.push_back(generate_random<Integer>(32 + 32 * (generator()() % 5)) + 1);
+      if (n > 3)
+         m[2] = 1;
+      for (std::size_t threads = 1; threads <= 3; threads += 2)
+      {
+         std::vector<Integer> r = remainder_tree(x, m, threads);
+         BOOST_CHECK_EQUAL(r.size(), n);
+         for (std::size_t i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], Integer(x % m[i]));
+         BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed)
+         {
+            r = remainder_tree(Integer(-x), m, threads);
+            for (std::size_t i = 0; i < n; ++i)
+               BOOST_CHECK_EQUAL(r[i], Integer((m[i] - x % m[i]) % m[i]));
+         }
+      }
+   }
+}
+
+template <class Integer>
+void test_batch_gcd()
+{
+   // Products of pairs of primes, some of which share a prime:
+   const unsigned primes[] = {1000003u, 1000033u, 1000037u, 1000039u, 1000081u, 1000099u, 1000117u, 1000121u, 1000133u, 1000151u, 1000159u, 1000171u};
+   std::vector<Integer> x;
+   for (unsigned i = 0; i + 1 < sizeof(primes) / sizeof(primes[0]); i += 2)
+      x.push_back(Integer(primes[i]) * primes[i + 1]);
+   x.push_back(Integer(primes[0]) * primes[3]);
+   x.push_back(Integer(primes[5]) * 1000187u);
+   x.push_back(Integer(1000193u) * 1000199u);
+   for (std::size_t threads = 1; threads <= 3; threads += 2)
+   {
+      std::vector<Integer> g = batch_gcd(x, threads);
+      BOOST_CHECK_EQUAL(g.size(), x.size());
+      for (std::size_t i = 0; i < x.size(); ++i)
+      {
+         Integer p = 1;
+         for (std::size_t j = 0; j < x.size(); ++j)
+            if (j != i)
+               p *= x[j];
+         BOOST_CHECK_EQUAL(g[i], Integer(gcd(p, x[i])));
+      }
+   }
+   BOOST_CHECK_EQUAL(batch_gcd(x)[0], primes[0]);
+   BOOST_CHECK_EQUAL(batch_gcd(x)[2], primes[5]);
+   BOOST_CHECK_EQUAL(batch_gcd(x)[x.size() - 1], 1);
+}
+
+template <class Integer>
+void test_crt()
+{
+   for (std::size_t n = 1; n < 60; n += 1 + n / 4)
+   {
+      // Distinct primes are pairwise coprime, mix in some larger coprime values too:
+      std::vector<Integer> m, r;
+      Integer              M = 1;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         Integer c = generate_random<Integer>(32 + 32 * (generator()() % 3)) | 1;
+         while (gcd(c, M) != 1)
+            ++c;
+         m.push_back(c);
+         M *= c;
+      }
+      Integer x = generate_random<Integer>(static_cast<unsigned>(msb(M) + 1)) % M;
+      for (std::size_t i = 0; i < n; ++i)
+         r.push_back(x % m[i] + (i % 3 == 1 ? m[i] * 3 : Integer(0)));
+      BOOST_CHECK_EQUAL(crt(r, m), x);
+      BOOST_CHECK_EQUAL(crt(r, m, 3), x);
+   }
+   std::vector<Integer> m = {Integer(3), Integer(5), Integer(7)}, r = {Integer(2), Integer(3), Integer(2)};
+   BOOST_CHECK_EQUAL(crt(r, m), 23);
+   m.push_back(Integer(1));
+   r.push_back(Integer(0));
+   BOOST_CHECK_EQUAL(crt(r, m), 23);
+#ifndef BOOST_NO_EXCEPTIONS
+   m.push_back(Integer(9));
+   r.push_back(Integer(2));
+   BOOST_CHECK_THROW(crt(r, m), std::domain_error);
+   r.pop_back();
+   BOOST_CHECK_THROW(crt(r, m), std::domain_error);
+#endif
+}
+
+int main()
+{
+   test_prod<cpp_int>();
+   test_prod<uint1024_t>();
+   test_remainders<cpp_int>();
+   test_batch_gcd<cpp_int>();
+   test_crt<cpp_int>();
+   return boost::report_errors();
+}
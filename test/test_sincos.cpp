@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the fused eval_sincos and eval_sinhcosh against the separate functions.
+//
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_complex.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class T>
+void check_close(const T& a, const T& b, unsigned ulps)
+{
+   T scale = b == 0 ? T(1) : T(abs(b));
+   BOOST_CHECK_LE(T(abs(a - b)), scale * std::numeric_limits<T>::epsilon() * ulps);
+}
+
+template <class T>
+void test()
+{
+   using default_ops::eval_sincos;
+   using default_ops::eval_sinhcosh;
+
+   T half_pi = boost::math::constants::half_pi<T>();
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      T x = T(static_cast<std::int64_t>(generator()()) - 0x7FFFFFFF) / (generator()() | 1u);
+      switch (i % 4)
+      {
+      case 1:
+         // Close to a multiple of pi/2:
+         x = half_pi * static_cast<int>(generator()() % 200 - 100) + ldexp(x, -60);
+         break;
+      case 2:
+         x = ldexp(x, static_cast<int>(generator()() % 40));
+         break;
+      case 3:
+         x = ldexp(x, -static_cast<int>(generator()() % 40));
+         break;
+      default:;
+      }
+      T s, c;
+      eval_sincos(s.backend(), c.backend(), x.backend());
+      check_close(s, T(sin(x)), 10);
+      check_close(c, T(cos(x)), 10);
+
+      T y = x / 1000;
+      eval_sinhcosh(s.backend(), c.backend(), y.backend());
+      BOOST_CHECK_EQUAL(s, T(sinh(y)));
+      BOOST_CHECK_EQUAL(c, T(cosh(y)));
+   }
+   // Special values and aliasing:
+   T s, c, x(0);
+   eval_sincos(s.backend(), c.backend(), x.backend());
+   BOOST_CHECK_EQUAL(s, 0);
+   BOOST_CHECK_EQUAL(c, 1);
+   x = half_pi;
+   eval_sincos(x.backend(), c.backend(), x.backend());
+   check_close(x, T(1), 2);
+   check_close(c, T(0), 2);
+   x = 2;
+   eval_sinhcosh(s.backend(), x.backend(), x.backend());
+   BOOST_CHECK_EQUAL(s, T(sinh(T(2))));
+   BOOST_CHECK_EQUAL(x, T(cosh(T(2))));
+   BOOST_IF_CONSTEXPR(std::numeric_limits<T>::has_quiet_NaN)
+   {
+      x = std::numeric_limits<T>::infinity();
+      eval_sincos(s.backend(), c.backend(), x.backend());
+      BOOST_CHECK((boost::multiprecision::isnan)(s));
+      BOOST_CHECK((boost::multiprecision::isnan)(c));
+   }
+}
+
+template <class Complex>
+void test_complex()
+{
+   using real_type = typename Complex::value_type;
+   //
+   // Small integer powers are evaluated by repeated multiplication:
+   //
+   Complex z(real_type(12) / 10, real_type(34) / 10);
+   Complex p(1);
+   for (int n = 1; n <= 70; ++n)
+   {
+      p *= z;
+      Complex r = pow(z, Complex(n));
+      BOOST_CHECK_LE(real_type(abs(r - p)), real_type(abs(p)) * std::numeric_limits<real_type>::epsilon() * 4 * n);
+      r = pow(z, Complex(-n));
+      Complex q(1);
+      q /= p;
+      BOOST_CHECK_LE(real_type(abs(r - q)), real_type(abs(q)) * std::numeric_limits<real_type>::epsilon() * 4 * n);
+   }
+   BOOST_CHECK_EQUAL(pow(Complex(-2), Complex(3)), Complex(-8));
+}
+
+int main()
+{
+   test<cpp_bin_float_50>();
+   test<cpp_bin_float_100>();
+   test<cpp_dec_float_50>();
+   test_complex<cpp_complex_50>();
+   test_complex<cpp_complex_100>();
+   return boost::report_errors();
+}
@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks powm and modular_context with special form moduli, against plain division.
+//
+#include <vector>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/batch.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+//
+// Between one word and one word more than bits bits:
+//
+cpp_int random_words(unsigned bits)
+{
+   return generate_random<cpp_int>(32 * (1 + generator()() % (bits / 32 + 1)));
+}
+
+cpp_int pow2(unsigned k)
+{
+   cpp_int r;
+   bit_set(r, k);
+   return r;
+}
+
+//
+// The plain square and multiply algorithm, with a remainder at each step:
+//
+cpp_int naive_powm(cpp_int b, cpp_int e, const cpp_int& m)
+{
+   cpp_int r = 1;
+   b %= m;
+   while (e != 0)
+   {
+      if (bit_test(e, 0))
+         r = r * b % m;
+      b = b * b % m;
+      e >>= 1;
+   }
+   return r % m;
+}
+
+template <class Integer>
+void test_modulus(const Integer& m, bool special)
+{
+   modular_context<Integer> ctx(m);
+   BOOST_CHECK_EQUAL(ctx.is_special_form(), special);
+   BOOST_CHECK_EQUAL(ctx.modulus(), m);
+   const unsigned bits = msb(m) + 1;
+   for (unsigned i = 0; i < 30; ++i)
+   {
+      cpp_int a = random_words(2 * bits), b = random_words(bits), e = random_words(bits / 2 + 64);
+      if (i == 0)
+         a = cpp_int(m) - 1;
+      else if (i == 1)
+         a = cpp_int(m);
+      else if (i == 2)
+         a = cpp_int(m) * cpp_int(m) - 1;
+      cpp_int ra = a % cpp_int(m);
+      BOOST_CHECK_EQUAL(cpp_int(ctx.reduce(static_cast<Integer>(ra))), ra);
+      BOOST_IF_CONSTEXPR(std::numeric_limits<Integer>::is_signed || !std::numeric_limits<Integer>::is_bounded)
+      {
+         BOOST_CHECK_EQUAL(cpp_int(ctx.reduce(Integer(Integer(0) - static_cast<Integer>(ra)))), ra.is_zero() ? ra : cpp_int(cpp_int(m) - ra));
+      }
+      cpp_int rb = b % cpp_int(m);
+      BOOST_CHECK_EQUAL(cpp_int(ctx.multiply(static_cast<Integer>(ra), static_cast<Integer>(rb))), cpp_int(ra * rb % cpp_int(m)));
+      BOOST_CHECK_EQUAL(cpp_int(ctx.square(static_cast<Integer>(ra))), cpp_int(ra * ra % cpp_int(m)));
+      cpp_int expected = naive_powm(ra, e, cpp_int(m));
+      BOOST_CHECK_EQUAL(cpp_int(ctx.powm(static_cast<Integer>(ra), static_cast<Integer>(e % cpp_int(m)))), naive_powm(ra, e % cpp_int(m), cpp_int(m)));
+      if (msb(e) < std::numeric_limits<Integer>::digits)
+      {
+         BOOST_CHECK_EQUAL(cpp_int(powm(static_cast<Integer>(ra), static_cast<Integer>(e), m)), expected);
+      }
+      unsigned small_e = generator()() % 1000;
+      BOOST_CHECK_EQUAL(cpp_int(powm(static_cast<Integer>(ra), small_e, m)), naive_powm(ra, small_e, cpp_int(m)));
+      BOOST_CHECK_EQUAL(cpp_int(powm(static_cast<Integer>(ra), 0u, m)), cpp_int(1 % cpp_int(m)));
+   }
+}
+
+void test_cpp_int()
+{
+   // Mersenne and pseudo-Mersenne moduli, both signs of c, and sparse and dense c:
+   test_modulus(cpp_int(pow2(127) - 1), true);
+   test_modulus(cpp_int(pow2(521) - 1), true);
+   test_modulus(cpp_int(pow2(255) - 19), true);
+   test_modulus(cpp_int(pow2(256) - pow2(32) - 977), true);
+   test_modulus(cpp_int(pow2(448) - pow2(224) - 1), true);
+   test_modulus(cpp_int(pow2(1000) - pow2(300) + 1), true);
+   test_modulus(cpp_int(pow2(512) + 1), true);
+   test_modulus(cpp_int(pow2(400) + 123456789), true);
+   test_modulus(cpp_int(pow2(300) + pow2(150) - 1), true);
+   test_modulus(cpp_int(pow2(300) + pow2(200) - 1), false);
+   test_modulus(cpp_int(pow2(320)), true);
+   // c at the limit of 2^(k/2), either side of a limb boundary:
+   test_modulus(cpp_int(pow2(256) - pow2(128)), true);
+   test_modulus(cpp_int(pow2(256) + pow2(128)), true);
+   test_modulus(cpp_int(pow2(257) - pow2(128) - 1), true);
+   test_modulus(cpp_int(pow2(257) + pow2(128) + 1), true);
+   test_modulus(cpp_int(pow2(255) + pow2(130)), false);
+   test_modulus(cpp_int(pow2(200) - 1 - cpp_int("0x123456789abcdef0123456789")), true);
+   // c reaching into the second limb from the top, as for P-192:
+   test_modulus(cpp_int(pow2(192) - pow2(64) - 1), true);
+   test_modulus(cpp_int(pow2(160) - pow2(70) - 1), true);
+   test_modulus(cpp_int(pow2(160) + pow2(70) + 1), true);
+   // Not special:
+   test_modulus(cpp_int(pow2(256) - pow2(224) + pow2(192) + pow2(96) - 1), false);
+   test_modulus(cpp_int(random_words(256) | 1), false);
+   test_modulus(cpp_int(pow2(61) - 1), false);
+   test_modulus(cpp_int(1), false);
+   test_modulus(cpp_int(3), false);
+}
+
+void test_fixed()
+{
+   test_modulus(uint256_t(pow2(255) - 19), true);
+   test_modulus(uint256_t(pow2(192) - pow2(64) - 1), true);
+   test_modulus(uint256_t((std::numeric_limits<uint256_t>::max)()), true);
+   test_modulus(int512_t(pow2(511) - 187), true);
+   test_modulus(checked_uint512_t(pow2(500) + 9), true);
+   test_modulus(checked_uint512_t(pow2(500) + pow2(499) + 9), false);
+}
+
+//
+// batch_mulmod uses the special form reduction for moduli of 8 limbs and more:
+//
+template <class Integer>
+void test_batch(const Integer& m)
+{
+   const std::size_t    n = 100;
+   std::vector<Integer> a(n), b(n), r(n);
+   const unsigned       bits = msb(m) + 1;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      a[i] = static_cast<Integer>(random_words(bits - 1));
+      b[i] = i % 10 ? static_cast<Integer>(random_words(bits - 1)) : a[i];
+   }
+   batch_mulmod(r.data(), a.data(), b.data(), m, n, 2);
+   for (std::size_t i = 0; i < n; ++i)
+      BOOST_CHECK_EQUAL(cpp_int(r[i]), cpp_int(cpp_int(a[i]) * cpp_int(b[i]) % cpp_int(m)));
+}
+
+//
+// Lucas-Lehmer: 2^p - 1 is prime iff s(p-2) = 0, with s(0) = 4 and s(i+1) = s(i)^2 - 2:
+//
+bool lucas_lehmer(unsigned p)
+{
+   cpp_int                   m = pow2(p) - 1;
+   modular_context<cpp_int> ctx(m);
+   BOOST_CHECK(ctx.is_special_form());
+   cpp_int s = 4;
+   for (unsigned i = 0; i < p - 2; ++i)
+      s = ctx.reduce(ctx.square(s) - 2);
+   return s.is_zero();
+}
+
+int main()
+{
+   test_cpp_int();
+   test_fixed();
+   test_batch(cpp_int(pow2(521) - 1));
+   test_batch(cpp_int(pow2(1024) - pow2(300) + 1));
+   test_batch(cpp_int(pow2(600) + 12345));
+   test_batch(uint1024_t(pow2(1023) - 1));
+   test_batch(int1024_t(pow2(1000) - 3));
+   BOOST_CHECK(lucas_lehmer(521));
+   BOOST_CHECK(lucas_lehmer(607));
+   BOOST_CHECK(lucas_lehmer(1279));
+   BOOST_CHECK(!lucas_lehmer(523));
+   BOOST_CHECK(!lucas_lehmer(1277));
+   BOOST_CHECK(lucas_lehmer(4423));
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(modular_context<cpp_int>(cpp_int(0)), std::domain_error);
+   BOOST_CHECK_THROW(modular_context<cpp_int>(cpp_int(-7)), std::domain_error);
+   BOOST_CHECK_THROW(modular_context<cpp_int>(cpp_int(7)).powm(cpp_int(2), cpp_int(-1)), std::runtime_error);
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the range and distribution of uniform_int_distribution for cpp_int's, and of
+// uniform_real_distribution for cpp_bin_float's and the generic fallback.
+//
+#include <random>
+#include <vector>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/detail/uniform_int_distribution.hpp>
+#include <boost/multiprecision/detail/uniform_real_distribution.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+//
+// An engine with a range which is not a power of 2, and one whose outputs are a
+// multiprecision type, which takes the generic path:
+//
+struct odd_range_engine
+{
+   using result_type = unsigned;
+   std::minstd_rand   gen;
+   static constexpr result_type(min)() { return 3; }
+   static constexpr result_type(max)() { return 1000002; }
+   result_type                  operator()()
+   {
+      for (;;)
+      {
+         result_type v = static_cast<result_type>(gen() % 1048576);
+         if (v < 1000000)
+            return v + 3;
+      }
+   }
+};
+
+struct cpp_int_engine
+{
+   using result_type = uint128_t;
+   std::mt19937_64 gen;
+   static result_type(min)() { return 0; }
+   static result_type(max)() { return (std::numeric_limits<uint128_t>::max)(); }
+   result_type        operator()()
+   {
+      result_type v = gen();
+      return (v << 64) | gen();
+   }
+};
+
+//
+// Draws n values from [min_value, max_value] into buckets by (v - min_value) * buckets / (range + 1),
+// and checks that they are all in range and that no bucket strays too far from n / buckets:
+//
+template <class Number, class Engine>
+void check_uniform(Engine& eng, const Number& min_value, const Number& max_value, unsigned buckets = 16, unsigned n = 16000)
+{
+   uniform_int_distribution<Number> dist(min_value, max_value);
+   std::vector<unsigned>            counts(buckets);
+   const cpp_int                    range = cpp_int(max_value) - cpp_int(min_value) + 1;
+   bool                             in_range = true;
+   for (unsigned i = 0; i < n; ++i)
+   {
+      Number v = dist(eng);
+      if ((v < min_value) || (v > max_value))
+         in_range = false;
+      else
+         ++counts[static_cast<unsigned>((cpp_int(v) - cpp_int(min_value)) * buckets / range)];
+   }
+   BOOST_CHECK(in_range);
+   const unsigned expected = n / buckets;
+   for (unsigned c : counts)
+   {
+      BOOST_CHECK_LE(c, expected + expected / 4);
+      BOOST_CHECK_GE(c, expected - expected / 4);
+   }
+}
+
+template <class Number, class Engine>
+void test_integer(Engine& eng)
+{
+   const Number max_value = (std::numeric_limits<Number>::max)();
+   const Number min_value = (std::numeric_limits<Number>::min)();
+   const Number zero(0);
+   check_uniform(eng, zero, Number(15));
+   check_uniform(eng, Number(1000), Number(1047));
+   check_uniform(eng, zero, max_value);
+   check_uniform(eng, Number(max_value - 1000), max_value);
+   check_uniform(eng, Number(max_value / 3), Number(max_value / 3 * 2));
+   //
+   // Top limbs of 1 and 2, the worst case for rejection, and a range of a single value:
+   //
+   const unsigned digits = std::numeric_limits<Number>::digits;
+   check_uniform(eng, zero, Number(Number(1) << (digits - 1)));
+   check_uniform(eng, zero, Number((Number(1) << (digits - 2)) * 3 - 1), 3, 3000);
+   check_uniform(eng, zero, Number(Number(2) << (digits - 3)), 4, 4000);
+   Number v = uniform_int_distribution<Number>(Number(42), Number(42))(eng);
+   BOOST_CHECK_EQUAL(v, 42);
+   BOOST_IF_CONSTEXPR(std::numeric_limits<Number>::is_signed)
+   {
+      check_uniform(eng, Number(-8), Number(7));
+      check_uniform(eng, Number(min_value / 2), Number(max_value / 2));
+   }
+}
+
+template <class Engine>
+void test_cpp_int(Engine& eng)
+{
+   static const unsigned sizes[] = {12, 63, 64, 65, 128, 200, 1000, 4096};
+   for (unsigned bits : sizes)
+   {
+      const cpp_int p = cpp_int(1) << bits;
+      check_uniform(eng, cpp_int(0), cpp_int(p - 1));
+      check_uniform(eng, cpp_int(0), p);
+      check_uniform(eng, cpp_int(-p), cpp_int(p - 1));
+      check_uniform(eng, cpp_int(p * 3), cpp_int(p * 5 - 1));
+   }
+}
+
+//
+// Values in [0, 1) with all their digits random: the fraction below 2^-k should be 2^-k, and
+// the last bit of the mantissa should be set half the time, even for small values:
+//
+template <class Real, class Engine>
+void test_real(Engine& eng, bool full_precision = true)
+{
+   uniform_real_distribution<Real> dist;
+   const unsigned                  n = 20000;
+   unsigned                        below[4] = {0, 0, 0, 0};
+   unsigned                        odd = 0, small = 0;
+   bool                            in_range = true;
+   Real                            sum = 0;
+   for (unsigned i = 0; i < n; ++i)
+   {
+      Real u = dist(eng);
+      if ((u < 0) || (u >= 1))
+         in_range = false;
+      sum += u;
+      for (int k = 0; k < 4; ++k)
+      {
+         if (u < ldexp(Real(1), -k - 1))
+            ++below[k];
+      }
+      if ((u != 0) && (u < Real(0.25)))
+      {
+         int  e;
+         Real m = ldexp(frexp(u, &e), std::numeric_limits<Real>::digits);
+         ++small;
+         if (fmod(m, Real(2)) != 0)
+            ++odd;
+      }
+   }
+   BOOST_CHECK(in_range);
+   BOOST_CHECK_CLOSE_FRACTION(Real(sum / n), Real(0.5), Real(0.02));
+   for (int k = 0; k < 4; ++k)
+      BOOST_CHECK_CLOSE_FRACTION(Real(below[k]) / n, ldexp(Real(1), -k - 1), Real(0.1));
+   if (full_precision)
+      BOOST_CHECK_CLOSE_FRACTION(Real(odd) / small, Real(0.5), Real(0.1));
+
+   uniform_real_distribution<Real> dist2(Real(-3), Real(5));
+   in_range = true;
+   sum      = 0;
+   for (unsigned i = 0; i < n; ++i)
+   {
+      Real u = dist2(eng);
+      if ((u < -3) || (u >= 5))
+         in_range = false;
+      sum += u;
+   }
+   BOOST_CHECK(in_range);
+   BOOST_CHECK_CLOSE_FRACTION(Real(sum / n), Real(1), Real(0.1));
+}
+
+int main()
+{
+   // Engines with 32 and 64 bit results, and the two above:
+   boost::random::mt19937& gen32 = generator();
+   std::mt19937_64         gen64;
+   odd_range_engine        odd_gen;
+   cpp_int_engine          wide_gen;
+
+   test_integer<uint256_t>(gen64);
+   test_integer<uint256_t>(gen32);
+   test_integer<uint256_t>(odd_gen);
+   test_integer<uint256_t>(wide_gen);
+   test_integer<int128_t>(gen64);
+   test_integer<uint128_t>(gen32);
+   test_integer<checked_int1024_t>(gen64);
+   test_integer<number<cpp_int_backend<64, 64, unsigned_magnitude, unchecked, void> > >(gen32);
+   test_integer<number<cpp_int_backend<70, 70, signed_magnitude, unchecked, void> > >(gen64);
+   test_integer<number<cpp_int_backend<100, 100, unsigned_magnitude, unchecked, void> > >(odd_gen);
+   test_cpp_int(gen64);
+   test_cpp_int(gen32);
+   test_cpp_int(odd_gen);
+
+   test_real<cpp_bin_float_double>(gen64);
+   test_real<cpp_bin_float_quad>(gen32);
+   test_real<cpp_bin_float_50>(gen64);
+   test_real<cpp_bin_float_50>(odd_gen);
+   test_real<number<cpp_bin_float<500> > >(gen64);
+   test_real<number<cpp_bin_float<40, digit_base_10, std::allocator<char> > > >(gen64);
+   test_real<cpp_bin_float_50>(wide_gen, false);
+   test_real<cpp_dec_float_50>(gen64, false);
+   return boost::report_errors();
+}
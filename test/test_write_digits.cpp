@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks write_digits in write_digits.hpp against to_chars and str().
+//
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/write_digits.hpp>
+#include "test.hpp"
+#include "random_integer.hpp"
+
+using namespace boost::multiprecision;
+
+template <class Number>
+std::string chars(const Number& v, int base)
+{
+   std::vector<char>     buffer(msb(abs(cpp_int(v)) + 1) + 3);
+   const to_chars_result r = to_chars(buffer.data(), buffer.data() + buffer.size(), v, base);
+   BOOST_CHECK(r.ec == std::errc());
+   return std::string(buffer.data(), r.ptr);
+}
+
+template <class Number>
+void check_integer(const Number& v, int base)
+{
+   std::string s;
+   write_digits(std::back_inserter(s), v, base);
+   BOOST_CHECK_EQUAL(s, chars(v, base));
+}
+
+template <class Number>
+void test_fixed_integer()
+{
+   static const int bases[] = {2, 3, 7, 8, 10, 16, 36};
+   for (int base : bases)
+   {
+      check_integer(Number(0), base);
+      check_integer(Number(1), base);
+      check_integer((std::numeric_limits<Number>::max)(), base);
+      check_integer((std::numeric_limits<Number>::min)(), base);
+      for (unsigned i = 0; i < 100; ++i)
+         check_integer(random_sign(Number(generate_random<cpp_int>(std::numeric_limits<Number>::digits))), base);
+   }
+}
+
+void test_integer()
+{
+   static const int bases[] = {2, 3, 7, 8, 10, 16, 36};
+   static const unsigned sizes[] = {1, 40, 64, 200, 1000, 1024, 1100, 2048, 3000, 5000, 20000, 100000};
+   for (int base : bases)
+   {
+      check_integer(cpp_int(0), base);
+      check_integer(cpp_int(-1), base);
+      for (unsigned bits : sizes)
+      {
+         for (unsigned i = 0; i < (bits > 10000 ? 2 : 20); ++i)
+            check_integer(random_sign(generate_random<cpp_int>(bits)), base);
+      }
+      //
+      // Powers of the base and their neighbours have the longest runs of zeros and the largest
+      // digits, at each of the split points:
+      //
+      for (unsigned k = 1; k < 3000; k = k * 3 / 2 + 1)
+      {
+         cpp_int p = pow(cpp_int(base), k);
+         check_integer(p, base);
+         check_integer(cpp_int(p - 1), base);
+         check_integer(cpp_int(p + 1), base);
+         check_integer(cpp_int(-p), base);
+         check_integer(cpp_int(p * p - 1), base);
+      }
+   }
+   //
+   // Base 10 is the same as str():
+   //
+   for (unsigned i = 0; i < 20; ++i)
+   {
+      cpp_int     v = random_sign(generate_random<cpp_int>(20000));
+      std::string s;
+      write_digits(std::back_inserter(s), v);
+      BOOST_CHECK_EQUAL(s, v.str());
+   }
+   //
+   // Other output iterators and streams:
+   //
+   cpp_int            v = random_sign(generate_random<cpp_int>(10000));
+   std::ostringstream ss;
+   write_digits(ss, v) << ' ';
+   write_digits(std::ostream_iterator<char>(ss), v, 16);
+   BOOST_CHECK_EQUAL(ss.str(), v.str() + ' ' + chars(v, 16));
+   std::vector<char> buffer(v.str().size() + 1, 'x');
+   BOOST_CHECK(write_digits(buffer.begin(), v) == buffer.end() - 1);
+   BOOST_CHECK_EQUAL(std::string(buffer.begin(), buffer.end() - 1), v.str());
+   BOOST_CHECK_EQUAL(buffer.back(), 'x');
+
+   number<cpp_int_backend<>, et_off> w(v);
+   std::string                       s;
+   write_digits(std::back_inserter(s), w);
+   BOOST_CHECK_EQUAL(s, v.str());
+}
+
+template <class Number>
+void check_float(const Number& v, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   std::string s;
+   write_digits(std::back_inserter(s), v, digits, f);
+   const std::streamsize expected_digits = ((f & std::ios_base::fixed) || digits) ? digits : std::numeric_limits<Number>::max_digits10 - 1;
+   BOOST_CHECK_EQUAL(s, v.str(expected_digits, f));
+   std::ostringstream ss;
+   write_digits(ss, v, digits, f);
+   BOOST_CHECK_EQUAL(ss.str(), s);
+}
+
+template <class Number>
+void check_float(const Number& v)
+{
+   static const std::ios_base::fmtflags flags[] = {std::ios_base::scientific, std::ios_base::fixed, std::ios_base::scientific | std::ios_base::showpos,
+                                                   std::ios_base::fixed | std::ios_base::showpoint, std::ios_base::scientific | std::ios_base::showpoint};
+   const std::streamsize digits[] = {0, 1, 2, 5, 10, std::numeric_limits<Number>::digits10 - 1, std::numeric_limits<Number>::digits10, std::numeric_limits<Number>::max_digits10 + 5};
+   for (std::ios_base::fmtflags f : flags)
+   {
+      for (std::streamsize d : digits)
+         check_float(v, d, f);
+   }
+}
+
+template <class Number>
+void test_float()
+{
+   check_float(Number(0));
+   check_float(Number(1));
+   check_float(Number(-1));
+   check_float(Number(0.5));
+   check_float(Number(123456789));
+   check_float(Number(1) / 3);
+   check_float(Number(-2) / 3);
+   check_float(Number(1) / 3 * pow(Number(10), 50));
+   check_float(Number(2) / 3 * pow(Number(10), -50));
+   //
+   // Rounding, ties to even and carries out of the first digit:
+   //
+   static const char* const values[] = {"0.5", "1.5", "2.5", "0.05", "0.15", "0.25", "0.0005", "0.0015", "9.5", "99.5", "999999.5", "9.9999999999",
+                                        "0.99999999999", "0.000999999", "1.25", "1.35", "1.2500000000000000000000000001", "12345678.5", "123456785",
+                                        "0.000000001", "0.00000000051", "0.0000000005", "1e-30", "9.99999999999999999999999999999999999e40"};
+   for (const char* p : values)
+   {
+      check_float(Number(p));
+      check_float(Number(-Number(p)));
+   }
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      Number v = Number(generator()()) / generator()();
+      v *= pow(Number(10), static_cast<int>(generator()() % 100) - 50);
+      check_float(generator()() & 1u ? v : Number(-v));
+   }
+   check_float(std::numeric_limits<Number>::infinity(), 10, std::ios_base::scientific);
+   check_float(Number(-std::numeric_limits<Number>::infinity()), 10, std::ios_base::fixed);
+   check_float(std::numeric_limits<Number>::infinity(), 10, std::ios_base::fixed | std::ios_base::showpos);
+   check_float(std::numeric_limits<Number>::quiet_NaN(), 10, std::ios_base::fixed);
+   //
+   // Fixed notation of a large value writes all its integer digits:
+   //
+   Number      big = pow(Number(10), 3000) / 7;
+   std::string s;
+   write_digits(std::back_inserter(s), big, 3, std::ios_base::fixed);
+   BOOST_CHECK_EQUAL(s, big.str(3, std::ios_base::fixed));
+   BOOST_CHECK_EQUAL(s.size(), 3004u);
+}
+
+int main()
+{
+   test_integer();
+   test_fixed_integer<uint256_t>();
+   test_fixed_integer<int128_t>();
+   test_fixed_integer<uint128_t>();
+   test_fixed_integer<checked_int1024_t>();
+   test_fixed_integer<number<cpp_int_backend<70, 70, unsigned_magnitude, unchecked, void> > >();
+   test_fixed_integer<number<cpp_int_backend<64, 64, signed_magnitude, unchecked, void> > >();
+   test_float<cpp_dec_float_50>();
+   test_float<cpp_dec_float_100>();
+   test_float<number<cpp_dec_float<500> > >();
+   return boost::report_errors();
+}